@@ -76,6 +76,7 @@ namespace Editor
 		OnDrawn();
 
 		o2Render.EnableScissorTest(mTimeline->layout->GetWorldRect());
+		o2Render.BeginAALinesBatch();
 
 		for (int i = 1; i < mTrack->GetKeys().Count(); i++)
 		{
@@ -91,6 +92,8 @@ namespace Editor
 							  key.GetGetApproximatedPointsBounds(), drawCoords, Color4(44, 62, 80));
 		}
 
+		o2Render.EndAALinesBatch();
+
 		for (auto handle : mHandles)
 			handle->handle->Draw();
 
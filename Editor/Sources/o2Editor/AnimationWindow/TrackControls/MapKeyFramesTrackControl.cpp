@@ -41,7 +41,7 @@ namespace Editor
 		o2Render.EnableScissorTest(mTimeline->layout->GetWorldRect());
 
 		for (auto child : mDrawingChildren)
-			child->Draw();
+			child->DrawWithCache();
 
 		o2Render.DisableScissorTest();
 
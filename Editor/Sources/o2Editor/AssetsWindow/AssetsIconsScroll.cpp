@@ -19,6 +19,7 @@
 #include "o2/Scene/UI/Widgets/Label.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 #include "o2Editor/AssetsWindow/AssetIcon.h"
+#include "o2Editor/AssetsWindow/AssetsThumbnailsCache.h"
 #include "o2Editor/AssetsWindow/AssetsWindow.h"
 #include "o2Editor/Core/Actions/Create.h"
 #include "o2Editor/Core/EditorApplication.h"
@@ -89,7 +90,7 @@ namespace Editor
 		o2Render.EnableScissorTest(mAbsoluteClipArea);
 
 		for (auto child : mDrawingChildren)
-			child->Draw();
+			child->DrawWithCache();
 
 		if (mSelecting)
 			mSelectionSprite->Draw();
@@ -398,32 +399,13 @@ namespace Editor
 		AssetInfo* asset = (AssetInfo*)item;
 		AssetIcon* assetIcon = dynamic_cast<AssetIcon*>(widget);
 
-		auto iconLayer = assetIcon->layer["icon"];
-		auto iconSprite = dynamic_cast<Sprite*>(iconLayer->GetDrawable());
-
 		if (asset->meta->GetAssetType() == &TypeOf(ImageAsset))
-		{
-			ImageAssetRef previewSpriteAsset(asset->path);
-			float previewMaxSize = 30;
-
-			if (previewSpriteAsset->width > previewSpriteAsset->height)
-			{
-				float cf = previewSpriteAsset->height / previewSpriteAsset->width;
-				iconLayer->layout = Layout::Based(BaseCorner::Center, Vec2F(previewMaxSize, previewMaxSize*cf),
-												  Vec2F(0, 10));
-			}
-			else
-			{
-				float cf = previewSpriteAsset->width / previewSpriteAsset->height;
-				iconLayer->layout = Layout::Based(BaseCorner::Center, Vec2F(previewMaxSize*cf, previewMaxSize),
-												  Vec2F(0, 10));
-			}
-
-			iconSprite->image = previewSpriteAsset;
-			iconSprite->mode = SpriteMode::Default;
-		}
+			SetupImageAssetIcon(assetIcon, *asset);
 		else
 		{
+			auto iconLayer = assetIcon->layer["icon"];
+			auto iconSprite = dynamic_cast<Sprite*>(iconLayer->GetDrawable());
+
 			iconSprite->imageName = asset->meta->GetAssetType()->InvokeStatic<String>("GetEditorIcon");
 			iconLayer->layout = Layout::Based(BaseCorner::Center, Vec2F(40, 40), Vec2F(0, 10));
 		}
@@ -442,8 +424,76 @@ namespace Editor
 		GridLayoutScrollArea::UpdateVisibleItems();
 
         mVisibleAssetIcons = mChildWidgets.DynamicCast<AssetIcon*>();
+        RequestVisibleThumbnails();
     }
 
+	AssetsThumbnailsCache* AssetsIconsScrollArea::GetThumbnailsCache() const
+	{
+		return AssetsWindow::IsSingletonInitialzed() ? o2EditorAssets.mThumbnailsCache : nullptr;
+	}
+
+	void AssetsIconsScrollArea::SetupImageAssetIcon(AssetIcon* assetIcon, const AssetInfo& asset)
+	{
+		auto iconLayer = assetIcon->layer["icon"];
+		auto iconSprite = dynamic_cast<Sprite*>(iconLayer->GetDrawable());
+
+		TextureRef thumbnail;
+		if (auto thumbnailsCache = GetThumbnailsCache())
+			thumbnail = thumbnailsCache->GetThumbnail(asset.meta->ID());
+
+		if (!thumbnail)
+		{
+			iconSprite->imageName = asset.meta->GetAssetType()->InvokeStatic<String>("GetEditorIcon");
+			iconLayer->layout = Layout::Based(BaseCorner::Center, Vec2F(40, 40), Vec2F(0, 10));
+			return;
+		}
+
+		Vec2I thumbnailSize = thumbnail->GetSize();
+		float previewMaxSize = 30;
+
+		if (thumbnailSize.x > thumbnailSize.y)
+		{
+			float cf = (float)thumbnailSize.y/(float)thumbnailSize.x;
+			iconLayer->layout = Layout::Based(BaseCorner::Center, Vec2F(previewMaxSize, previewMaxSize*cf), Vec2F(0, 10));
+		}
+		else
+		{
+			float cf = (float)thumbnailSize.x/(float)thumbnailSize.y;
+			iconLayer->layout = Layout::Based(BaseCorner::Center, Vec2F(previewMaxSize*cf, previewMaxSize), Vec2F(0, 10));
+		}
+
+		iconSprite->SetTexture(thumbnail);
+		iconSprite->SetTextureSrcRect(RectI(Vec2I(), thumbnailSize));
+		iconSprite->mode = SpriteMode::Default;
+	}
+
+	void AssetsIconsScrollArea::RequestVisibleThumbnails()
+	{
+		auto thumbnailsCache = GetThumbnailsCache();
+		if (!thumbnailsCache)
+			return;
+
+		thumbnailsCache->CancelRequests();
+
+		// Newest requests are processed first, so icons are requested from the bottom to fill view from the top
+		for (int i = mVisibleAssetIcons.Count() - 1; i >= 0; i--)
+		{
+			const AssetInfo& info = mVisibleAssetIcons[i]->GetAssetInfo();
+			if (info.meta && info.meta->GetAssetType() == &TypeOf(ImageAsset))
+				thumbnailsCache->RequestThumbnail(info);
+		}
+	}
+
+	void AssetsIconsScrollArea::OnThumbnailReady(const UID& id)
+	{
+		for (auto icon : mVisibleAssetIcons)
+		{
+			const AssetInfo& info = icon->GetAssetInfo();
+			if (info.meta && info.meta->ID() == id)
+				SetupImageAssetIcon(icon, info);
+		}
+	}
+
     void AssetsIconsScrollArea::OnDrawn()
     {
         ScrollArea::OnDrawn();
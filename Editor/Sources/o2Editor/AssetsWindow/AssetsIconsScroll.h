@@ -25,6 +25,7 @@ namespace Editor
 	class ComponentProperty;
 	class SceneTree;
 	class AssetIcon;
+	class AssetsThumbnailsCache;
 
 	// ------------------------
 	// Assets icons scroll area
@@ -165,6 +166,18 @@ namespace Editor
 		// Updates visible items
 		void UpdateVisibleItems() override;
 
+		// Returns thumbnails cache of assets window, null when window isn't created
+		AssetsThumbnailsCache* GetThumbnailsCache() const;
+
+		// Sets image asset icon sprite by thumbnail, or by image type icon while thumbnail isn't ready
+		void SetupImageAssetIcon(AssetIcon* assetIcon, const AssetInfo& asset);
+
+		// Cancels thumbnails requests of scrolled out icons and requests thumbnails of visible icons
+		void RequestVisibleThumbnails();
+
+		// It is called when thumbnail is ready, updates icon if it is visible
+		void OnThumbnailReady(const UID& id);
+
         void OnDrawn();
 
 		// It is called when widget was selected
@@ -418,6 +431,10 @@ CLASS_METHODS_META(Editor::AssetsIconsScrollArea)
 	PROTECTED_FUNCTION(Vector<void*>, GetItemsRange, int, int);
 	PROTECTED_FUNCTION(void, SetupItemWidget, Widget*, void*);
 	PROTECTED_FUNCTION(void, UpdateVisibleItems);
+	PROTECTED_FUNCTION(AssetsThumbnailsCache*, GetThumbnailsCache);
+	PROTECTED_FUNCTION(void, SetupImageAssetIcon, AssetIcon*, const AssetInfo&);
+	PROTECTED_FUNCTION(void, RequestVisibleThumbnails);
+	PROTECTED_FUNCTION(void, OnThumbnailReady, const UID&);
 	PROTECTED_FUNCTION(void, OnFocused);
 	PROTECTED_FUNCTION(void, OnUnfocused);
 	PROTECTED_FUNCTION(void, OnCursorPressed, const Input::Cursor&);
@@ -0,0 +1,254 @@
+#include "o2Editor/stdafx.h"
+#include "AssetsThumbnailsCache.h"
+
+#include "o2/Assets/AssetInfo.h"
+#include "o2/Assets/AssetsTree.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
+#include "o2/Utils/Bitmap/PngFormat.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/FileSystem/MappedFile.h"
+
+#include <cstdio>
+
+namespace Editor
+{
+	AssetsThumbnailsCache::AssetsThumbnailsCache(const String& cachePath, int maxSize /*= 64*/):
+		mCachePath(cachePath), mMaxSize(maxSize), mStopWorkers(false), mResults(256)
+	{
+		o2FileSystem.FolderCreate(mCachePath);
+
+		// Thumbnails are mostly IO bound, few workers are enough and don't load all cores
+		int workersCount = Math::Clamp((int)std::thread::hardware_concurrency()/2, 1, 4);
+		for (int i = 0; i < workersCount; i++)
+			mWorkers.emplace_back(&AssetsThumbnailsCache::WorkerThreadFunc, this);
+	}
+
+	AssetsThumbnailsCache::~AssetsThumbnailsCache()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mRequestsMutex);
+			mStopWorkers = true;
+			mRequests.Clear();
+		}
+
+		mRequestsCondition.notify_all();
+
+		for (auto& worker : mWorkers)
+			worker.join();
+
+		Result result;
+		while (mResults.TryPop(result))
+			delete result.bitmap;
+	}
+
+	void AssetsThumbnailsCache::Update()
+	{
+		Result result;
+		while (mResults.TryPop(result))
+		{
+			auto thumbnail = mThumbnails.TryGetValuePtr(result.id);
+			if (!thumbnail || thumbnail->requestId != result.requestId)
+			{
+				delete result.bitmap;
+				continue;
+			}
+
+			if (result.bitmap)
+				thumbnail->texture = TextureRef(result.bitmap);
+
+			thumbnail->ready = true;
+			delete result.bitmap;
+
+			onThumbnailReady(result.id);
+		}
+	}
+
+	void AssetsThumbnailsCache::RequestThumbnail(const AssetInfo& info)
+	{
+		UID id = info.meta->ID();
+		if (mThumbnails.ContainsKey(id))
+			return;
+
+		Thumbnail& thumbnail = mThumbnails[id];
+		thumbnail.requestId = ++mLastRequestId;
+
+		Request request;
+		request.id = id;
+		request.path = (info.tree ? info.tree->assetsPath : String()) + info.path;
+		request.requestId = thumbnail.requestId;
+
+		{
+			std::lock_guard<std::mutex> lock(mRequestsMutex);
+			mRequests.Add(request);
+		}
+
+		mRequestsCondition.notify_one();
+	}
+
+	void AssetsThumbnailsCache::CancelRequests()
+	{
+		Vector<Request> canceled;
+
+		{
+			std::lock_guard<std::mutex> lock(mRequestsMutex);
+			canceled = std::move(mRequests);
+			mRequests.Clear();
+		}
+
+		for (auto& request : canceled)
+			mThumbnails.Remove(request.id);
+	}
+
+	bool AssetsThumbnailsCache::IsThumbnailReady(const UID& id) const
+	{
+		auto thumbnail = mThumbnails.TryGetValuePtr(id);
+		return thumbnail && thumbnail->ready;
+	}
+
+	TextureRef AssetsThumbnailsCache::GetThumbnail(const UID& id) const
+	{
+		auto thumbnail = mThumbnails.TryGetValuePtr(id);
+		return thumbnail ? thumbnail->texture : TextureRef();
+	}
+
+	void AssetsThumbnailsCache::ResetThumbnails(const Vector<UID>& ids)
+	{
+		for (auto& id : ids)
+			mThumbnails.Remove(id);
+	}
+
+	int AssetsThumbnailsCache::GetMaxSize() const
+	{
+		return mMaxSize;
+	}
+
+	void AssetsThumbnailsCache::WorkerThreadFunc()
+	{
+		while (true)
+		{
+			Request request;
+
+			{
+				std::unique_lock<std::mutex> lock(mRequestsMutex);
+				mRequestsCondition.wait(lock, [&]() { return mStopWorkers || !mRequests.IsEmpty(); });
+
+				if (mStopWorkers)
+					return;
+
+				// Last requested items are in view now, so they go first
+				request = mRequests.PopBack();
+			}
+
+			Result result;
+			result.id = request.id;
+			result.requestId = request.requestId;
+			result.bitmap = LoadThumbnail(request);
+
+			while (!mResults.TryPush(result))
+			{
+				std::unique_lock<std::mutex> lock(mRequestsMutex);
+				if (mStopWorkers)
+				{
+					delete result.bitmap;
+					return;
+				}
+
+				mRequestsCondition.wait_for(lock, std::chrono::milliseconds(10));
+			}
+		}
+	}
+
+	Bitmap* AssetsThumbnailsCache::LoadThumbnail(const Request& request) const
+	{
+		MappedFile sourceFile(request.path);
+		if (!sourceFile.IsOpened())
+			return nullptr;
+
+		char hashStr[32];
+		snprintf(hashStr, sizeof(hashStr), "%016llx",
+				 (unsigned long long)GetContentHash(sourceFile.GetData(), sourceFile.GetDataSize()));
+
+		String thumbnailPath = mCachePath + (String)request.id + "_" + hashStr + ".png";
+
+		Bitmap* thumbnail = mnew Bitmap();
+		if (LoadPngImage(thumbnailPath, thumbnail, false))
+			return thumbnail;
+
+		delete thumbnail;
+
+		Bitmap source;
+		if (!LoadPngImage(request.path, &source, false))
+			return nullptr;
+
+		thumbnail = CreateDownscaled(source);
+
+		// Written into temporary file first, so other workers or editor instances never read half written thumbnail
+		String temporaryPath = thumbnailPath + "." + (String)request.requestId + ".tmp";
+		if (SavePngImage(temporaryPath, thumbnail))
+		{
+			if (rename(temporaryPath.Data(), thumbnailPath.Data()) != 0)
+				remove(temporaryPath.Data());
+		}
+
+		return thumbnail;
+	}
+
+	Bitmap* AssetsThumbnailsCache::CreateDownscaled(Bitmap& source) const
+	{
+		Vec2I sourceSize = source.GetSize();
+		float scale = Math::Min(1.0f, (float)mMaxSize/(float)Math::Max(Math::Max(sourceSize.x, sourceSize.y), 1));
+		Vec2I size(Math::Max(Math::RoundToInt(sourceSize.x*scale), 1), Math::Max(Math::RoundToInt(sourceSize.y*scale), 1));
+
+		Bitmap* result = mnew Bitmap(PixelFormat::R8G8B8A8, size);
+
+		int sourcePixelSize = source.GetFormat() == PixelFormat::R8G8B8A8 ? 4 : 3;
+		const UInt8* sourceData = source.GetData();
+		UInt8* resultData = result->GetData();
+
+		// Box filter: each result pixel is average of source pixels covered by it
+		for (int y = 0; y < size.y; y++)
+		{
+			int sourceBeginY = y*sourceSize.y/size.y;
+			int sourceEndY = Math::Max((y + 1)*sourceSize.y/size.y, sourceBeginY + 1);
+
+			for (int x = 0; x < size.x; x++)
+			{
+				int sourceBeginX = x*sourceSize.x/size.x;
+				int sourceEndX = Math::Max((x + 1)*sourceSize.x/size.x, sourceBeginX + 1);
+
+				UInt sum[4] = { 0, 0, 0, 0 };
+				for (int sy = sourceBeginY; sy < sourceEndY; sy++)
+				{
+					const UInt8* sourcePixel = sourceData + (sy*sourceSize.x + sourceBeginX)*sourcePixelSize;
+					for (int sx = sourceBeginX; sx < sourceEndX; sx++, sourcePixel += sourcePixelSize)
+					{
+						sum[0] += sourcePixel[0];
+						sum[1] += sourcePixel[1];
+						sum[2] += sourcePixel[2];
+						sum[3] += sourcePixelSize == 4 ? sourcePixel[3] : 255;
+					}
+				}
+
+				UInt count = (UInt)((sourceEndY - sourceBeginY)*(sourceEndX - sourceBeginX));
+				UInt8* resultPixel = resultData + (y*size.x + x)*4;
+				for (int i = 0; i < 4; i++)
+					resultPixel[i] = (UInt8)(sum[i]/count);
+			}
+		}
+
+		return result;
+	}
+
+	UInt64 AssetsThumbnailsCache::GetContentHash(const char* data, UInt64 size)
+	{
+		// FNV-1a
+		UInt64 hash = 14695981039346656037ull;
+		for (UInt64 i = 0; i < size; i++)
+		{
+			hash ^= (UInt8)data[i];
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "o2/Render/TextureRef.h"
+#include "o2/Utils/Delegates.h"
+#include "o2/Utils/Types/Containers/ConcurrentQueue.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
+#include "o2/Utils/Types/UID.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace o2;
+
+namespace o2
+{
+	class Bitmap;
+	struct AssetInfo;
+}
+
+namespace Editor
+{
+	// ------------------------------------------------------------------------------------------------------------------
+	// Image assets thumbnails cache. Thumbnails are downscaled by worker threads and saved on disk with asset UID and
+	// source content hash in file name, so next time they are just loaded. Newest requests are processed first, pending
+	// requests can be canceled when items are scrolled out of view. Ready thumbnails are taken on main thread in Update,
+	// textures are created there and onThumbnailReady is called
+	// ------------------------------------------------------------------------------------------------------------------
+	class AssetsThumbnailsCache
+	{
+	public:
+		Function<void(const UID&)> onThumbnailReady; // Thumbnail ready event, called on main thread
+
+	public:
+		// Constructor with cache folder path. Starts workers threads
+		AssetsThumbnailsCache(const String& cachePath, int maxSize = 64);
+
+		// Destructor. Stops workers threads
+		~AssetsThumbnailsCache();
+
+		// Takes ready thumbnails from workers, creates textures and calls onThumbnailReady
+		void Update();
+
+		// Requests thumbnail of image asset, if it isn't ready or requested yet
+		void RequestThumbnail(const AssetInfo& info);
+
+		// Cancels all not started requests
+		void CancelRequests();
+
+		// Returns true when thumbnail is ready or can't be created
+		bool IsThumbnailReady(const UID& id) const;
+
+		// Returns thumbnail texture, empty when it isn't ready or can't be created
+		TextureRef GetThumbnail(const UID& id) const;
+
+		// Removes thumbnails of changed assets, they will be created again on next request
+		void ResetThumbnails(const Vector<UID>& ids);
+
+		// Returns thumbnail maximal width or height
+		int GetMaxSize() const;
+
+	protected:
+		// --------------------------------------
+		// Thumbnail generation request to worker
+		// --------------------------------------
+		struct Request
+		{
+			UID    id;            // Asset id
+			String path;          // Asset source file path
+			UInt64 requestId = 0; // Unique request id, results of reset thumbnails requests are skipped
+		};
+
+		// -----------------------------
+		// Loaded or generated thumbnail
+		// -----------------------------
+		struct Result
+		{
+			UID     id;               // Asset id
+			UInt64  requestId = 0;    // Request id
+			Bitmap* bitmap = nullptr; // Thumbnail bitmap, null when source can't be loaded
+		};
+
+		// ------------------------------------
+		// Thumbnail state, used on main thread
+		// ------------------------------------
+		struct Thumbnail
+		{
+			TextureRef texture;       // Thumbnail texture
+			UInt64     requestId = 0; // Last request id
+			bool       ready = false; // Is thumbnail ready or failed
+		};
+
+	protected:
+		String mCachePath; // Thumbnails files folder
+		int    mMaxSize;   // Thumbnail maximal width or height
+
+		HashMap<UID, Thumbnail> mThumbnails;        // Requested and ready thumbnails by assets ids
+		UInt64                  mLastRequestId = 0; // Last request id
+
+		Vector<Request>         mRequests;          // Not started requests, processed from the end
+		std::mutex              mRequestsMutex;     // Requests access mutex
+		std::condition_variable mRequestsCondition; // Workers wake up condition
+		bool                    mStopWorkers;       // Is workers must stop, guarded by requests mutex
+
+		ConcurrentQueue<Result> mResults; // Ready results, taken on main thread
+
+		std::vector<std::thread> mWorkers; // Workers threads
+
+	protected:
+		// Worker thread function: takes requests and pushes results
+		void WorkerThreadFunc();
+
+		// Loads thumbnail from cache or creates it from asset source and saves into cache
+		Bitmap* LoadThumbnail(const Request& request) const;
+
+		// Returns downscaled copy of bitmap with size no more than max size
+		Bitmap* CreateDownscaled(Bitmap& source) const;
+
+		// Returns content hash of data
+		static UInt64 GetContentHash(const char* data, UInt64 size);
+	};
+}
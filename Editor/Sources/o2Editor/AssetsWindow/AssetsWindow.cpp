@@ -22,6 +22,7 @@
 #include "o2/Utils/System/Clipboard.h"
 #include "o2Editor/AssetsWindow/AssetIcon.h"
 #include "o2Editor/AssetsWindow/AssetsIconsScroll.h"
+#include "o2Editor/AssetsWindow/AssetsThumbnailsCache.h"
 #include "o2Editor/AssetsWindow/FoldersTree.h"
 #include "o2Editor/Core/EditorConfig.h"
 
@@ -36,12 +37,16 @@ namespace Editor
 	}
 
 	AssetsWindow::~AssetsWindow()
-	{}
+	{
+		delete mThumbnailsCache;
+	}
 
 	void AssetsWindow::InitializeWindow()
 	{
 		o2Assets.onAssetsRebuilt += THIS_FUNC(OnAssetsRebuilt);
 
+		mThumbnailsCache = mnew AssetsThumbnailsCache("Cache/Thumbnails/");
+
 		mWindow->caption = "Assets";
 		mWindow->name = "assets window";
 		mWindow->SetIcon(mnew Sprite("ui/UI4_folder_icon.png"));
@@ -55,6 +60,8 @@ namespace Editor
 		InitializeFoldersTreeVisibleState();
 		InitializeFoldersTreeSeparator();
 
+		mThumbnailsCache->onThumbnailReady = [&](const UID& id) { mAssetsGridScroll->OnThumbnailReady(id); };
+
 		OpenFolder("");
 	}
 
@@ -184,6 +191,9 @@ namespace Editor
 	{
 		IEditorWindow::Update(dt);
 		mFoldersTreeShowAnim.Update(dt);
+
+		if (mThumbnailsCache)
+			mThumbnailsCache->Update();
 	}
 
 	void AssetsWindow::SelectAsset(const UID& id)
@@ -431,6 +441,8 @@ namespace Editor
 
 	void AssetsWindow::OnAssetsRebuilt(const Vector<UID>& changedAssets)
 	{
+		mThumbnailsCache->ResetThumbnails(changedAssets);
+
 		mFoldersTree->UpdateView();
 		mFoldersTree->SelectAndExpandFolder(mAssetsGridScroll->GetViewingPath());
 
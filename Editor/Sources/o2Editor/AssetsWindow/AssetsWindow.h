@@ -27,6 +27,7 @@ namespace o2
 namespace Editor
 {
 	class AssetsIconsScrollArea;
+	class AssetsThumbnailsCache;
 	class AssetsFoldersTree;
 
 	// -------------
@@ -116,6 +117,8 @@ namespace Editor
 
 		AssetsIconsScrollArea* mAssetsGridScroll; // Assets grid scroll
 
+		AssetsThumbnailsCache* mThumbnailsCache = nullptr; // Image assets thumbnails cache
+
 		Tree* mAssetsTree; // Assets tree
 
 		CursorEventsArea mSeparatorHandle; // Folders tree and assets tree/grid separator handle
@@ -178,6 +181,7 @@ CLASS_FIELDS_META(Editor::AssetsWindow)
 	PROTECTED_FIELD(mFoldersTreeShowAnim);
 	PROTECTED_FIELD(mFoldersTreeVisible);
 	PROTECTED_FIELD(mAssetsGridScroll);
+	PROTECTED_FIELD(mThumbnailsCache).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(mAssetsTree);
 	PROTECTED_FIELD(mSeparatorHandle);
 	PROTECTED_FIELD(mSeparatorCoef);
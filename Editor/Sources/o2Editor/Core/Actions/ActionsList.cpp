@@ -72,8 +72,24 @@ namespace Editor
 	void ActionsList::DoneActorPropertyChangeAction(const String& path, const Vector<DataDocument>& prevValue,
 													const Vector<DataDocument>& newValue)
 	{
-		PropertyChangeAction* action = mnew PropertyChangeAction(
-			o2EditorSceneScreen.GetSelectedObjects(), path, prevValue, newValue);
+		auto& selectedObjects = o2EditorSceneScreen.GetSelectedObjects();
+
+		if (mForwardActions.IsEmpty() && !mActions.IsEmpty())
+		{
+			if (auto lastAction = dynamic_cast<PropertyChangeAction*>(mActions.Last()))
+			{
+				if (lastAction->TryMerge(selectedObjects, path, prevValue, newValue))
+					return;
+			}
+		}
+
+		PropertyChangeAction* action = mnew PropertyChangeAction(selectedObjects, path, prevValue, newValue);
+
+		if (action->IsEmpty())
+		{
+			delete action;
+			return;
+		}
 
 		DoneAction(action);
 	}
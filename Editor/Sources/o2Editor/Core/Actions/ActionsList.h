@@ -31,7 +31,8 @@ namespace Editor
 		// It is called when action was done
 		void DoneAction(IAction* action);
 
-		// It is called when some property changed, stores action for undo
+		// It is called when some property changed, stores action for undo. Continuous changes of same property
+		// are merged into last action
 		void DoneActorPropertyChangeAction(const String& path, 
 										   const Vector<DataDocument>& prevValue, const Vector<DataDocument>& newValue);
 
@@ -5,9 +5,12 @@
 #include "o2/Scene/Component.h"
 #include "o2/Scene/Scene.h"
 #include "o2/Utils/Editor/SceneEditableObject.h"
+#include "o2/Utils/System/Time/Time.h"
 
 namespace Editor
 {
+	float PropertyChangeAction::mergeTimeThreshold = 0.5f;
+
 	PropertyChangeAction::PropertyChangeAction()
 	{}
 
@@ -16,8 +19,11 @@ namespace Editor
 											   const Vector<DataDocument>& beforeValues,
 											   const Vector<DataDocument>& afterValues) :
 		objectsIds(objects.Convert<SceneUID>([](const SceneEditableObject* x) { return x->GetID(); })),
-		propertyPath(propertyPath), beforeValues(beforeValues), afterValues(afterValues)
-	{}
+		propertyPath(propertyPath)
+	{
+		BuildDeltas(beforeValues, afterValues);
+		mLastChangeTime = o2Time.GetApplicationTime();
+	}
 
 	String PropertyChangeAction::GetName() const
 	{
@@ -26,17 +32,162 @@ namespace Editor
 
 	void PropertyChangeAction::Redo()
 	{
-		SetProperties(afterValues);
+		SetProperties(false);
 	}
 
 	void PropertyChangeAction::Undo()
 	{
-		SetProperties(beforeValues);
+		SetProperties(true);
+	}
+
+	bool PropertyChangeAction::IsEmpty() const
+	{
+		return deltas.IsEmpty();
+	}
+
+	bool PropertyChangeAction::TryMerge(const Vector<SceneEditableObject*>& objects,
+										const String& propertyPath,
+										const Vector<DataDocument>& beforeValues,
+										const Vector<DataDocument>& afterValues)
+	{
+		if (propertyPath != this->propertyPath || objects.Count() != objectsIds.Count())
+			return false;
+
+		float time = o2Time.GetApplicationTime();
+		if (time - mLastChangeTime > mergeTimeThreshold)
+			return false;
+
+		for (int i = 0; i < objects.Count(); i++)
+		{
+			if (objects[i]->GetID() != objectsIds[i])
+				return false;
+		}
+
+		// Values before new change are values after this action, so restoring our before values on them
+		// gives initial values of whole continuous change
+		Vector<DataDocument> initialValues = beforeValues;
+		for (int i = 0; i < initialValues.Count(); i++)
+			ApplyDeltas(i, initialValues[i], true);
+
+		deltas.Clear();
+		values.Clear();
+		BuildDeltas(initialValues, afterValues);
+
+		mLastChangeTime = time;
+
+		return true;
+	}
+
+	void PropertyChangeAction::BuildDeltas(const Vector<DataDocument>& beforeValues, const Vector<DataDocument>& afterValues)
+	{
+		int count = Math::Min(beforeValues.Count(), afterValues.Count());
+		for (int i = 0; i < count; i++)
+			CollectDeltas(i, "", beforeValues[i], afterValues[i]);
+	}
+
+	void PropertyChangeAction::CollectDeltas(int objectIdx, const String& path, const DataValue& before, const DataValue& after)
+	{
+		String prefix = path.IsEmpty() ? path : path + "/";
+
+		if (before.IsObject() && after.IsObject() && before.GetMembersCount() == after.GetMembersCount())
+		{
+			bool sameMembers = true;
+			for (auto it = after.BeginMember(); it != after.EndMember(); ++it)
+			{
+				if (!before.FindMember(it->name))
+				{
+					sameMembers = false;
+					break;
+				}
+			}
+
+			if (sameMembers)
+			{
+				for (auto it = after.BeginMember(); it != after.EndMember(); ++it)
+				{
+					String name = it->name;
+					CollectDeltas(objectIdx, prefix + name, *before.FindMember(it->name), it->value);
+				}
+
+				return;
+			}
+		}
+		else if (before.IsArray() && after.IsArray() && before.GetElementsCount() == after.GetElementsCount())
+		{
+			for (int i = 0; i < after.GetElementsCount(); i++)
+				CollectDeltas(objectIdx, prefix + (String)i, before.GetElement(i), after.GetElement(i));
+
+			return;
+		}
+
+		if (before == after)
+			return;
+
+		ValueDelta delta;
+		delta.objectIdx = objectIdx;
+		delta.path = path;
+		delta.beforeValue = AddValue(path, before, true);
+		delta.afterValue = AddValue(path, after, false);
+
+		deltas.Add(delta);
+	}
+
+	int PropertyChangeAction::AddValue(const String& path, const DataValue& value, bool before)
+	{
+		// Multiple selected objects usually have equal values, sharing them with previous object's delta
+		for (int i = deltas.Count() - 1; i >= 0; i--)
+		{
+			const ValueDelta& delta = deltas[i];
+			if (delta.path != path)
+				continue;
+
+			int valueIdx = before ? delta.beforeValue : delta.afterValue;
+			if (values.GetElement(valueIdx) == value)
+				return valueIdx;
+
+			break;
+		}
+
+		values.AddElement() = value;
+		return values.GetElementsCount() - 1;
 	}
 
-	void PropertyChangeAction::SetProperties(Vector<DataDocument>& values)
+	void PropertyChangeAction::ApplyDeltas(int objectIdx, DataValue& data, bool before) const
 	{
-		Vector<SceneEditableObject*> objects = objectsIds.Convert<SceneEditableObject*>([](SceneUID id) { 
+		for (auto& delta : deltas)
+		{
+			if (delta.objectIdx != objectIdx)
+				continue;
+
+			DataValue* target = &data;
+			if (!delta.path.IsEmpty())
+			{
+				for (auto& part : delta.path.Split("/"))
+				{
+					if (target->IsArray())
+					{
+						int idx = (int)part;
+						if (idx < 0 || idx >= target->GetElementsCount())
+						{
+							target = nullptr;
+							break;
+						}
+
+						target = &target->GetElement(idx);
+					}
+					else
+						target = &target->GetMember(part.Data());
+				}
+			}
+
+			if (target)
+				*target = values.GetElement(before ? delta.beforeValue : delta.afterValue);
+		}
+	}
+
+	void PropertyChangeAction::SetProperties(bool before)
+	{
+		Vector<SceneEditableObject*> objects = objectsIds.Convert<SceneEditableObject*>([](SceneUID id) {
 			return o2Scene.GetEditableObjectByID(id); });
 
 		const Type* componentType = nullptr;
@@ -53,14 +204,11 @@ namespace Editor
 			componentType = o2Reflection.GetType(typeName);
 		}
 
-		int i = 0;
-		for (auto object : objects)
+		for (int i = 0; i < objects.Count(); i++)
 		{
-			if (!object)
-			{
+			auto object = objects[i];
+			if (!object || !deltas.Contains([&](const ValueDelta& x) { return x.objectIdx == i; }))
 				continue;
-				i++;
-			}
 
 			const FieldInfo* fi = nullptr;
 			void* ptr = nullptr;
@@ -85,13 +233,24 @@ namespace Editor
 			}
 
 			if (fi && ptr)
-				fi->Deserialize(ptr, values[i]);
+			{
+				DataDocument data;
+				fi->Serialize(ptr, data);
+				ApplyDeltas(i, data, before);
+				fi->Deserialize(ptr, data);
+			}
 
 			object->OnChanged();
-
-			i++;
 		}
 	}
+
+	bool PropertyChangeAction::ValueDelta::operator==(const ValueDelta& other) const
+	{
+		return objectIdx == other.objectIdx && path == other.path &&
+			beforeValue == other.beforeValue && afterValue == other.afterValue;
+	}
 }
 
 DECLARE_CLASS(Editor::PropertyChangeAction);
+
+DECLARE_CLASS(Editor::PropertyChangeAction::ValueDelta);
@@ -11,17 +11,42 @@ namespace o2
 
 namespace Editor
 {
-	// -----------------------------------------------------
+	// ---------------------------------------------------------------------------------------
 	// Scene object property change action.
-	// Storing path to value, values before and after change
-	// -----------------------------------------------------
+	// Storing path to value and field-level delta: only changed values inside property data.
+	// Values before and after change are stored once in shared values document, equal values
+	// of different objects are shared by index
+	// ---------------------------------------------------------------------------------------
 	class PropertyChangeAction: public IAction
 	{
 	public:
-		Vector<SceneUID>     objectsIds;
-		String               propertyPath;
-		Vector<DataDocument> beforeValues;
-		Vector<DataDocument> afterValues;
+		// -----------------------------------------------------------------------
+		// Changed value of object. Contains path inside property data and indexes
+		// of values before and after change in values document
+		// -----------------------------------------------------------------------
+		class ValueDelta: public ISerializable
+		{
+		public:
+			int    objectIdx = 0;   // Index of object in objects list @SERIALIZABLE
+			String path;            // Path inside property data, empty when whole value changed @SERIALIZABLE
+			int    beforeValue = 0; // Index of value before change in values document @SERIALIZABLE
+			int    afterValue = 0;  // Index of value after change in values document @SERIALIZABLE
+
+		public:
+			// Check equals operator
+			bool operator==(const ValueDelta& other) const;
+
+			SERIALIZABLE(ValueDelta);
+		};
+
+	public:
+		static float mergeTimeThreshold; // Max time between continuous changes of same property to merge them into one action
+
+	public:
+		Vector<SceneUID>   objectsIds;
+		String             propertyPath;
+		Vector<ValueDelta> deltas;
+		DataDocument       values;
 
 	public:
 		// Default constructor
@@ -42,11 +67,35 @@ namespace Editor
 		// Sets object's properties value as before change
 		void Undo();
 
+		// Returns is there no changed values
+		bool IsEmpty() const;
+
+		// Tries to merge continuous change of same property into this action. Returns true when merged
+		bool TryMerge(const Vector<SceneEditableObject*>& objects,
+					  const String& propertyPath,
+					  const Vector<DataDocument>& beforeValues,
+					  const Vector<DataDocument>& afterValues);
+
 		SERIALIZABLE(PropertyChangeAction);
 
 	protected:
+		float mLastChangeTime = 0.0f; // Application time of last merged change
+
+	protected:
+		// Builds deltas between before and after values of all objects
+		void BuildDeltas(const Vector<DataDocument>& beforeValues, const Vector<DataDocument>& afterValues);
+
+		// Collects changed values between before and after data recursively
+		void CollectDeltas(int objectIdx, const String& path, const DataValue& before, const DataValue& after);
+
+		// Adds value into values document, reuses equal value of previous delta with same path
+		int AddValue(const String& path, const DataValue& value, bool before);
+
+		// Applies deltas of object to serialized property data
+		void ApplyDeltas(int objectIdx, DataValue& data, bool before) const;
+
 		// Sets object's properties values
-		void SetProperties(Vector<DataDocument>& value);
+		void SetProperties(bool before);
 	};
 }
 
@@ -59,8 +108,9 @@ CLASS_FIELDS_META(Editor::PropertyChangeAction)
 {
 	PUBLIC_FIELD(objectsIds);
 	PUBLIC_FIELD(propertyPath);
-	PUBLIC_FIELD(beforeValues);
-	PUBLIC_FIELD(afterValues);
+	PUBLIC_FIELD(deltas);
+	PUBLIC_FIELD(values);
+	PROTECTED_FIELD(mLastChangeTime).DEFAULT_VALUE(0.0f);
 }
 END_META;
 CLASS_METHODS_META(Editor::PropertyChangeAction)
@@ -69,6 +119,30 @@ CLASS_METHODS_META(Editor::PropertyChangeAction)
 	PUBLIC_FUNCTION(String, GetName);
 	PUBLIC_FUNCTION(void, Redo);
 	PUBLIC_FUNCTION(void, Undo);
-	PROTECTED_FUNCTION(void, SetProperties, Vector<DataDocument>&);
+	PUBLIC_FUNCTION(bool, IsEmpty);
+	PUBLIC_FUNCTION(bool, TryMerge, const Vector<SceneEditableObject*>&, const String&, const Vector<DataDocument>&, const Vector<DataDocument>&);
+	PROTECTED_FUNCTION(void, BuildDeltas, const Vector<DataDocument>&, const Vector<DataDocument>&);
+	PROTECTED_FUNCTION(void, CollectDeltas, int, const String&, const DataValue&, const DataValue&);
+	PROTECTED_FUNCTION(int, AddValue, const String&, const DataValue&, bool);
+	PROTECTED_FUNCTION(void, ApplyDeltas, int, DataValue&, bool);
+	PROTECTED_FUNCTION(void, SetProperties, bool);
+}
+END_META;
+
+CLASS_BASES_META(Editor::PropertyChangeAction::ValueDelta)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(Editor::PropertyChangeAction::ValueDelta)
+{
+	PUBLIC_FIELD(objectIdx).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(path).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(beforeValue).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(afterValue).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
+}
+END_META;
+CLASS_METHODS_META(Editor::PropertyChangeAction::ValueDelta)
+{
 }
 END_META;
@@ -10,6 +10,7 @@
 #include "o2/Scene/Actor.h"
 #include "o2/Scene/Components/ImageComponent.h"
 #include "o2/Scene/Scene.h"
+#include "o2/Scene/SceneLoadingTask.h"
 #include "o2/Scene/UI/UIManager.h"
 #include "o2/Scene/UI/Widget.h"
 #include "o2/Scene/UI/WidgetState.h"
@@ -53,10 +54,10 @@ namespace Editor
 	void EditorApplication::LoadScene(const String& name)
 	{
 		mLoadedScene = name;
-		o2Scene.Load(name);
-		o2Scene.Update(0.0f);
 
-		ResetUndoActions();
+		// Scene is loaded by slices in UpdateScene, editor stays responsive
+		auto task = o2Scene.LoadAsync(name);
+		task->onLoaded = [&]() { ResetUndoActions(); };
 	}
 
 	void EditorApplication::SaveScene(const String& name)
@@ -89,14 +90,13 @@ namespace Editor
 		{
 			o2EditorSceneScreen.ClearSelection();
 
-			mSceneDump.Clear();
-			o2Scene.Save(mSceneDump);
-			o2Scene.Load(mSceneDump);
+			mSceneSnapshot.Capture();
 		}
 		else
 		{
 			o2EditorSceneScreen.ClearSelection();
-			o2Scene.Load(mSceneDump);
+			mSceneSnapshot.Restore();
+			mSceneSnapshot.Clear();
 		}
 
 		mIsPlaying = playing;
@@ -190,7 +190,7 @@ namespace Editor
 	void EditorApplication::LoadUIStyle()
 	{
 		EditorUIStyleBuilder builder;
-		builder.RebuildEditorUIManager("editor_ui_style.json", true, true);
+		builder.RebuildEditorUIManager("editor_ui_style.bin", true, true);
 	}
 
 	void EditorApplication::PreUpdatePhysics()
@@ -216,6 +216,11 @@ namespace Editor
 			mScene->Update(dt);
 			o2EditorSceneScreen.NeedRedraw();
 		}
+		else if (mScene->IsLoading())
+		{
+			mScene->Update(0.0f);
+			o2EditorSceneScreen.NeedRedraw();
+		}
 	}
 
 	void EditorApplication::FixedUpdateScene(float dt)
@@ -5,6 +5,7 @@
 #include "o2/Render/Sprite.h"
 #include "o2Editor/Core/Actions/ActionsList.h"
 #include "o2Editor/Core/EditorConfig.h"
+#include "o2Editor/Core/SceneSnapshot.h"
 
 using namespace o2;
 
@@ -57,7 +58,7 @@ namespace Editor
 		// Returns is current scene was changed
 		bool IsSceneChanged() const;
 
-		// Runs or stops scene playing. Saving scene into temprorary file before playing, restoring after stopping
+		// Runs or stops scene playing. Captures scene snapshot before playing, restores changed actors after stopping
 		void SetPlaying(bool playing);
 
 		// Is scene playing
@@ -82,7 +83,7 @@ namespace Editor
 
 		String mLoadedScene; // Current loaded scene
 
-		DataDocument mSceneDump; // Scene dump, created before playing
+		SceneSnapshot mSceneSnapshot; // Scene snapshot, captured before playing
 
 		bool mIsPlaying = false;  // Is editor scene playing
 		bool mUpdateStep = false; // True when frame updating available on this frame
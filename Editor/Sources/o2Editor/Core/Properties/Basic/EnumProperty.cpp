@@ -43,10 +43,18 @@ namespace Editor
 
 	void EnumProperty::SpecializeType(const Type* type)
 	{
+		const EnumType* enumType;
 		if (type->GetUsage() == Type::Usage::Property)
-			mEnumType = dynamic_cast<const EnumType*>(((const PropertyType*)type)->GetValueType());
+			enumType = dynamic_cast<const EnumType*>(((const PropertyType*)type)->GetValueType());
 		else
-			mEnumType = dynamic_cast<const EnumType*>(type);
+			enumType = dynamic_cast<const EnumType*>(type);
+
+		// Pooled property can be reused for same enum, items are already filled
+		if (enumType == mEnumType)
+			return;
+
+		mEnumType = enumType;
+		mDropDown->RemoveAllItems();
 
 		if (mEnumType)
 		{
@@ -39,6 +39,8 @@ namespace Editor
 		}
 
 		mObjectViewer = nullptr;
+
+		IPropertyField::OnFreeProperty();
 	}
 
 	void ObjectProperty::CopyData(const Actor& otherActor)
@@ -43,6 +43,8 @@ namespace Editor
 		}
 
 		mObjectViewer = nullptr;
+
+		IPropertyField::OnFreeProperty();
 	}
 
 	void ObjectPtrProperty::CopyData(const Actor& otherActor)
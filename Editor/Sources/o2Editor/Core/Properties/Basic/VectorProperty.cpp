@@ -255,6 +255,11 @@ namespace Editor
 		return mVectorType;
 	}
 
+	const Type* VectorProperty::GetPoolType() const
+	{
+		return mVectorType;
+	}
+
 	void VectorProperty::SpecializeType(const Type* type)
 	{
 		mVectorType = nullptr;
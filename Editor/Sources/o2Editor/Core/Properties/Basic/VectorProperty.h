@@ -44,6 +44,9 @@ namespace Editor
 		// Returns editing by this field type
 		const Type* GetValueType() const override;
 
+		// Returns specialized vector type: elements fields are kept in pooled field, so it's reused only for same type
+		const Type* GetPoolType() const override;
+
 		// Sets property caption
 		void SetCaption(const WString& text) override;
 
@@ -179,6 +182,7 @@ CLASS_METHODS_META(Editor::VectorProperty)
 	PUBLIC_FUNCTION(void, SetValueAndPrototypeProxy, const TargetsVec&);
 	PUBLIC_FUNCTION(void, Refresh);
 	PUBLIC_FUNCTION(const Type*, GetValueType);
+	PUBLIC_FUNCTION(const Type*, GetPoolType);
 	PUBLIC_FUNCTION(void, SetCaption, const WString&);
 	PUBLIC_FUNCTION(WString, GetCaption);
 	PUBLIC_FUNCTION(Button*, GetRemoveButton);
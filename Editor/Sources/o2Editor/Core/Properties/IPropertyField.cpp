@@ -123,6 +123,11 @@ namespace Editor
 		return nullptr;
 	}
 
+	const Type* IPropertyField::GetPoolType() const
+	{
+		return &GetType();
+	}
+
 	bool IPropertyField::IsValuesDifferent() const
 	{
 		return mValuesDifferent;
@@ -170,7 +175,15 @@ namespace Editor
 	}
 
 	void IPropertyField::OnFreeProperty()
-	{}
+	{
+		mValuesProxies.Clear();
+		mValuesDifferent = true;
+		mParentContext = nullptr;
+		mFieldInfo = nullptr;
+
+		onChanged.Clear();
+		onChangeCompleted.Clear();
+	}
 
 	void IPropertyField::CheckValueChangeCompleted()
 	{
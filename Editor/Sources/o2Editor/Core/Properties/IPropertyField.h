@@ -81,6 +81,10 @@ namespace Editor
 		// Returns editing by this field type by static function, can't be changed during runtime
 		static const Type* GetValueTypeStatic();
 
+		// Returns type of pool where field is stored when it's free. Fields from one pool are interchangeable, reused
+		// field is only rebound to new values. By default it is field's class
+		virtual const Type* GetPoolType() const;
+
 		// Returns is values different
 		bool IsValuesDifferent() const;
 
@@ -160,7 +164,8 @@ namespace Editor
 		// It is called when type specialized during setting value proxy
 		virtual void OnTypeSpecialized(const Type& type) {}
 
-		// It is called when property puts in buffer. Here you can release your shared resources
+		// It is called when property puts in buffer. Here you can release your shared resources. Resets values proxies,
+		// context and callbacks, so pooled field doesn't keep targets
 		virtual void OnFreeProperty();
 
 		// Stores values to data
@@ -563,6 +568,7 @@ CLASS_METHODS_META(Editor::IPropertyField)
 	PUBLIC_FUNCTION(Button*, GetRemoveButton);
 	PUBLIC_FUNCTION(const Type*, GetValueType);
 	PUBLIC_STATIC_FUNCTION(const Type*, GetValueTypeStatic);
+	PUBLIC_FUNCTION(const Type*, GetPoolType);
 	PUBLIC_FUNCTION(bool, IsValuesDifferent);
 	PUBLIC_FUNCTION(void, SetValuePath, const String&);
 	PUBLIC_FUNCTION(const String&, GetValuePath);
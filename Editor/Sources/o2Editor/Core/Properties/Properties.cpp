@@ -7,7 +7,6 @@
 #include "o2/Scene/UI/Widgets/Spoiler.h"
 #include "o2/Scene/UI/Widgets/VerticalLayout.h"
 #include "o2/Utils/Editor/Attributes/InvokeOnChangeAttribute.h"
-#include "o2/Utils/System/Time/Timer.h"
 #include "o2Editor/Core/EditorApplication.h"
 #include "o2/Utils/Editor/EditorScope.h"
 #include "o2Editor/Core/Properties/Basic/AssetProperty.h"
@@ -107,10 +106,8 @@ namespace Editor
 										   const IPropertyField::OnChangeCompletedFunc& onChangeCompleted /*= mOnPropertyCompletedChangingUndoCreateDelegate*/,
 										   const IPropertyField::OnChangedFunc& onChanged /*= IPropertyField::OnChangedFunc::empty*/)
 	{
-		Timer timer;
-
 		const Type* fieldType = fieldInfo->GetType();
-		String propertyName = MakeSmartFieldName(fieldInfo->GetName());
+		const String& propertyName = GetFieldCaption(fieldInfo);
 
 		auto fieldWidget = CreateFieldProperty(fieldType, propertyName, onChangeCompleted, onChanged);
 		if (!fieldWidget)
@@ -137,8 +134,6 @@ namespace Editor
 
 		context.properties.Add(fieldInfo, fieldWidget);
 
-		//o2Debug.Log("Field " + path + "/" + fieldInfo->GetName() + " for " + (String)timer.GetDeltaTime());
-
 		return fieldWidget;
 	}
 
@@ -155,12 +150,8 @@ namespace Editor
 								 const IPropertyField::OnChangeCompletedFunc& onChangeCompleted /*= mOnPropertyCompletedChangingUndoCreateDelegate*/,
 								 const IPropertyField::OnChangedFunc& onChanged /*= IPropertyField::OnChangedFunc::empty*/)
 	{
-		Timer timer; 
-
 		for (auto fieldInfo : fields)
 			BuildField(layout, fieldInfo, context, path, onChangeCompleted, onChanged);
-
-		//o2Debug.Log(">>> Fields created for " + (String)timer.GetDeltaTime());
 	}
 
 	void Properties::BuildFields(VerticalLayout* layout, const Type& objectType, const Vector<String>& fieldsNames, 
@@ -215,14 +206,24 @@ namespace Editor
 
 	void Properties::FreeProperty(IPropertyField* field)
 	{
-		if (!mPropertiesPool.ContainsKey(field->GetValueType()))
-			mPropertiesPool.Add(field->GetValueType(), Vector<IPropertyField*>());
+		const Type* poolType = field->GetPoolType();
+		if (!mPropertiesPool.ContainsKey(poolType))
+			mPropertiesPool.Add(poolType, Vector<IPropertyField*>());
 
-		mPropertiesPool[field->GetValueType()].Add(field);
+		mPropertiesPool[poolType].Add(field);
 		field->OnFreeProperty();
 		field->SetParent(nullptr, false);
 	}
 
+	IPropertyField* Properties::TakePooledProperty(const Type* poolType)
+	{
+		auto fnd = mPropertiesPool.find(poolType);
+		if (fnd == mPropertiesPool.end() || fnd->second.IsEmpty())
+			return nullptr;
+
+		return fnd->second.PopBack();
+	}
+
 	bool Properties::IsPropertyVisible(const FieldInfo* info, bool allowPrivate) const
 	{
 		if (info->HasAttribute<IgnoreEditorPropertyAttribute>())
@@ -247,7 +248,7 @@ namespace Editor
 										   const IPropertyField::OnChangeCompletedFunc& onChangeCompleted /*= mOnPropertyCompletedChangingUndoCreateDelegate*/,
 										   const IPropertyField::OnChangedFunc& onChanged /*= IPropertyField::OnChangedFunc::empty*/)
 	{
-		BuildObjectProperties(layout, type->GetFieldsWithBaseClasses(), context, path, onChangeCompleted, onChanged);
+		BuildFieldsLayout(layout, GetFieldsLayout(type), context, path, onChangeCompleted, onChanged);
 	}
 
 	void Properties::BuildObjectProperties(VerticalLayout* layout, Vector<const FieldInfo*> fields,
@@ -255,17 +256,21 @@ namespace Editor
 										   const IPropertyField::OnChangeCompletedFunc& onChangeCompleted /*= mOnPropertyCompletedChangingUndoCreateDelegate*/,
 										   const IPropertyField::OnChangedFunc& onChanged /*= IPropertyField::OnChangedFunc::empty*/)
 	{
-		PushEditorScopeOnStack scope;
+		BuildFieldsLayout(layout, MakeFieldsLayout(fields), context, path, onChangeCompleted, onChanged);
+	}
 
-		Vector<const FieldInfo*> regularFields = fields.FindAll(
-			[&](const FieldInfo* x) { return IsPropertyVisible(x, false); });
+	void Properties::BuildFieldsLayout(VerticalLayout* layout, const FieldsLayout& fieldsLayout,
+									   PropertiesContext& context, const String& path,
+									   const IPropertyField::OnChangeCompletedFunc& onChangeCompleted,
+									   const IPropertyField::OnChangedFunc& onChanged)
+	{
+		PushEditorScopeOnStack scope;
 
-		BuildFields(layout, regularFields, context, path, onChangeCompleted, onChanged);
+		BuildFields(layout, fieldsLayout.regularFields, context, path, onChangeCompleted, onChanged);
 
 		if (mPrivateVisible)
 		{
-			Vector<const FieldInfo*> privateFields = fields.FindAll(
-				[&](const FieldInfo* x) { return IsPropertyVisible(x, true) && !regularFields.Contains(x); });
+			const Vector<const FieldInfo*>& privateFields = fieldsLayout.privateFields;
 
 			if (!privateFields.IsEmpty())
 			{
@@ -295,6 +300,38 @@ namespace Editor
 		context.builtWithPrivateProperties = mPrivateVisible;
 	}
 
+	const Properties::FieldsLayout& Properties::GetFieldsLayout(const Type* type)
+	{
+		auto fnd = mFieldsLayoutsCache.find(type);
+		if (fnd != mFieldsLayoutsCache.end())
+			return fnd->second;
+
+		return mFieldsLayoutsCache[type] = MakeFieldsLayout(type->GetFieldsWithBaseClasses());
+	}
+
+	Properties::FieldsLayout Properties::MakeFieldsLayout(const Vector<const FieldInfo*>& fields) const
+	{
+		FieldsLayout res;
+		for (auto fieldInfo : fields)
+		{
+			if (IsPropertyVisible(fieldInfo, false))
+				res.regularFields.Add(fieldInfo);
+			else if (IsPropertyVisible(fieldInfo, true))
+				res.privateFields.Add(fieldInfo);
+		}
+
+		return res;
+	}
+
+	const String& Properties::GetFieldCaption(const FieldInfo* fieldInfo)
+	{
+		auto fnd = mFieldsCaptionsCache.find(fieldInfo);
+		if (fnd != mFieldsCaptionsCache.end())
+			return fnd->second;
+
+		return mFieldsCaptionsCache[fieldInfo] = MakeSmartFieldName(fieldInfo->GetName());
+	}
+
 	IPropertyField* Properties::CreateFieldProperty(const Type* type, const String& name, 
 													const IPropertyField::OnChangeCompletedFunc& onChangeCompleted /*= mOnPropertyCompletedChangingUndoCreateDelegate*/,
 													const IPropertyField::OnChangedFunc& onChanged /*= IPropertyField::OnChangedFunc::empty*/)
@@ -348,11 +385,8 @@ namespace Editor
 		if (!fieldPropertyType)
 			return nullptr;
 
-		IPropertyField* fieldProperty = nullptr;
-
-		if (mPropertiesPool.ContainsKey(type) && mPropertiesPool[type].Count() > 0)
-			fieldProperty = mPropertiesPool[type].PopBack();
-		else
+		IPropertyField* fieldProperty = TakePooledProperty(fieldPropertyType);
+		if (!fieldProperty)
 			fieldProperty = dynamic_cast<IPropertyField*>(o2UI.CreateWidget(*fieldPropertyType, "with caption"));
 
 		fieldProperty->onChanged = onChanged;
@@ -366,11 +400,8 @@ namespace Editor
 												const IPropertyField::OnChangeCompletedFunc& onChangeCompleted /*= mOnPropertyCompletedChangingUndoCreateDelegate*/, 
 												const IPropertyField::OnChangedFunc& onChanged /*= IPropertyField::OnChangedFunc::empty*/)
 	{
-		EnumProperty* fieldProperty = nullptr;
-
-		if (mPropertiesPool.ContainsKey(type) && mPropertiesPool[type].Count() > 0)
-			fieldProperty = dynamic_cast<EnumProperty*>(mPropertiesPool[type].PopBack());
-		else
+		EnumProperty* fieldProperty = dynamic_cast<EnumProperty*>(TakePooledProperty(&TypeOf(EnumProperty)));
+		if (!fieldProperty)
 			fieldProperty = o2UI.CreateWidget<EnumProperty>("with caption");
 
 		fieldProperty->onChanged = onChanged;
@@ -385,12 +416,8 @@ namespace Editor
 												  const IPropertyField::OnChangeCompletedFunc& onChangeCompleted /*= mOnPropertyCompletedChangingUndoCreateDelegate*/,
 												  const IPropertyField::OnChangedFunc& onChanged /*= IPropertyField::OnChangedFunc::empty*/)
 	{
-		ObjectProperty* fieldProperty = nullptr;
-
-		const Type* objectType = &TypeOf(IObject);
-		if (mPropertiesPool.ContainsKey(objectType) && mPropertiesPool[objectType].Count() > 0)
-			fieldProperty = dynamic_cast<ObjectProperty*>(mPropertiesPool[objectType].PopBack());
-		else
+		ObjectProperty* fieldProperty = dynamic_cast<ObjectProperty*>(TakePooledProperty(&TypeOf(ObjectProperty)));
+		if (!fieldProperty)
 			fieldProperty = mnew ObjectProperty();
 
 		fieldProperty->onChanged = onChanged;
@@ -404,12 +431,8 @@ namespace Editor
 													 const IPropertyField::OnChangeCompletedFunc& onChangeCompleted /*= mOnPropertyCompletedChangingUndoCreateDelegate*/,
 													 const IPropertyField::OnChangedFunc& onChanged /*= IPropertyField::OnChangedFunc::empty*/)
 	{
-		ObjectPtrProperty* fieldProperty = nullptr;
-
-		const Type* objectType = &TypeOf(IObject*);
-		if (mPropertiesPool.ContainsKey(objectType) && mPropertiesPool[objectType].Count() > 0)
-			fieldProperty = dynamic_cast<ObjectPtrProperty*>(mPropertiesPool[objectType].PopBack());
-		else
+		ObjectPtrProperty* fieldProperty = dynamic_cast<ObjectPtrProperty*>(TakePooledProperty(&TypeOf(ObjectPtrProperty)));
+		if (!fieldProperty)
 			fieldProperty = mnew ObjectPtrProperty();
 
 		fieldProperty->onChanged = onChanged;
@@ -424,11 +447,8 @@ namespace Editor
 												  const IPropertyField::OnChangeCompletedFunc& onChangeCompleted /*= mOnPropertyCompletedChangingUndoCreateDelegate*/,
 												  const IPropertyField::OnChangedFunc& onChanged /*= IPropertyField::OnChangedFunc::empty*/)
 	{
-		VectorProperty* fieldProperty = nullptr;
-
-		if (mPropertiesPool.ContainsKey(type) && mPropertiesPool[type].Count() > 0)
-			fieldProperty = dynamic_cast<VectorProperty*>(mPropertiesPool[type].PopBack());
-		else 
+		VectorProperty* fieldProperty = dynamic_cast<VectorProperty*>(TakePooledProperty(type));
+		if (!fieldProperty)
 			fieldProperty = mnew VectorProperty();
 
 		fieldProperty->onChanged = onChanged;
@@ -544,17 +564,29 @@ namespace Editor
 
 	const Type* Properties::GetFieldPropertyType(const Type* valueType) const
 	{
-		for (auto kv : mAvailablePropertiesFields)
+		auto fnd = mFieldPropertyTypesCache.find(valueType);
+		if (fnd != mFieldPropertyTypesCache.end())
+			return fnd->second;
+
+		const Type* res = nullptr;
+		for (auto& kv : mAvailablePropertiesFields)
 		{
 			if (valueType->GetUsage() == Type::Usage::Pointer && kv.first->GetUsage() == Type::Usage::Pointer)
 			{
 				if (((PointerType*)valueType)->GetUnpointedType()->IsBasedOn(*((PointerType*)kv.first)->GetUnpointedType()))
-					return kv.second;
+				{
+					res = kv.second;
+					break;
+				}
 			}
 			else if (valueType->IsBasedOn(*kv.first))
-				return kv.second;
+			{
+				res = kv.second;
+				break;
+			}
 		}
 
-		return nullptr;
+		mFieldPropertyTypesCache[valueType] = res;
+		return res;
 	}
 }
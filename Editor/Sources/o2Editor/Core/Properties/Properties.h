@@ -46,7 +46,7 @@ namespace Editor
 		// Free properties and put in cache
 		void FreeProperties(PropertiesContext& context);
 
-		// Free property field and put in cache
+		// Free property field and put in cache. Field is reset and waits in pool of its pool type to be rebound to new values
 		void FreeProperty(IPropertyField* field);
 
 		// Builds layout viewer by type for objects
@@ -151,15 +151,32 @@ namespace Editor
 		typedef Map<const Type*, const Type*> IObjectPropertiesViewersMap;
 		typedef Map<const Type*, Vector<IObjectPropertiesViewer*>> TypeObjectPropertiesViewerMap;
 
+		// ------------------------------------------------------------------------------
+		// Object type visible fields, split into regular and private. Cached by type and
+		// reused on each building, so building doesn't filter type fields again
+		// ------------------------------------------------------------------------------
+		struct FieldsLayout
+		{
+			Vector<const FieldInfo*> regularFields; // Fields visible always
+			Vector<const FieldInfo*> privateFields; // Fields visible only when private fields are visible
+		};
+
+		typedef Map<const Type*, FieldsLayout> TypeFieldsLayoutMap;
+		typedef Map<const FieldInfo*, String> FieldsCaptionsMap;
+
 		int  mPropertyFieldsPoolStep = 5; // Field properties pools resize step						    
 		bool mPrivateVisible = false;     // Is private fields visible
 
 		PropertiesFieldsMap         mAvailablePropertiesFields;        // Available properties fields samples
 		IObjectPropertiesViewersMap mAvailableObjectPropertiesViewers; // Available object properties viewers samples
 
-		TypePropertyMap               mPropertiesPool;              // Pool of properties, grouped by property type
+		TypePropertyMap               mPropertiesPool;              // Pool of properties, grouped by property pool type
 		TypeObjectPropertiesViewerMap mObjectPropertiesViewersPool; // Pool of object properties viewers, grouped by object type
 
+		TypeFieldsLayoutMap         mFieldsLayoutsCache;      // Cached fields layouts by object type
+		FieldsCaptionsMap           mFieldsCaptionsCache;     // Cached smart captions of fields
+		mutable PropertiesFieldsMap mFieldPropertyTypesCache; // Cached property fields types by value type, null when not supported
+
 		static IPropertyField::OnChangeCompletedFunc mOnPropertyCompletedChangingUndoCreateDelegate;
 
 	protected:
@@ -176,6 +193,23 @@ namespace Editor
 		void BuildFields(VerticalLayout* layout, Vector<const FieldInfo*> fields, PropertiesContext& context, const String& path,
 						 const IPropertyField::OnChangeCompletedFunc& onChangeCompleted = mOnPropertyCompletedChangingUndoCreateDelegate,
 						 const IPropertyField::OnChangedFunc& onChanged = IPropertyField::OnChangedFunc::empty);
+
+		// Builds layout viewer by regular and private fields of fields layout
+		void BuildFieldsLayout(VerticalLayout* layout, const FieldsLayout& fieldsLayout, PropertiesContext& context, const String& path,
+							   const IPropertyField::OnChangeCompletedFunc& onChangeCompleted,
+							   const IPropertyField::OnChangedFunc& onChanged);
+
+		// Returns cached fields layout of type. Layout is built on first request
+		const FieldsLayout& GetFieldsLayout(const Type* type);
+
+		// Splits visible fields into regular and private
+		FieldsLayout MakeFieldsLayout(const Vector<const FieldInfo*>& fields) const;
+
+		// Returns cached smart caption of field
+		const String& GetFieldCaption(const FieldInfo* fieldInfo);
+
+		// Takes field from pool of pool type. Returns null when pool is empty
+		IPropertyField* TakePooledProperty(const Type* poolType);
 	};
 
 	template<typename PropertyFieldType>
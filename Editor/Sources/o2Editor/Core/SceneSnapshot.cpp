@@ -0,0 +1,234 @@
+#include "o2Editor/stdafx.h"
+#include "SceneSnapshot.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Scene.h"
+#include "o2/Scene/SceneLayer.h"
+#include "o2/Scene/Tags.h"
+#include "o2/Utils/Editor/SceneEditableObject.h"
+
+namespace Editor
+{
+	SceneSnapshot::~SceneSnapshot()
+	{
+		Clear();
+	}
+
+	void SceneSnapshot::Capture()
+	{
+		Clear();
+
+		for (auto layer : o2Scene.GetLayers())
+		{
+			LayerData layerData;
+			layerData.name = layer->GetName();
+			layerData.visible = layer->visible;
+			mLayers.Add(layerData);
+		}
+
+		mDefaultLayer = o2Scene.GetDefaultLayer()->GetName();
+
+		for (auto tag : o2Scene.GetTags())
+			mTags.Add(tag->GetName());
+
+		for (auto actor : o2Scene.GetRootActors())
+		{
+			auto actorData = mnew ActorData();
+			actorData->id = actor->GetID();
+			actorData->typeName = actor->GetType().GetName();
+			actor->Serialize(actorData->data);
+
+			mActors.Add(actorData);
+		}
+
+		mIsCaptured = true;
+	}
+
+	int SceneSnapshot::Restore()
+	{
+		if (!mIsCaptured)
+			return 0;
+
+		// Layers are restored before actors, so actors moved out of removed layers are restored by their data
+		bool layersAndTagsChanged = RestoreLayersAndTags();
+
+		Map<SceneUID, Actor*> rootActorsById;
+		for (auto actor : o2Scene.GetRootActors())
+			rootActorsById[actor->GetID()] = actor;
+
+		Map<Actor*, int> actorsOrder;
+		int reloadedCount = 0;
+
+		for (int i = 0; i < mActors.Count(); i++)
+		{
+			auto actorData = mActors[i];
+
+			Actor* actor = nullptr;
+			rootActorsById.TryGetValue(actorData->id, actor);
+
+			if (actor && actor->GetType().GetName() == actorData->typeName)
+			{
+				if (RestoreActor(actor, actorData))
+					reloadedCount++;
+
+				actorsOrder[actor] = i;
+			}
+			else if (Actor* createdActor = CreateActor(actorData))
+			{
+				actorsOrder[createdActor] = i;
+				reloadedCount++;
+			}
+		}
+
+		// Removing actors created while playing
+		auto rootActors = o2Scene.GetRootActors();
+		for (auto actor : rootActors)
+		{
+			if (!actorsOrder.ContainsKey(actor))
+			{
+				delete dynamic_cast<SceneEditableObject*>(actor);
+				reloadedCount++;
+			}
+		}
+
+		// Restoring hierarchy order of kept and recreated actors
+		const Map<Actor*, int>& constActorsOrder = actorsOrder;
+		o2Scene.GetRootActors().SortBy<int>([&](Actor* x) { return constActorsOrder.Get(x); });
+
+		if (reloadedCount > 0 || layersAndTagsChanged)
+			o2Scene.OnObjectChanged(nullptr);
+
+		return reloadedCount;
+	}
+
+	void SceneSnapshot::Clear()
+	{
+		for (auto actorData : mActors)
+			delete actorData;
+
+		mActors.Clear();
+		mLayers.Clear();
+		mDefaultLayer.Clear();
+		mTags.Clear();
+		mIsCaptured = false;
+	}
+
+	bool SceneSnapshot::IsEmpty() const
+	{
+		return !mIsCaptured;
+	}
+
+	bool SceneSnapshot::RestoreLayersAndTags()
+	{
+		Scene& scene = o2Scene;
+		bool changed = false;
+
+		// Default layer can't be removed, so it keeps its object and gets captured name
+		SceneLayer* defaultLayer = scene.GetDefaultLayer();
+		if (defaultLayer->GetName() != mDefaultLayer)
+		{
+			if (scene.HasLayer(mDefaultLayer))
+				RemoveLayer(scene.GetLayer(mDefaultLayer));
+
+			defaultLayer->SetName(mDefaultLayer);
+			changed = true;
+		}
+
+		for (int i = 0; i < mLayers.Count(); i++)
+		{
+			const LayerData& layerData = mLayers[i];
+
+			if (!scene.HasLayer(layerData.name))
+				changed = true;
+
+			SceneLayer* layer = scene.AddLayer(layerData.name);
+
+			if (layer->visible != layerData.visible)
+			{
+				layer->visible = layerData.visible;
+				changed = true;
+			}
+
+			if (scene.GetLayers().IndexOf(layer) != i)
+			{
+				scene.SetLayerOrder(layer, i);
+				changed = true;
+			}
+		}
+
+		// Captured layers are placed first, the rest were created while playing
+		auto layers = scene.GetLayers();
+		for (int i = mLayers.Count(); i < layers.Count(); i++)
+		{
+			RemoveLayer(layers[i]);
+			changed = true;
+		}
+
+		for (auto& tagName : mTags)
+		{
+			if (!scene.GetTag(tagName))
+			{
+				scene.AddTag(tagName);
+				changed = true;
+			}
+		}
+
+		auto tags = scene.GetTags();
+		for (auto tag : tags)
+		{
+			if (!mTags.Contains(tag->GetName()))
+			{
+				scene.RemoveTag(tag);
+				changed = true;
+			}
+		}
+
+		if (changed)
+			scene.onLayersListChanged();
+
+		return changed;
+	}
+
+	void SceneSnapshot::RemoveLayer(SceneLayer* layer)
+	{
+		auto actors = layer->GetActors();
+		for (auto actor : actors)
+			actor->SetLayer(o2Scene.GetDefaultLayer()->GetName());
+
+		o2Scene.RemoveLayer(layer, false);
+	}
+
+	bool SceneSnapshot::RestoreActor(Actor* actor, ActorData* actorData)
+	{
+		DataDocument currentData;
+		actor->Serialize(currentData);
+
+		if (currentData == actorData->data)
+			return false;
+
+		actor->Deserialize(actorData->data);
+		o2Scene.OnObjectChanged(actor);
+
+		return true;
+	}
+
+	Actor* SceneSnapshot::CreateActor(ActorData* actorData)
+	{
+		const ObjectType* type = dynamic_cast<const ObjectType*>(o2Reflection.GetType(actorData->typeName));
+		if (!type)
+			return nullptr;
+
+		// Actor is created out of scene and added immediately, otherwise it would be appended to root actors on next frame
+		ActorCreateMode lastCreationMode = Actor::GetDefaultCreationMode();
+		Actor::SetDefaultCreationMode(ActorCreateMode::NotInScene);
+
+		Actor* actor = dynamic_cast<Actor*>(type->DynamicCastToIObject(type->CreateSample()));
+		actor->Deserialize(actorData->data);
+
+		Actor::SetDefaultCreationMode(lastCreationMode);
+
+		actor->AddToScene();
+
+		return actor;
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "o2/Utils/Serialization/DataValue.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+using namespace o2;
+
+namespace o2
+{
+	class Actor;
+	class SceneLayer;
+}
+
+namespace Editor
+{
+	// ------------------------------------------------------------------------------------------
+	// Scene state snapshot. Stores layers, tags and each root actor data separately, so restoring
+	// reloads only root actors that were changed, created or destroyed since capture. Unchanged
+	// actors are kept as is with all references on them. Layers and tags are restored by changes
+	// too: missing ones are added back, new ones are removed
+	// ------------------------------------------------------------------------------------------
+	class SceneSnapshot
+	{
+	public:
+		// Destructor
+		~SceneSnapshot();
+
+		// Captures current scene state
+		void Capture();
+
+		// Restores captured scene state. Returns count of reloaded root actors
+		int Restore();
+
+		// Removes captured data
+		void Clear();
+
+		// Returns is snapshot empty
+		bool IsEmpty() const;
+
+	protected:
+		struct LayerData
+		{
+			String name;           // Layer name
+			bool   visible = true; // Is layer visible in editor
+		};
+
+		struct ActorData
+		{
+			SceneUID     id;       // Root actor id
+			String       typeName; // Actor type name
+			DataDocument data;     // Serialized actor data
+		};
+
+	protected:
+		Vector<LayerData>  mLayers;             // Layers data in scene order
+		String             mDefaultLayer;       // Default layer name
+		Vector<String>     mTags;               // Tags names
+		Vector<ActorData*> mActors;             // Root actors data in hierarchy order
+		bool               mIsCaptured = false; // Is snapshot captured
+
+	protected:
+		// Restores captured layers and tags, keeping not changed ones. Returns true when something was changed
+		bool RestoreLayersAndTags();
+
+		// Moves layer actors into default layer and removes layer
+		void RemoveLayer(SceneLayer* layer);
+
+		// Restores alive root actor from data when it was changed. Returns true when actor was reloaded
+		bool RestoreActor(Actor* actor, ActorData* actorData);
+
+		// Creates root actor from data and adds it to scene immediately, so it can be placed in hierarchy order
+		Actor* CreateActor(ActorData* actorData);
+	};
+}
@@ -575,6 +575,8 @@ namespace Editor
 			mTextRight->Draw();
 		}
 
+		o2Render.BeginAALinesBatch();
+
 		// Y
 		if (horGridEnabled)
 		{
@@ -610,6 +612,8 @@ namespace Editor
 			}
 		}
 
+		o2Render.EndAALinesBatch();
+
 		if (unknownScale)
 			return;
 
@@ -672,30 +676,36 @@ namespace Editor
 
 		Basis transform = mViewCamera.GetBasis().Inverted()*Camera().GetBasis();
 
+		o2Render.BeginAALinesBatch();
+
 		for (auto curve : mCurves)
 		{
 			if (curve->approximatedPoints.IsEmpty())
 				continue;
 
-			//o2Render.DrawLine(curve->approximatedPoints, curve->color);
-
 			float cameraLeftPos = mViewCamera.GetRect().left;
 			float cameraRightPos = mViewCamera.GetRect().right;
-			for (int i = 1; i < curve->approximatedPoints.Count(); i++)
-			{
-				Vec2F& a = curve->approximatedPoints[i - 1];
-				Vec2F& b = curve->approximatedPoints[i];
 
-				if (b.x < cameraLeftPos)
-					continue;
+			// Visible part of curve is drawn as one poly line, render merges segments shorter than pixel
+			const Vector<Vec2F>& points = curve->approximatedPoints;
 
-				if (a.x > cameraRightPos)
-					break;
+			int begin = 0;
+			while (begin < points.Count() - 1 && points[begin + 1].x < cameraLeftPos)
+				begin++;
 
-				o2Render.DrawAALine(a*transform, b*transform, curve->color);
-			}
+			int end = begin + 1;
+			while (end < points.Count() && points[end - 1].x <= cameraRightPos)
+				end++;
+
+			mCurveDrawPoints.Clear();
+			for (int i = begin; i < end; i++)
+				mCurveDrawPoints.Add(points[i]*transform);
+
+			o2Render.DrawAALine(mCurveDrawPoints, curve->color);
 		}
 
+		o2Render.EndAALinesBatch();
+
 		o2Render.camera = mViewCamera;
 	}
 
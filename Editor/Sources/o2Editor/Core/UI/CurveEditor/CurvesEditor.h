@@ -247,6 +247,8 @@ namespace Editor
 							    								    
 		Vector<CurveInfo*> mCurves; // Editing curves infos list 
 		Vector<RangeInfo*> mRanges; // Curves ranges list
+
+		Vector<Vec2F> mCurveDrawPoints; // Visible curve points in screen space, buffer for curves drawing
 							    								    
 		Vector<CurveHandle*>       mSupportHandles;      // Support points handles list
 		SelectableDragHandlesGroup mSupportHandlesGroup; // Support points handles selection group. They are must be selectable separately from main handles
@@ -469,6 +471,7 @@ CLASS_FIELDS_META(Editor::CurvesEditor)
 	PROTECTED_FIELD(mHandleSamplesStubInfo);
 	PROTECTED_FIELD(mCurves);
 	PROTECTED_FIELD(mRanges);
+	PROTECTED_FIELD(mCurveDrawPoints);
 	PROTECTED_FIELD(mSupportHandles);
 	PROTECTED_FIELD(mSupportHandlesGroup);
 	PROTECTED_FIELD(mSelectingHandlesBuf);
@@ -4607,17 +4607,12 @@ namespace Editor
 		String thisSourcePath = "o2/Editor/Sources/o2Editor/Core/UIStyle/EditorUIStyle.cpp";
 		TimeStamp thisSourceEditedDate = o2FileSystem.GetFileInfo(thisSourcePath).editDate;
 
-		DataDocument stylesData;
-		if (stylesData.LoadFromFile(GetEditorAssetsPath() + stylesFileName))
-		{
-			TimeStamp cachedDate = stylesData["generatedDate"];
+		// Styles snapshot is tagged with this source edit date, it is rebuilt when styles code changes
+		DataDocument snapshotTag;
+		snapshotTag = thisSourceEditedDate;
 
-			if (thisSourceEditedDate == cachedDate && checkEditedDate)
-			{
-				o2UI.LoadStyle(stylesData["styles"]);
-				return;
-			}
-		}
+		if (checkEditedDate && o2UI.LoadStyleSnapshot(GetEditorAssetsPath() + stylesFileName, snapshotTag))
+			return;
 
 		o2UI.ClearStyle();
 
@@ -4640,12 +4635,7 @@ namespace Editor
 		}
 
 		if (saveStyle)
-		{
-			DataDocument newStylesData;
-			o2UI.SaveStyle(newStylesData["styles"]);
-			newStylesData["generatedDate"] = thisSourceEditedDate;
-			newStylesData.SaveToFile(GetEditorAssetsPath() + stylesFileName);
-		}
+			o2UI.SaveStyleSnapshot(GetEditorAssetsPath() + stylesFileName, snapshotTag);
 	}
 }
 
@@ -95,7 +95,7 @@ namespace Editor
 			o2Render.EnableScissorTest(mAbsoluteClipArea);
 
 			for (auto child : mDrawingChildren)
-				child->Draw();
+				child->DrawWithCache();
 
 			o2Render.DisableScissorTest();
 
@@ -112,7 +112,7 @@ namespace Editor
 			CursorAreaEventsListener::OnDrawn();
 
 			for (auto child : mInternalWidgets)
-				child->Draw();
+				child->DrawWithCache();
 
 			for (auto layer : mTopDrawingLayers)
 				layer->Draw();
@@ -159,6 +159,8 @@ namespace Editor
 			return;
 		}
 
+		UpdateTargetActorsVersions();
+
 		for (auto viewer : mComponentsViewers)
 			viewer->Refresh();
 
@@ -169,16 +171,36 @@ namespace Editor
 		mHeaderViewer->Refresh();
 	}
 
-	void ActorViewer::OnSceneObjectsChanged(const Vector<SceneEditableObject*>& objects)
+	bool ActorViewer::IsTrackingChanges() const
 	{
+		return true;
+	}
+
+	void ActorViewer::RefreshChanged()
+	{
+		PushEditorScopeOnStack scope;
+
+		if (mTargetActors.IsEmpty())
+			return;
+
+		// Only changes notified to actors are tracked here, the rest is caught by properties window timed refresh
+		if (!UpdateTargetActorsVersions())
+			return;
+
 		Refresh();
 	}
 
+	void ActorViewer::OnSceneObjectsChanged(const Vector<SceneEditableObject*>& objects)
+	{
+		RefreshChanged();
+	}
+
     void ActorViewer::SetTargets(const Vector<IObject *> &targets)
 	{
 		PushEditorScopeOnStack scope;
 
 		mTargetActors = targets.Convert<Actor*>([](auto x) { return dynamic_cast<Actor*>(x); });
+		mTargetActorsVersions.Clear();
 
 		// clear 
 		mViewersLayout->RemoveAllChildren(false);
@@ -266,6 +288,24 @@ namespace Editor
 		return commonComponentsTypes;
 	}
 
+	bool ActorViewer::UpdateTargetActorsVersions()
+	{
+		bool changed = mTargetActorsVersions.Count() != mTargetActors.Count();
+		mTargetActorsVersions.Resize(mTargetActors.Count());
+
+		for (int i = 0; i < mTargetActors.Count(); i++)
+		{
+			UInt version = mTargetActors[i]->GetChangesVersion();
+			if (mTargetActorsVersions[i] != version)
+			{
+				mTargetActorsVersions[i] = version;
+				changed = true;
+			}
+		}
+
+		return changed;
+	}
+
     void ActorViewer::SetTargetsComponents(const Vector<IObject*> &targets, Vector<Widget*>& viewersWidgets)
 	{
 		PushEditorScopeOnStack scope;
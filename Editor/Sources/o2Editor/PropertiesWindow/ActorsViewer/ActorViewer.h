@@ -52,13 +52,20 @@ namespace Editor
 		// Updates properties values
 		void Refresh() override;
 
+		// Returns true, actor viewer tracks actors changes versions
+		bool IsTrackingChanges() const override;
+
+		// Updates properties values of changed actors and components
+		void RefreshChanged() override;
+
 		IOBJECT(ActorViewer);
 
 	protected:
 		typedef Map<const Type*, Vector<IActorComponentViewer*>> TypeCompViewersMap;
 		typedef Map<const Type*, IActorPropertiesViewer*> TypeActorViewersmap;
 
-		Vector<Actor*> mTargetActors; // Current target actors
+		Vector<Actor*> mTargetActors;         // Current target actors
+		Vector<UInt>   mTargetActorsVersions; // Changes versions of target actors at last refresh
 									    
 		IActorHeaderViewer*    mHeaderViewer = nullptr;    // Actor header viewer
 		IActorTransformViewer* mTransformViewer = nullptr; // Actor transform viewer
@@ -94,6 +101,9 @@ namespace Editor
 		// Returns list of common components types for targets
         Vector<const Type*> GetCommonComponentsTypes(const Vector<IObject *> &targets) const;
 
+		// Stores target actors changes versions. Returns true when some of actors changed since previous call
+		bool UpdateTargetActorsVersions();
+
 		// Enable viewer event function
 		void OnEnabled() override;
 
@@ -113,6 +123,7 @@ END_META;
 CLASS_FIELDS_META(Editor::ActorViewer)
 {
 	PROTECTED_FIELD(mTargetActors);
+	PROTECTED_FIELD(mTargetActorsVersions);
 	PROTECTED_FIELD(mHeaderViewer).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(mTransformViewer).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(mActorPropertiesViewer).DEFAULT_VALUE(nullptr);
@@ -137,11 +148,14 @@ CLASS_METHODS_META(Editor::ActorViewer)
 	PUBLIC_FUNCTION(void, AddComponentViewerType, IActorComponentViewer*);
 	PUBLIC_FUNCTION(void, AddActorPropertiesViewerType, IActorPropertiesViewer*);
 	PUBLIC_FUNCTION(void, Refresh);
+	PUBLIC_FUNCTION(bool, IsTrackingChanges);
+	PUBLIC_FUNCTION(void, RefreshChanged);
 	PROTECTED_FUNCTION(void, OnSceneObjectsChanged, const Vector<SceneEditableObject*>&);
     PROTECTED_FUNCTION(void, SetTargets, const Vector<IObject*>&);
     PROTECTED_FUNCTION(void, SetTargetsActorProperties, const Vector<IObject*>&, Vector<Widget*>&);
     PROTECTED_FUNCTION(void, SetTargetsComponents, const Vector<IObject*>&, Vector<Widget*>&);
     PROTECTED_FUNCTION(Vector<const Type*>, GetCommonComponentsTypes, const Vector<IObject*>&);
+	PROTECTED_FUNCTION(bool, UpdateTargetActorsVersions);
 	PROTECTED_FUNCTION(void, OnEnabled);
 	PROTECTED_FUNCTION(void, OnDisabled);
 }
@@ -18,6 +18,16 @@ namespace Editor
 
 	void IPropertiesViewer::Refresh()
 	{}
+
+	bool IPropertiesViewer::IsTrackingChanges() const
+	{
+		return false;
+	}
+
+	void IPropertiesViewer::RefreshChanged()
+	{
+		Refresh();
+	}
 }
 
 DECLARE_CLASS(Editor::IPropertiesViewer);
@@ -28,6 +28,13 @@ namespace Editor
 		// Refreshes viewing properties
 		virtual void Refresh();
 
+		// Returns true when viewer tracks targets changes versions. Such viewers are refreshed with RefreshChanged()
+		// every frame and with Refresh() by timer, others are refreshed with Refresh() by timer only
+		virtual bool IsTrackingChanges() const;
+
+		// Refreshes properties of targets changed since last refresh
+		virtual void RefreshChanged();
+
 		IOBJECT(IPropertiesViewer);
 
 	protected:
@@ -68,6 +75,8 @@ CLASS_METHODS_META(Editor::IPropertiesViewer)
 
 	PUBLIC_FUNCTION(const Type*, GetViewingObjectType);
 	PUBLIC_FUNCTION(void, Refresh);
+	PUBLIC_FUNCTION(bool, IsTrackingChanges);
+	PUBLIC_FUNCTION(void, RefreshChanged);
     PROTECTED_FUNCTION(void, SetTargets, const Vector<IObject*>&);
 	PROTECTED_FUNCTION(void, OnEnabled);
 	PROTECTED_FUNCTION(void, OnDisabled);
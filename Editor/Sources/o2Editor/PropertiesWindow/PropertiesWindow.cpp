@@ -138,16 +138,21 @@ namespace Editor
 
 	void PropertiesWindow::Update(float dt)
 	{
+		if (!mCurrentViewer)
+			return;
+
+		if (mCurrentViewer->IsTrackingChanges())
+			mCurrentViewer->RefreshChanged();
+
+		// Tracking viewers are refreshed by timer too with same delay: components changes aren't notified
 		mRefreshRemainingTime -= dt;
 		if (mRefreshRemainingTime < 0.0f)
 		{
 			mRefreshRemainingTime = mRefreshDelay;
-			if (mCurrentViewer)
-				mCurrentViewer->Refresh();
+			mCurrentViewer->Refresh();
 		}
 
-		if (mCurrentViewer)
-			mCurrentViewer->Update(dt);
+		mCurrentViewer->Update(dt);
 	}
 
 	void PropertiesWindow::Draw()
@@ -269,8 +269,8 @@ namespace Editor
 
 				for (auto object : assetsScroll->mInstantiatedSceneDragObjects)
 				{
-					int idx = mAllNodes.IndexOf([=](Node* x) { return x->object == object; });
-					CreateVisibleNodeWidget(mAllNodes[idx], idx);
+					Node* node = FindNode(object);
+					CreateVisibleNodeWidget(node, IndexOfNode(node));
 				}
 
 				Focus();
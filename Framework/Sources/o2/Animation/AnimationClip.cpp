@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "AnimationClip.h"
 
+#include "o2/Animation/Tracks/AnimationFloatTrack.h"
 #include "o2/Animation/Tracks/AnimationTrack.h"
 #include "o2/Scene/Components/AnimationComponent.h"
 #include "o2/Utils/Basic/IObject.h"
@@ -58,6 +59,7 @@ namespace o2
 		}
 
 		mTracks.Clear();
+		mTracksBatchDirty = true;
 	}
 
 	float AnimationClip::GetDuration() const
@@ -126,6 +128,7 @@ namespace o2
 
 				delete track;
 				mTracks.Remove(track);
+				mTracksBatchDirty = true;
 
 				onChanged();
 				return;
@@ -133,8 +136,29 @@ namespace o2
 		}
 	}
 
+	const AnimationTracksBatch& AnimationClip::GetTracksBatch() const
+	{
+		if (mTracksBatchDirty)
+		{
+			mTracksBatch.Compile(mTracks);
+			mTracksBatchDirty = false;
+		}
+
+		return mTracksBatch;
+	}
+
+	void AnimationClip::Bake(float sampleRate /*= 30.0f*/, float tolerance /*= 0.001f*/, bool keepCurves /*= true*/)
+	{
+		for (auto track : mTracks)
+		{
+			if (auto floatTrack = dynamic_cast<AnimationTrack<float>*>(track))
+				floatTrack->Bake(sampleRate, tolerance, keepCurves);
+		}
+	}
+
 	void AnimationClip::OnTrackChanged()
 	{
+		mTracksBatchDirty = true;
 		RecalculateDuration();
 
 		onChanged();
@@ -163,6 +187,7 @@ namespace o2
 	void AnimationClip::OnTrackAdded(IAnimationTrack* track)
 	{
 		track->onKeysChanged += THIS_FUNC(OnTrackChanged);
+		mTracksBatchDirty = true;
 
 		onTrackAdded(track);
 		onChanged();
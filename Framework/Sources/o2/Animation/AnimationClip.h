@@ -1,4 +1,5 @@
 #pragma once
+#include "o2/Animation/AnimationTracksBatch.h"
 #include "o2/Utils/Serialization/Serializable.h"
 
 namespace o2
@@ -73,6 +74,12 @@ namespace o2
 		// Removes Animation track by path
 		void RemoveTrack(const String& path);
 
+		// Returns float tracks compiled for batched sampling. Compiles them when tracks or keys were changed
+		const AnimationTracksBatch& GetTracksBatch() const;
+
+		// Bakes all float tracks into uniform rate samples. See AnimationTrack<float>::Bake
+		void Bake(float sampleRate = 30.0f, float tolerance = 0.001f, bool keepCurves = true);
+
 		//insert animation
 
 		// Returns parametric specified animation
@@ -116,6 +123,9 @@ namespace o2
 		float mDuration = 0.0f;   // Animation duration @SERIALIZABLE
 		Loop  mLoop = Loop::None; // Animation loop type @SERIALIZABLE
 
+		mutable AnimationTracksBatch mTracksBatch;             // Compiled float tracks
+		mutable bool                 mTracksBatchDirty = true; // Is tracks changed and batch must be compiled again
+
 	protected:
 		// Returns Animation track by path
 		template<typename _type>
@@ -245,6 +255,8 @@ CLASS_FIELDS_META(o2::AnimationClip)
 	PROTECTED_FIELD(mTracks).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mDuration).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mLoop).DEFAULT_VALUE(Loop::None).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mTracksBatch);
+	PROTECTED_FIELD(mTracksBatchDirty).DEFAULT_VALUE(true);
 }
 END_META;
 CLASS_METHODS_META(o2::AnimationClip)
@@ -259,6 +271,8 @@ CLASS_METHODS_META(o2::AnimationClip)
 	PUBLIC_FUNCTION(bool, ContainsTrack, const String&);
 	PUBLIC_FUNCTION(IAnimationTrack*, AddTrack, const String&, const Type&);
 	PUBLIC_FUNCTION(void, RemoveTrack, const String&);
+	PUBLIC_FUNCTION(const AnimationTracksBatch&, GetTracksBatch);
+	PUBLIC_FUNCTION(void, Bake, float, float, bool);
 	PROTECTED_FUNCTION(void, OnTrackChanged);
 	PROTECTED_FUNCTION(void, RecalculateDuration);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
@@ -1,6 +1,10 @@
 #include "o2/stdafx.h"
 #include "AnimationPlayer.h"
 
+#include "o2/Animation/AnimationClip.h"
+#include "o2/Animation/Tracks/AnimationFloatTrack.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
+
 namespace o2
 {
 	AnimationPlayer::AnimationPlayer(IObject* target /*= nullptr*/, AnimationClip* clip /*= nullptr*/):
@@ -73,6 +77,9 @@ namespace o2
 		}
 
 		mTrackPlayers.Clear();
+		mBatchPlayers.Clear();
+		mBatchVersion = 0;
+		mBatchPending = false;
 
 		if (!mTarget || !mClip)
 			return;
@@ -126,6 +133,10 @@ namespace o2
 	void AnimationPlayer::OnClipTrackRemove(IAnimationTrack* track)
 	{
 		mTrackPlayers.RemoveFirst([track, this](auto& x) { return x->GetTrack() == track; onTrackPlayerRemove(x); });
+
+		mBatchPlayers.Clear();
+		mBatchVersion = 0;
+		mBatchPending = false;
 	}
 
 	void AnimationPlayer::OnClipDurationChanged(float duration)
@@ -136,9 +147,87 @@ namespace o2
 
 	void AnimationPlayer::Evaluate()
 	{
+		if (mClip)
+		{
+			const AnimationTracksBatch& batch = mClip->GetTracksBatch();
+			if (mBatchVersion != batch.GetVersion())
+				BindBatchPlayers(batch);
+
+			// Deferred batch is sampled later together with other players batches
+			if (mDeferBatch)
+				mBatchPending = true;
+			else
+			{
+				SampleBatch();
+				ApplyBatch();
+			}
+		}
+
+		// Batch players values are already assigned, here they update only time and events as others
 		for (auto trackPlayer : mTrackPlayers)
 			trackPlayer->ForceSetTime(mInDurationTime, mDuration);
 	}
+
+	void AnimationPlayer::BindBatchPlayers(const AnimationTracksBatch& batch)
+	{
+		int tracksCount = batch.GetTracksCount();
+
+		HashMap<IAnimationTrack*, int> tracksIndices;
+		tracksIndices.Reserve(tracksCount);
+		for (int i = 0; i < tracksCount; i++)
+			tracksIndices[batch.GetTrack(i)] = i;
+
+		mBatchPlayers.Resize(tracksCount);
+		for (int i = 0; i < tracksCount; i++)
+			mBatchPlayers[i] = nullptr;
+
+		for (auto trackPlayer : mTrackPlayers)
+		{
+			int idx = -1;
+			if (tracksIndices.TryGetValue(trackPlayer->GetTrack(), idx))
+			{
+				mBatchPlayers[idx] = trackPlayer;
+				static_cast<AnimationTrack<float>::Player*>(trackPlayer)->mEvaluatedByBatch = true;
+			}
+		}
+
+		mBatchCursors.Resize(tracksCount);
+		for (int i = 0; i < tracksCount; i++)
+			mBatchCursors[i] = 0;
+
+		mBatchValues.Resize(tracksCount);
+		mBatchVersion = batch.GetVersion();
+	}
+
+	void AnimationPlayer::SampleBatch()
+	{
+		// Batch is already compiled on binding, taking it directly, without compilation check
+		if (!mBatchValues.IsEmpty())
+			mClip->mTracksBatch.Sample(mInDurationTime, mBatchCursors.Data(), mBatchValues.Data());
+	}
+
+	void AnimationPlayer::ApplyBatch()
+	{
+		mBatchPending = false;
+
+		for (int i = 0; i < mBatchPlayers.Count(); i++)
+		{
+			auto player = static_cast<AnimationTrack<float>::Player*>(mBatchPlayers[i]);
+			if (!player)
+				continue;
+
+			float value = mBatchValues[i];
+			player->mCurrentValue = value;
+
+			if (player->mTarget)
+			{
+				*player->mTarget = value;
+				player->mTargetDelegate();
+			}
+			else if (player->mTargetProxy)
+				player->mTargetProxy->SetValue(value);
+		}
+	}
 }
 
 DECLARE_CLASS(o2::AnimationPlayer);
@@ -5,6 +5,7 @@
 namespace o2
 {
 	class AnimationClip;
+	class AnimationTracksBatch;
 
 	// ---------------------
 	// Animation clip player
@@ -48,10 +49,27 @@ namespace o2
 
 		Vector<IAnimationTrack::IPlayer*> mTrackPlayers; // Animation clip track players
 
+		Vector<IAnimationTrack::IPlayer*> mBatchPlayers;         // Float tracks players by clip tracks batch indices, sampled by batch
+		Vector<int>                       mBatchCursors;         // Batch sampling keys cursors
+		Vector<float>                     mBatchValues;          // Batch sampled values
+		UInt                              mBatchVersion = 0;     // Version of clip tracks batch which players are bound to
+		bool                              mDeferBatch = false;   // Is batch sampling deferred, used by AnimationComponent::UpdateComponents
+		bool                              mBatchPending = false; // Is batch sampling deferred and not applied yet
+
 	protected:
 		// Evaluates all Animation tracks by time
 		void Evaluate() override;
 
+		// Binds track players to clip tracks batch indices
+		void BindBatchPlayers(const AnimationTracksBatch& batch);
+
+		// Samples clip tracks batch at current time into batch values. Doesn't change anything except batch values,
+		// can be called from worker thread
+		void SampleBatch();
+
+		// Assigns sampled batch values to players and targets
+		void ApplyBatch();
+
 		// Creates clip tracks players and bind to properties from target
 		void BindTracks(bool errors);
 
@@ -86,6 +104,12 @@ CLASS_FIELDS_META(o2::AnimationPlayer)
 	PROTECTED_FIELD(mTarget).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(mAnimationState).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(mTrackPlayers);
+	PROTECTED_FIELD(mBatchPlayers);
+	PROTECTED_FIELD(mBatchCursors);
+	PROTECTED_FIELD(mBatchValues);
+	PROTECTED_FIELD(mBatchVersion).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mDeferBatch).DEFAULT_VALUE(false);
+	PROTECTED_FIELD(mBatchPending).DEFAULT_VALUE(false);
 }
 END_META;
 CLASS_METHODS_META(o2::AnimationPlayer)
@@ -97,6 +121,9 @@ CLASS_METHODS_META(o2::AnimationPlayer)
 	PUBLIC_FUNCTION(AnimationClip*, GetClip);
 	PUBLIC_FUNCTION(const Vector<IAnimationTrack::IPlayer*>&, GetTrackPlayers);
 	PROTECTED_FUNCTION(void, Evaluate);
+	PROTECTED_FUNCTION(void, BindBatchPlayers, const AnimationTracksBatch&);
+	PROTECTED_FUNCTION(void, SampleBatch);
+	PROTECTED_FUNCTION(void, ApplyBatch);
 	PROTECTED_FUNCTION(void, BindTracks, bool);
 	PROTECTED_FUNCTION(void, BindTrack, const ObjectType*, void*, IAnimationTrack*, bool);
 	PROTECTED_FUNCTION(void, OnClipTrackAdded, IAnimationTrack*);
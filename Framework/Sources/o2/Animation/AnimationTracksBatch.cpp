@@ -0,0 +1,164 @@
+#include "o2/stdafx.h"
+#include "AnimationTracksBatch.h"
+
+#include "o2/Animation/Tracks/AnimationFloatTrack.h"
+
+namespace o2
+{
+	UInt AnimationTracksBatch::mVersionsCounter = 0;
+
+	void AnimationTracksBatch::Compile(const Vector<IAnimationTrack*>& tracks)
+	{
+		Clear();
+
+		const int approxCount = Curve::Key::mApproxValuesCount;
+
+		for (auto track : tracks)
+		{
+			auto floatTrack = dynamic_cast<AnimationTrack<float>*>(track);
+			if (!floatTrack)
+				continue;
+
+			Track compiled;
+			compiled.source = track;
+			compiled.loop = track->loop;
+			compiled.duration = track->GetDuration();
+
+			if (floatTrack->IsBaked())
+			{
+				compiled.baked = true;
+				compiled.bakedBegin = floatTrack->mBakedBegin;
+				compiled.bakedRate = floatTrack->mBakedRate;
+				compiled.keysBegin = mBakedValues.Count();
+				compiled.keysCount = floatTrack->mBakedCount;
+
+				for (int i = 0; i < compiled.keysCount; i++)
+					mBakedValues.Add(floatTrack->GetBakedSample(i));
+
+				mTracks.Add(compiled);
+				continue;
+			}
+
+			const Vector<Curve::Key>& keys = floatTrack->curve.GetKeys();
+
+			compiled.keysBegin = mKeysPositions.Count();
+			compiled.keysCount = keys.Count();
+
+			for (auto& key : keys)
+			{
+				mKeysPositions.Add(key.position);
+				mKeysValues.Add(key.value);
+
+				const ApproximationValue* approxPoints = key.GetApproximatedPoints();
+				for (int i = 0; i < approxCount; i++)
+				{
+					mApproxPositions.Add(approxPoints[i].position);
+					mApproxValues.Add(approxPoints[i].value);
+				}
+			}
+
+			mTracks.Add(compiled);
+		}
+
+		mVersion = ++mVersionsCounter;
+	}
+
+	void AnimationTracksBatch::Clear()
+	{
+		mTracks.Clear();
+		mKeysPositions.Clear();
+		mKeysValues.Clear();
+		mApproxPositions.Clear();
+		mApproxValues.Clear();
+		mBakedValues.Clear();
+
+		mVersion = ++mVersionsCounter;
+	}
+
+	int AnimationTracksBatch::GetTracksCount() const
+	{
+		return mTracks.Count();
+	}
+
+	IAnimationTrack* AnimationTracksBatch::GetTrack(int idx) const
+	{
+		return mTracks[idx].source;
+	}
+
+	UInt AnimationTracksBatch::GetVersion() const
+	{
+		return mVersion;
+	}
+
+	void AnimationTracksBatch::Sample(float time, int* cursors, float* values) const
+	{
+		const int approxCount = Curve::Key::mApproxValuesCount;
+
+		int tracksCount = mTracks.Count();
+		for (int i = 0; i < tracksCount; i++)
+		{
+			const Track& track = mTracks[i];
+
+			if (track.keysCount < 2)
+			{
+				const Vector<float>& trackValues = track.baked ? mBakedValues : mKeysValues;
+				values[i] = track.keysCount == 1 ? trackValues[track.keysBegin] : 0.0f;
+				continue;
+			}
+
+			// Same time mapping as in track player with begin at zero and end at track duration
+			float position;
+			if (track.loop == Loop::None || track.duration <= 0.0f)
+				position = Math::Clamp(time, 0.0f, track.duration);
+			else
+			{
+				float x;
+				if (time > 0)
+					position = modff(time/track.duration, &x)*track.duration;
+				else
+					position = (1.0f - modff(-time/track.duration, &x))*track.duration;
+
+				if (track.loop == Loop::PingPong && (int)x%2 == (time > 0 ? 1 : 0))
+					position = track.duration - position;
+
+				position = Math::Clamp(position, 0.0f, track.duration);
+			}
+
+			if (track.baked)
+			{
+				int lastSample = track.keysCount - 1;
+				float samplePosition = Math::Clamp((position - track.bakedBegin)*track.bakedRate, 0.0f, (float)lastSample);
+				int sample = Math::Min((int)samplePosition, lastSample - 1);
+
+				const float* bakedValues = &mBakedValues[track.keysBegin];
+				values[i] = Math::Lerp(bakedValues[sample], bakedValues[sample + 1], samplePosition - (float)sample);
+				continue;
+			}
+
+			// Searching keys segment from previous one: keys[segment] < position <= keys[segment + 1]
+			const float* keysPositions = &mKeysPositions[track.keysBegin];
+			int lastSegment = track.keysCount - 2;
+			int segment = Math::Clamp(cursors[i], 0, lastSegment);
+
+			while (segment > 0 && position <= keysPositions[segment])
+				segment--;
+
+			while (segment < lastSegment && position > keysPositions[segment + 1])
+				segment++;
+
+			cursors[i] = segment;
+
+			// Segment approximation is stored in right key
+			int approxBegin = (track.keysBegin + segment + 1)*approxCount;
+			const float* approxPositions = &mApproxPositions[approxBegin];
+			const float* approxValues = &mApproxValues[approxBegin];
+
+			int point = 1;
+			while (point < approxCount - 1 && approxPositions[point] < position)
+				point++;
+
+			float coef = (position - approxPositions[point - 1])/(approxPositions[point] - approxPositions[point - 1]);
+			values[i] = Math::Lerp(approxValues[point - 1], approxValues[point], coef);
+		}
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "o2/Utils/Math/Curve.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class IAnimationTrack;
+
+	// -------------------------------------------------------------------------------------------------------
+	// Float tracks of animation clip compiled into contiguous arrays. Keys positions and curves approximation
+	// points of all tracks are stored one after another, so all tracks are sampled in one pass without virtual
+	// calls and keys copying. Sampling keeps last keys segment for each track in cursors, next frame search
+	// usually begins from the same segment. Baked tracks are sampled by index without search
+	// -------------------------------------------------------------------------------------------------------
+	class AnimationTracksBatch
+	{
+	public:
+		// Compiles float tracks from list, other tracks are skipped
+		void Compile(const Vector<IAnimationTrack*>& tracks);
+
+		// Removes all compiled tracks
+		void Clear();
+
+		// Returns compiled tracks count
+		int GetTracksCount() const;
+
+		// Returns source track by index
+		IAnimationTrack* GetTrack(int idx) const;
+
+		// Returns version of compiled data. Changes after each compilation
+		UInt GetVersion() const;
+
+		// Samples all tracks at clip time. Cursors and values must have place for each track, cursors must be zero
+		// at first sampling
+		void Sample(float time, int* cursors, float* values) const;
+
+	protected:
+		// ----------------------------------------------
+		// Compiled track: keys range and loop parameters
+		// ----------------------------------------------
+		struct Track
+		{
+			IAnimationTrack* source = nullptr;  // Source track
+			Loop             loop = Loop::None; // Track loop
+			float            duration = 0.0f;   // Track duration
+			int              keysBegin = 0;     // First key index in keys arrays
+			int              keysCount = 0;     // Keys count
+			bool             baked = false;     // Is track sampled from baked values. Keys range is range in baked values
+			float            bakedBegin = 0.0f; // Position of first baked sample
+			float            bakedRate = 0.0f;  // Baked samples per second
+		};
+
+		Vector<Track> mTracks;          // Compiled tracks
+		Vector<float> mKeysPositions;   // Keys positions of all tracks
+		Vector<float> mKeysValues;      // Keys values of all tracks
+		Vector<float> mApproxPositions; // Approximation points positions, Curve::Key::mApproxValuesCount for each key
+		Vector<float> mApproxValues;    // Approximation points values, Curve::Key::mApproxValuesCount for each key
+		Vector<float> mBakedValues;     // Dequantized baked samples of all baked tracks
+
+		UInt        mVersion = 0;     // Compiled data version
+		static UInt mVersionsCounter; // Versions counter, all batches get unique versions
+	};
+}
@@ -15,12 +15,14 @@ namespace o2
 		IAnimationTrack(other), curve(other.curve)
 	{
 		curve.onKeysChanged.Add(this, &AnimationTrack<float>::OnCurveChanged);
+		CopyBaked(other);
 	}
 
 	AnimationTrack<float>& AnimationTrack<float>::operator=(const AnimationTrack<float>& other)
 	{
 		IAnimationTrack::operator=(other);
 		curve = other.curve;
+		CopyBaked(other);
 
 		onKeysChanged();
 
@@ -36,6 +38,9 @@ namespace o2
 
 	float AnimationTrack<float>::GetValue(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const
 	{
+		if (mBakedCount > 0)
+			return GetBakedValue(position);
+
 		return curve.Evaluate(position, direction, cacheKey, cacheKeyApprox);
 	}
 
@@ -51,6 +56,9 @@ namespace o2
 
 	float AnimationTrack<float>::GetDuration() const
 	{
+		if (mBakedCount > 0)
+			return mBakedDuration;
+
 		return curve.Length();
 	}
 
@@ -157,8 +165,156 @@ namespace o2
 		return curve.GetKeys();
 	}
 
+	void AnimationTrack<float>::Bake(float sampleRate /*= 30.0f*/, float tolerance /*= 0.001f*/, bool keepCurve /*= true*/)
+	{
+		const int maxRateMultiplier = 16;
+		const UInt maxQuantized = 0xffff;
+
+		ClearBaked();
+
+		const Vector<Key>& keys = curve.GetKeys();
+		if (keys.IsEmpty())
+			return;
+
+		float begin = keys[0].position;
+		float duration = curve.Length();
+
+		Vector<float> samples;
+		float minValue = keys[0].value, maxValue = keys[0].value;
+		if (keys.Count() == 1 || duration <= 0.0f)
+			samples.Add(keys[0].value);
+		else
+		{
+			// Doubling rate until curve between samples is close enough to linear interpolation
+			sampleRate = Math::Max(sampleRate, 1.0f);
+			for (int multiplier = 1; ; multiplier *= 2)
+			{
+				int count = Math::Max(2, (int)Math::Ceil(duration*sampleRate*multiplier) + 1);
+				float step = duration/(float)(count - 1);
+
+				samples.Clear();
+				samples.Reserve(count);
+				for (int i = 0; i < count; i++)
+					samples.Add(curve.Evaluate(begin + step*(float)i));
+
+				minValue = maxValue = samples[0];
+				for (float sample : samples)
+				{
+					minValue = Math::Min(minValue, sample);
+					maxValue = Math::Max(maxValue, sample);
+				}
+
+				float error = 0.0f;
+				for (int i = 0; i < count - 1; i++)
+				{
+					for (float coef : { 0.25f, 0.5f, 0.75f })
+					{
+						float curveValue = curve.Evaluate(begin + step*((float)i + coef));
+						float interpolated = Math::Lerp(samples[i], samples[i + 1], coef);
+						error = Math::Max(error, Math::Abs(curveValue - interpolated));
+					}
+				}
+
+				// Stored samples are rounded to quantization step, higher rate can't reduce this error
+				float quantizationError = (maxValue - minValue)/(float)maxQuantized*0.5f;
+				if (error + quantizationError <= tolerance || quantizationError >= tolerance || multiplier >= maxRateMultiplier)
+					break;
+			}
+		}
+
+		// Constant track collapses into one sample
+		if (maxValue - minValue <= tolerance)
+		{
+			float value = (minValue + maxValue)*0.5f;
+			samples.Clear();
+			samples.Add(value);
+			minValue = maxValue = value;
+		}
+
+		// Removing keys before storing samples, because curve changing clears baked data
+		if (!keepCurve)
+			curve.RemoveAllKeys();
+
+		mBakedBegin = begin;
+		mBakedDuration = samples.Count() > 1 ? duration : 0.0f;
+		mBakedRate = samples.Count() > 1 ? (float)(samples.Count() - 1)/duration : 0.0f;
+		mBakedMin = minValue;
+		mBakedStep = (maxValue - minValue)/(float)maxQuantized;
+		mBakedCount = samples.Count();
+
+		mBakedSamples.Resize((mBakedCount + 1)/2);
+		for (auto& packed : mBakedSamples)
+			packed = 0;
+
+		for (int i = 0; i < mBakedCount; i++)
+		{
+			UInt quantized = mBakedStep > 0.0f ? (UInt)Math::Round((samples[i] - minValue)/mBakedStep) : 0;
+			mBakedSamples[i >> 1] |= Math::Min(quantized, maxQuantized) << ((i & 1)*16);
+		}
+
+		onKeysChanged();
+	}
+
+	void AnimationTrack<float>::ClearBaked()
+	{
+		if (mBakedCount == 0)
+			return;
+
+		mBakedBegin = 0.0f;
+		mBakedDuration = 0.0f;
+		mBakedRate = 0.0f;
+		mBakedMin = 0.0f;
+		mBakedStep = 0.0f;
+		mBakedCount = 0;
+		mBakedSamples.Clear();
+	}
+
+	bool AnimationTrack<float>::IsBaked() const
+	{
+		return mBakedCount > 0;
+	}
+
+	int AnimationTrack<float>::GetBakedSamplesCount() const
+	{
+		return mBakedCount;
+	}
+
+	float AnimationTrack<float>::GetBakedSample(int idx) const
+	{
+		UInt quantized = (mBakedSamples[idx >> 1] >> ((idx & 1)*16)) & 0xffff;
+		return mBakedMin + mBakedStep*(float)quantized;
+	}
+
+	float AnimationTrack<float>::GetBakedRate() const
+	{
+		return mBakedRate;
+	}
+
+	float AnimationTrack<float>::GetBakedValue(float position) const
+	{
+		if (mBakedCount == 1)
+			return GetBakedSample(0);
+
+		float samplePosition = Math::Clamp((position - mBakedBegin)*mBakedRate, 0.0f, (float)(mBakedCount - 1));
+		int idx = Math::Min((int)samplePosition, mBakedCount - 2);
+
+		return Math::Lerp(GetBakedSample(idx), GetBakedSample(idx + 1), samplePosition - (float)idx);
+	}
+
+	void AnimationTrack<float>::CopyBaked(const AnimationTrack<float>& other)
+	{
+		mBakedBegin = other.mBakedBegin;
+		mBakedDuration = other.mBakedDuration;
+		mBakedRate = other.mBakedRate;
+		mBakedMin = other.mBakedMin;
+		mBakedStep = other.mBakedStep;
+		mBakedCount = other.mBakedCount;
+		mBakedSamples = other.mBakedSamples;
+	}
+
 	void AnimationTrack<float>::OnCurveChanged()
 	{
+		ClearBaked();
 		onKeysChanged();
 	}
 
@@ -280,10 +436,10 @@ namespace o2
 
 	void AnimationTrack<float>::Player::Evaluate()
 	{
-		if (!mTrack)
+		if (!mTrack || mEvaluatedByBatch)
 			return;
 
-		mCurrentValue = mTrack->curve.Evaluate(mInDurationTime, mInDurationTime > mPrevInDurationTime, mPrevKey, mPrevKeyApproximation);
+		mCurrentValue = mTrack->GetValue(mInDurationTime, mInDurationTime > mPrevInDurationTime, mPrevKey, mPrevKeyApproximation);
 		mPrevInDurationTime = mInDurationTime;
 
 		if (mTarget)
@@ -123,6 +123,27 @@ namespace o2
 		// Returns tween animation from begin to end in duration with linear transition
 		static AnimationTrack<float> Linear(float begin = 0.0f, float end = 1.0f, float duration = 1.0f);
 
+		// Resamples curve with uniform rate into 16 bit quantized samples, after that value is taken by O(1) lookup and
+		// linear interpolation. Rate is doubled up to 16 times while interpolation error plus quantization error (half
+		// of values range divided by 65535) is greater than tolerance. When quantization error alone exceeds tolerance,
+		// rate isn't doubled. When keepCurve is false, curve keys are removed and track is evaluated only by samples
+		void Bake(float sampleRate = 30.0f, float tolerance = 0.001f, bool keepCurve = true);
+
+		// Removes baked samples, track is evaluated by curve
+		void ClearBaked();
+
+		// Returns true when track is evaluated by baked samples
+		bool IsBaked() const;
+
+		// Returns baked samples count
+		int GetBakedSamplesCount() const;
+
+		// Returns baked sample value by index
+		float GetBakedSample(int idx) const;
+
+		// Returns baked samples per second
+		float GetBakedRate() const;
+
 		SERIALIZABLE(AnimationTrack<float>);
 
 	public:
@@ -192,6 +213,8 @@ namespace o2
 			int   mPrevKey = 0;               // Previous evaluation key index
 			int   mPrevKeyApproximation = 0;  // Previous evaluation key approximation index
 
+			bool mEvaluatedByBatch = false; // Is value sampled by animation player clip tracks batch, Evaluate() skips it
+
 			float*              mTarget = nullptr;      // Animation target value pointer
 			Function<void()>    mTargetDelegate;        // Animation target value change event
 			IValueProxy<float>* mTargetProxy = nullptr; // Animation target proxy pointer
@@ -202,17 +225,36 @@ namespace o2
 
 			// Registering this in value mixer
 			void RegMixer(AnimationState* state, const String& path) override;
+
+			friend class AnimationPlayer;
 		};
 
+	protected:
+		float        mBakedBegin = 0.0f;    // Position of first baked sample @SERIALIZABLE
+		float        mBakedDuration = 0.0f; // Duration of baked samples @SERIALIZABLE
+		float        mBakedRate = 0.0f;     // Baked samples per second @SERIALIZABLE
+		float        mBakedMin = 0.0f;      // Value of zero quantized sample @SERIALIZABLE
+		float        mBakedStep = 0.0f;     // Value of quantization step @SERIALIZABLE
+		int          mBakedCount = 0;       // Baked samples count, track isn't baked when zero @SERIALIZABLE
+		Vector<UInt> mBakedSamples;         // Quantized samples, two 16 bit samples are packed in each value @SERIALIZABLE
+
 	protected:
 		// Returns keys (for property)
 		Vector<Key> GetKeysNonContant();
 
-		// It is called when curve updated keys and calculated duration
+		// Returns value from baked samples at position
+		float GetBakedValue(float position) const;
+
+		// Copies baked samples from other track
+		void CopyBaked(const AnimationTrack<float>& other);
+
+		// It is called when curve updated keys and calculated duration. Baked samples become invalid
 		void OnCurveChanged();
 
 		// Completion deserialization callback
 		void OnDeserialized(const DataValue& node) override;
+
+		friend class AnimationTracksBatch;
 	};
 }
 
@@ -225,6 +267,13 @@ CLASS_FIELDS_META(o2::AnimationTrack<float>)
 {
 	PUBLIC_FIELD(keys);
 	PUBLIC_FIELD(curve).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedBegin).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedDuration).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedRate).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedMin).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedStep).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedCount).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedSamples).SERIALIZABLE_ATTRIBUTE();
 }
 END_META;
 CLASS_METHODS_META(o2::AnimationTrack<float>)
@@ -258,7 +307,15 @@ CLASS_METHODS_META(o2::AnimationTrack<float>)
 	PUBLIC_STATIC_FUNCTION(AnimationTrack<float>, EaseOut, float, float, float);
 	PUBLIC_STATIC_FUNCTION(AnimationTrack<float>, EaseInOut, float, float, float);
 	PUBLIC_STATIC_FUNCTION(AnimationTrack<float>, Linear, float, float, float);
+	PUBLIC_FUNCTION(void, Bake, float, float, bool);
+	PUBLIC_FUNCTION(void, ClearBaked);
+	PUBLIC_FUNCTION(bool, IsBaked);
+	PUBLIC_FUNCTION(int, GetBakedSamplesCount);
+	PUBLIC_FUNCTION(float, GetBakedSample, int);
+	PUBLIC_FUNCTION(float, GetBakedRate);
 	PROTECTED_FUNCTION(Vector<Key>, GetKeysNonContant);
+	PROTECTED_FUNCTION(float, GetBakedValue, float);
+	PROTECTED_FUNCTION(void, CopyBaked, const AnimationTrack<float>&);
 	PROTECTED_FUNCTION(void, OnCurveChanged);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 }
@@ -280,6 +337,7 @@ CLASS_FIELDS_META(o2::AnimationTrack<float>::Player)
 	PROTECTED_FIELD(mPrevInDurationTime).DEFAULT_VALUE(0.0f);
 	PROTECTED_FIELD(mPrevKey).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mPrevKeyApproximation).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mEvaluatedByBatch).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mTarget).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(mTargetDelegate);
 	PROTECTED_FIELD(mTargetProxy).DEFAULT_VALUE(nullptr);
@@ -15,6 +15,7 @@
 #include "o2/Utils/Debug/Log/ConsoleLogStream.h"
 #include "o2/Utils/Debug/Log/FileLogStream.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Debug/StackTrace.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 #include "o2/Utils/System/Time/Time.h"
@@ -137,11 +138,16 @@ namespace o2
 
 		float dt = Math::Clamp(realdDt, 0.001f, 0.05f);
 
+#if PROFILER_ENABLED
+		o2Profiler.BeginFrame();
+#endif
+
 		mInput->PreUpdate();
 
 		mTime->Update(realdDt);
 		o2Debug.Update(dt);
 		mTaskManager->Update(dt);
+		ProcessEventQueues();
 		UpdateEventSystem();
 
 		mRender->Begin();
@@ -153,6 +159,8 @@ namespace o2
 		float fixedDT = 1.0f/(float)fixedFPS;
 		while (mAccumulatedDT > fixedDT)
 		{
+			PROFILE_SCOPE("Application::FixedUpdate");
+
 			OnFixedUpdate(fixedDT);
 			FixedUpdateScene(fixedDT);
 
@@ -170,20 +178,32 @@ namespace o2
 
 		DrawUIManager();
 
+#if PROFILER_ENABLED
+		o2Profiler.DrawOverlay();
+#endif
+
 		o2Debug.Draw();
 
+		PROFILE_COUNTER("Draw calls", mRender->GetDrawCallsCount());
+
 		mRender->End();
 
 		mInput->Update(dt);
+
+#if PROFILER_ENABLED
+		o2Profiler.EndFrame();
+#endif
 	}
 
 	void Application::DrawScene()
 	{
+		PROFILE_FUNCTION();
 		mScene->Draw();
 	}
 
 	void Application::UpdateEventSystem()
 	{
+		PROFILE_FUNCTION();
 		mEventSystem->Update();
 	}
 
@@ -192,8 +212,15 @@ namespace o2
 		mEventSystem->PostUpdate();
 	}
 
+	void Application::ProcessEventQueues()
+	{
+		PROFILE_FUNCTION();
+		mEventSystem->ProcessEventQueues();
+	}
+
 	void Application::DrawUIManager()
 	{
+		PROFILE_FUNCTION();
 		mUIManager->Draw();
 	}
 
@@ -267,4 +294,8 @@ namespace o2
 	MemoryManager* MemoryManager::mInstance = new MemoryManager();
 	template<> Debug* Singleton<Debug>::mInstance = mnew Debug();
 	template<> FileSystem* Singleton<FileSystem>::mInstance = mnew FileSystem();
+
+#if PROFILER_ENABLED
+	template<> Profiler* Singleton<Profiler>::mInstance = mnew Profiler();
+#endif
 }
@@ -232,6 +232,9 @@ namespace o2
 		// Post updates event system
 		virtual void PostUpdateEventSystem();
 
+		// Delivers events posted from other threads
+		virtual void ProcessEventQueues();
+
 		// Draws UI manager
 		virtual void DrawUIManager();
 
@@ -7,6 +7,7 @@
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Serialization/Serializable.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 
 // Assets system access macros
@@ -148,9 +149,9 @@ namespace o2
 		Map<String, const Type*> mAssetsTypes;   // Assets types and extensions dictionary
 		const Type*              mStdAssetType;  // Standard asset type
 
-		Vector<AssetCache*>      mCachedAssets;       // Current cached assets
-		Map<String, AssetCache*> mCachedAssetsByPath; // Current cached assets by path
-		Map<UID, AssetCache*>    mCachedAssetsByUID;  // Current cached assets by uid
+		Vector<AssetCache*>          mCachedAssets;       // Current cached assets
+		HashMap<String, AssetCache*> mCachedAssetsByPath; // Current cached assets by path
+		HashMap<UID, AssetCache*>    mCachedAssetsByUID;  // Current cached assets by uid
 
 	protected:
 		// Loads asset infos
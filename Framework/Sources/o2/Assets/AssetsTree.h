@@ -4,6 +4,7 @@
 #include "o2/Assets/AssetInfo.h"
 #include "o2/Utils/FileSystem/FileInfo.h"
 #include "o2/Utils/Basic/ITree.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
 
 namespace o2
 {
@@ -20,10 +21,10 @@ namespace o2
 		String assetsPath;      // Assets path @SERIALIZABLE
 		String builtAssetsPath; // Built assets path @SERIALIZABLE
 
-		Vector<AssetInfo*>      rootAssets;      // Root path assets @SERIALIZABLE
-		Vector<AssetInfo*>      allAssets;       // All assets
-		Map<String, AssetInfo*> allAssetsByPath; // All assets by path
-		Map<UID, AssetInfo*>    allAssetsByUID;  // All assets by UID
+		Vector<AssetInfo*>          rootAssets;      // Root path assets @SERIALIZABLE
+		Vector<AssetInfo*>          allAssets;       // All assets
+		HashMap<String, AssetInfo*> allAssetsByPath; // All assets by path
+		HashMap<UID, AssetInfo*>    allAssetsByUID;  // All assets by UID
 
 	public:
 		// Default constructor
@@ -73,6 +74,8 @@ namespace o2
 
 		// It is called when deserializing node, combine all nodes in mAllNodes
 		void OnDeserialized(const DataValue& node) override;
+
+		friend class AssetsBuilder;
 	};
 }
 
@@ -88,8 +91,6 @@ CLASS_FIELDS_META(o2::AssetsTree)
 	PUBLIC_FIELD(builtAssetsPath).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(rootAssets).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(allAssets);
-	PUBLIC_FIELD(allAssetsByPath);
-	PUBLIC_FIELD(allAssetsByUID);
 }
 END_META;
 CLASS_METHODS_META(o2::AssetsTree)
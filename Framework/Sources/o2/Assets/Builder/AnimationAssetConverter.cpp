@@ -0,0 +1,58 @@
+#include "o2/stdafx.h"
+#include "AnimationAssetConverter.h"
+
+#include "o2/Assets/Builder/AssetsBuilder.h"
+#include "o2/Assets/Types/AnimationAsset.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+
+namespace o2
+{
+	Vector<const Type*> AnimationAssetConverter::GetProcessingAssetsTypes() const
+	{
+		Vector<const Type*> res;
+		res.Add(&TypeOf(AnimationAsset));
+		return res;
+	}
+
+	void AnimationAssetConverter::ConvertAsset(const AssetInfo& node)
+	{
+		String sourceAssetPath = mAssetsBuilder->GetSourceAssetsPath() + node.path;
+		String buildedAssetPath = mAssetsBuilder->GetBuiltAssetsPath() + node.path;
+
+		DataDocument data;
+		data.LoadFromFile(sourceAssetPath);
+
+		AnimationAsset asset;
+		asset.Deserialize(data);
+
+		if (asset.bake.enabled)
+		{
+			asset.animation.Bake(asset.bake.sampleRate, asset.bake.tolerance, asset.bake.keepCurves);
+
+			DataDocument bakedData;
+			asset.Serialize(bakedData);
+			bakedData.SaveToFile(buildedAssetPath);
+		}
+		else
+			o2FileSystem.FileCopy(sourceAssetPath, buildedAssetPath);
+
+		o2FileSystem.SetFileEditDate(buildedAssetPath, node.editTime);
+	}
+
+	void AnimationAssetConverter::RemoveAsset(const AssetInfo& node)
+	{
+		String buildedAssetPath = mAssetsBuilder->GetBuiltAssetsPath() + node.path;
+
+		o2FileSystem.FileDelete(buildedAssetPath);
+	}
+
+	void AnimationAssetConverter::MoveAsset(const AssetInfo& nodeFrom, const AssetInfo& nodeTo)
+	{
+		String fullPathFrom = mAssetsBuilder->GetBuiltAssetsPath() + nodeFrom.path;
+		String fullPathTo = mAssetsBuilder->GetBuiltAssetsPath() + nodeTo.path;
+
+		o2FileSystem.FileMove(fullPathFrom, fullPathTo);
+	}
+}
+
+DECLARE_CLASS(o2::AnimationAssetConverter);
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "IAssetConverter.h"
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------------
+	// Animation asset converter. Bakes float tracks when it is enabled in asset, otherwise copies asset
+	// -------------------------------------------------------------------------------------------------
+	class AnimationAssetConverter: public IAssetConverter
+	{
+	public:
+		// Returns vector of processing assets types
+		Vector<const Type*> GetProcessingAssetsTypes() const;
+
+		// Copies or bakes asset
+		void ConvertAsset(const AssetInfo& node);
+
+		// Removes asset
+		void RemoveAsset(const AssetInfo& node);
+
+		// Moves asset to new path
+		void MoveAsset(const AssetInfo& nodeFrom, const AssetInfo& nodeTo);
+
+		IOBJECT(AnimationAssetConverter);
+	};
+}
+
+CLASS_BASES_META(o2::AnimationAssetConverter)
+{
+	BASE_CLASS(o2::IAssetConverter);
+}
+END_META;
+CLASS_FIELDS_META(o2::AnimationAssetConverter)
+{
+}
+END_META;
+CLASS_METHODS_META(o2::AnimationAssetConverter)
+{
+
+	PUBLIC_FUNCTION(Vector<const Type*>, GetProcessingAssetsTypes);
+	PUBLIC_FUNCTION(void, ConvertAsset, const AssetInfo&);
+	PUBLIC_FUNCTION(void, RemoveAsset, const AssetInfo&);
+	PUBLIC_FUNCTION(void, MoveAsset, const AssetInfo&, const AssetInfo&);
+}
+END_META;
@@ -9,7 +9,9 @@
 #include "o2/Assets/Builder/ImageAssetConverter.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/FileSystem/FolderWatcher.h"
 #include "o2/Utils/System/Time/Timer.h"
 
 namespace o2
@@ -25,11 +27,16 @@ namespace o2
 	AssetsBuilder::~AssetsBuilder()
 	{
 		Reset();
+
+		for (auto& kv : mSourceWatchers)
+			delete kv.second;
 	}
 
 	const Vector<UID>& AssetsBuilder::BuildAssets(const String& assetsPath, const String& builtAssetsPath, const String& dataAssetsTreePath,
 												  AssetsTree* assetsTree, bool forcible /*= false*/)
 	{
+		PROFILE_FUNCTION();
+
 		mSourceAssetsPath = assetsPath;
 		mBuiltAssetsPath = builtAssetsPath;
 		mBuiltAssetsTreePath = dataAssetsTreePath;
@@ -46,19 +53,34 @@ namespace o2
 
 		CheckBasicAtlas();
 
-		FolderInfo folderInfo = o2FileSystem.GetFolderInfo(mSourceAssetsPath);
-		folderInfo.ClampPathNames();
+		// After first build in session source tree is built only from paths changed since previous build
+		bool isWatcherStarted = false;
+		FolderWatcher* watcher = GetSourceWatcher(mSourceAssetsPath, isWatcherStarted);
+		watcher->Update();
+
+		HashSet<String> changedAssetsPaths;
+		bool isIncremental = !forcible && !isWatcherStarted && watcher->IsWatching();
+
+		if (isIncremental)
+			BuildChangedSourceAssetsTree(*watcher, changedAssetsPaths);
+		else
+		{
+			FolderInfo folderInfo = watcher->IsWatching() ? watcher->GetFolderInfo() : o2FileSystem.GetFolderInfo(mSourceAssetsPath);
+			folderInfo.ClampPathNames();
+
+			ProcessMissingMetasCreation(folderInfo);
 
-		ProcessMissingMetasCreation(folderInfo);
+			mSourceAssetsTree.assetsPath = assetsPath;
+			mSourceAssetsTree.Build(folderInfo);
+		}
 
-		mSourceAssetsTree.assetsPath = assetsPath;
-		mSourceAssetsTree.Build(folderInfo);
+		watcher->ResetChangedPaths();
 
 		DataDocument builtAssetsTreeDoc;
 		builtAssetsTreeDoc.LoadFromFile(mBuiltAssetsTreePath);
 		mBuiltAssetsTree->Deserialize(builtAssetsTreeDoc);
 
-		ProcessRemovedAssets();
+		ProcessRemovedAssets(isIncremental ? &changedAssetsPaths : nullptr);
 		ProcessNewAssets();
 		ProcessModifiedAssets();
 		ConvertersPostProcess();
@@ -160,10 +182,136 @@ namespace o2
 		}
 	}
 
-	void AssetsBuilder::ProcessRemovedAssets()
+	FolderWatcher* AssetsBuilder::GetSourceWatcher(const String& path, bool& isStarted)
+	{
+		FolderWatcher* watcher = nullptr;
+		if (!mSourceWatchers.TryGetValue(path, watcher))
+		{
+			watcher = mnew FolderWatcher();
+			mSourceWatchers.Add(path, watcher);
+		}
+
+		isStarted = !watcher->IsWatching();
+		if (isStarted)
+			watcher->Start(path);
+
+		return watcher;
+	}
+
+	void AssetsBuilder::BuildChangedSourceAssetsTree(const FolderWatcher& watcher, HashSet<String>& changedAssetsPaths)
+	{
+		mSourceAssetsTree.assetsPath = mSourceAssetsPath;
+
+		// Meta file change is change of its asset
+		Vector<String> assetsPaths;
+		for (auto& path : watcher.GetChangedPaths())
+		{
+			String assetPath = path.EndsWith(".meta") ? path.SubStr(0, path.Length() - 5) : path;
+			if (!assetPath.IsEmpty() && changedAssetsPaths.Add(assetPath))
+				assetsPaths.Add(assetPath);
+		}
+
+		// Parents first, so changed folder content is loaded with folder once
+		assetsPaths.Sort([](const String& a, const String& b) { return a.Length() < b.Length(); });
+
+		for (auto& assetPath : assetsPaths)
+		{
+			if (mSourceAssetsTree.Find(assetPath))
+				continue;
+
+			String assetFullPath = mSourceAssetsPath + assetPath;
+			String metaFullPath = assetFullPath + ".meta";
+
+			bool isFolder = o2FileSystem.IsFolderExist(assetFullPath);
+			bool isFile = !isFolder && o2FileSystem.IsFileExist(assetFullPath);
+			bool isExistMeta = o2FileSystem.IsFileExist(metaFullPath);
+
+			if (!isFolder && !isFile)
+			{
+				if (isExistMeta)
+				{
+					mLog->Warning("Missing asset for meta: " + assetPath + ".meta - removing meta");
+					o2FileSystem.FileDelete(metaFullPath);
+				}
+
+				continue;
+			}
+
+			if (!isExistMeta)
+			{
+				if (isFolder)
+					GenerateMeta(TypeOf(FolderAsset), metaFullPath);
+				else
+					GenerateMeta(*o2Assets.GetAssetTypeByExtension(o2FileSystem.GetFileExtension(assetPath)), metaFullPath);
+			}
+
+			AssetInfo* parent = LoadSourceAssetParent(assetPath);
+
+			if (isFolder)
+			{
+				AssetInfo* asset = mSourceAssetsTree.LoadAssetNode(assetPath, parent, TimeStamp());
+
+				// Removal of built assets under changed folder is checked by source tree, so it must have all folder content
+				if (const FolderInfo* folderInfo = watcher.FindFolderInfo(assetPath))
+				{
+					FolderInfo rootFolderInfo;
+					rootFolderInfo.path = watcher.GetFolderInfo().path;
+					rootFolderInfo.folders.Add(*folderInfo);
+					rootFolderInfo.ClampPathNames();
+
+					ProcessMissingMetasCreation(rootFolderInfo.folders[0]);
+					mSourceAssetsTree.LoadFolder(rootFolderInfo.folders[0], asset);
+				}
+
+				asset->SetTree(&mSourceAssetsTree);
+			}
+			else
+			{
+				TimeStamp editTime = o2FileSystem.GetFileInfo(assetFullPath).editDate;
+				mSourceAssetsTree.LoadAssetNode(assetPath, parent, editTime)->SetTree(&mSourceAssetsTree);
+			}
+		}
+	}
+
+	AssetInfo* AssetsBuilder::LoadSourceAssetParent(const String& path)
+	{
+		int separatorIdx = path.FindLast("/");
+		if (separatorIdx < 0)
+			return nullptr;
+
+		String parentPath = path.SubStr(0, separatorIdx);
+		if (AssetInfo* parent = mSourceAssetsTree.Find(parentPath))
+			return parent;
+
+		String metaFullPath = mSourceAssetsPath + parentPath + ".meta";
+		if (!o2FileSystem.IsFileExist(metaFullPath))
+			GenerateMeta(TypeOf(FolderAsset), metaFullPath);
+
+		AssetInfo* parent = mSourceAssetsTree.LoadAssetNode(parentPath, LoadSourceAssetParent(parentPath), TimeStamp());
+		parent->SetTree(&mSourceAssetsTree);
+
+		return parent;
+	}
+
+	void AssetsBuilder::ProcessRemovedAssets(const HashSet<String>* changedAssetsPaths /*= nullptr*/)
 	{
 		const Type* folderTypeId = &TypeOf(FolderAsset);
 
+		// Asset can be removed only when it or one of its parent folders was changed
+		auto isChanged = [&](const String& path)
+		{
+			if (!changedAssetsPaths)
+				return true;
+
+			for (String parentPath = path; !parentPath.IsEmpty(); parentPath = parentPath.SubStr(0, Math::Max(parentPath.FindLast("/"), 0)))
+			{
+				if (changedAssetsPaths->Contains(parentPath))
+					return true;
+			}
+
+			return false;
+		};
+
 		mBuiltAssetsTree->SortAssetsInverse();
 
 		// in first pass processing folders, in second - files
@@ -174,7 +322,7 @@ namespace o2
 				auto builtAssetInfo = *builtAssetInfoIt;
 				bool isFolder = builtAssetInfo->meta->GetAssetType() == folderTypeId;
 				bool skip = pass == 0 ? isFolder : !isFolder;
-				if (skip)
+				if (skip || !isChanged(builtAssetInfo->path))
 				{
 					++builtAssetInfoIt;
 					continue;
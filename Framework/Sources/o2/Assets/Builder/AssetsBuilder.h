@@ -4,11 +4,13 @@
 #include "o2/Assets/AssetInfo.h"
 #include "o2/Assets/AssetsTree.h"
 #include "o2/Assets/Builder/StdAssetConverter.h"
+#include "o2/Utils/Types/Containers/HashSet.h"
 #include "o2/Utils/Types/String.h"
 
 namespace o2
 {
 	class FolderInfo;
+	class FolderWatcher;
 	class IAssetConverter;
 
 	// -------------
@@ -45,6 +47,9 @@ namespace o2
 
 		Vector<UID> mModifiedAssets; // Modified assets infos
 
+		Map<String, FolderWatcher*> mSourceWatchers; // Source assets folders watchers by path. Keep folders infos
+		                                             // between builds, so only changed paths are processed again
+
 		Map<const Type*, IAssetConverter*> mAssetConverters;   // Assets converters by type
 		StdAssetConverter                  mStdAssetConverter; // Standard assets converter
 
@@ -58,8 +63,18 @@ namespace o2
 		// Checks basic atlas exist
 		void CheckBasicAtlas();
 
-		// Searching and removing assets
-		void ProcessRemovedAssets();
+		// Returns watcher for source assets path, starts it when required. isStarted is true when it was just started
+		FolderWatcher* GetSourceWatcher(const String& path, bool& isStarted);
+
+		// Builds source assets tree only from watcher changed paths and creates missing metas for them. Changed folders
+		// are loaded with all content, changed assets are attached to their parent folders. Fills changed assets paths
+		void BuildChangedSourceAssetsTree(const FolderWatcher& watcher, HashSet<String>& changedAssetsPaths);
+
+		// Returns parent folder node of asset in source assets tree, loads it and its parents when they aren't loaded
+		AssetInfo* LoadSourceAssetParent(const String& path);
+
+		// Searching and removing assets. When changed assets paths are specified, checks only assets under them
+		void ProcessRemovedAssets(const HashSet<String>* changedAssetsPaths = nullptr);
 
 		// Searching modified and moved assets
 		void ProcessModifiedAssets();
@@ -3,9 +3,12 @@
 
 #include "o2/Assets/Assets.h"
 #include "o2/Scene/Actor.h"
+#include "o2/Scene/ActorInstantiationPlan.h"
 
 namespace o2
 {
+	int ActorAsset::mInstantiationPlansRevision = 0;
+
 	ActorAsset::ActorAsset():
 		mActor(mnew Actor(ActorCreateMode::NotInScene))
 	{
@@ -19,6 +22,7 @@ namespace o2
 
 	ActorAsset::~ActorAsset()
 	{
+		InvalidateInstantiationPlan();
 		delete mActor;
 	}
 
@@ -26,6 +30,7 @@ namespace o2
 	{
 		Asset::operator=(other);
 		*mActor = *other.mActor;
+		InvalidateInstantiationPlan();
 
 		return *this;
 	}
@@ -44,6 +49,36 @@ namespace o2
 	{
 		return mActor;
 	}
+
+	const ActorInstantiationPlan& ActorAsset::GetInstantiationPlan() const
+	{
+		if (mInstantiationPlan && mInstantiationPlanRevision != mInstantiationPlansRevision)
+			const_cast<ActorAsset*>(this)->InvalidateInstantiationPlan();
+
+		if (!mInstantiationPlan)
+		{
+			mInstantiationPlan = mnew ActorInstantiationPlan(mActor);
+			mInstantiationPlanRevision = mInstantiationPlansRevision;
+		}
+
+		return *mInstantiationPlan;
+	}
+
+	void ActorAsset::InvalidateInstantiationPlan()
+	{
+		delete mInstantiationPlan;
+		mInstantiationPlan = nullptr;
+	}
+
+	void ActorAsset::InvalidateAllInstantiationPlans()
+	{
+		mInstantiationPlansRevision++;
+	}
+
+	void ActorAsset::OnDeserialized(const DataValue& node)
+	{
+		InvalidateInstantiationPlan();
+	}
 }
 
 template<>
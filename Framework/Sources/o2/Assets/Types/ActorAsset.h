@@ -5,6 +5,7 @@
 namespace o2
 {
 	class Actor;
+	class ActorInstantiationPlan;
 
 	// -----------
 	// Actor asset
@@ -24,6 +25,16 @@ namespace o2
 		// Returns actor
 		Actor* GetActor() const;
 
+		// Returns compiled instantiation plan of actor, builds it when required
+		const ActorInstantiationPlan& GetInstantiationPlan() const;
+
+		// Resets instantiation plan. Must be called when actor hierarchy, components or their pointers are changed
+		void InvalidateInstantiationPlan();
+
+		// Resets instantiation plans of all actor assets. Used when changes are applied to prototypes, which
+		// can be nested into other prototypes
+		static void InvalidateAllInstantiationPlans();
+
 		// Returns extensions string
 		static const char* GetFileExtensions();
 
@@ -41,6 +52,11 @@ namespace o2
 	protected:
 		Actor* mActor; // Asset data @SERIALIZABLE
 
+		mutable ActorInstantiationPlan* mInstantiationPlan = nullptr;   // Cached instantiation plan, null when not built
+		mutable int                     mInstantiationPlanRevision = 0; // Plans revision, when plan was built
+
+		static int mInstantiationPlansRevision; // Current plans revision, increases when all plans are invalidated
+
 	protected:
 		// Default constructor
 		ActorAsset();
@@ -48,6 +64,9 @@ namespace o2
 		// Copy-constructor
 		ActorAsset(const ActorAsset& other);
 
+		// It is called when asset was deserialized, resets instantiation plan built for previous actor
+		void OnDeserialized(const DataValue& node) override;
+
 		friend class Assets;
 	};
 
@@ -69,9 +88,12 @@ CLASS_METHODS_META(o2::ActorAsset)
 
 	PUBLIC_FUNCTION(Meta*, GetMeta);
 	PUBLIC_FUNCTION(Actor*, GetActor);
+	PUBLIC_FUNCTION(void, InvalidateInstantiationPlan);
+	PUBLIC_STATIC_FUNCTION(void, InvalidateAllInstantiationPlans);
 	PUBLIC_STATIC_FUNCTION(const char*, GetFileExtensions);
 	PUBLIC_STATIC_FUNCTION(String, GetEditorIcon);
 	PUBLIC_STATIC_FUNCTION(int, GetEditorSorting);
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableToCreateFromEditor);
+	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 }
 END_META;
@@ -6,7 +6,7 @@
 namespace o2
 {
 	AnimationAsset::AnimationAsset(const AnimationAsset& other):
-		AssetWithDefaultMeta<AnimationAsset>(other), animation(other.animation)
+		AssetWithDefaultMeta<AnimationAsset>(other), animation(other.animation), bake(other.bake)
 	{}
 
 	AnimationAsset::AnimationAsset(const AnimationClip& clip):
@@ -17,6 +17,7 @@ namespace o2
 	{
 		Asset::operator=(other);
 		animation = other.animation;
+		bake = other.bake;
 
 		return *this;
 	}
@@ -37,3 +38,5 @@ template<>
 DECLARE_CLASS_MANUAL(o2::Ref<o2::AnimationAsset>);
 
 DECLARE_CLASS(o2::AnimationAsset);
+
+DECLARE_CLASS(o2::AnimationAsset::BakeSettings);
@@ -12,8 +12,23 @@ namespace o2
 	// ---------------
 	class AnimationAsset: public AssetWithDefaultMeta<AnimationAsset>
 	{
+	public:
+		// ----------------------------------------------------------------------
+		// Baking settings. Float tracks are baked by assets builder when enabled
+		// ----------------------------------------------------------------------
+		struct BakeSettings: public ISerializable
+		{
+			bool  enabled = false;     // Is animation baked when building assets @SERIALIZABLE
+			float sampleRate = 30.0f;  // Minimal samples per second @SERIALIZABLE
+			float tolerance = 0.001f;  // Maximal error of baked values @SERIALIZABLE
+			bool  keepCurves = true;   // Are curves kept in built asset for editing @SERIALIZABLE
+
+			SERIALIZABLE(BakeSettings);
+		};
+
 	public:
 		AnimationClip animation; // Asset data @SERIALIZABLE @EXPANDED_BY_DEFAULT
+		BakeSettings  bake;      // Baking settings @SERIALIZABLE
 
 	public:
 		// Default constructor
@@ -59,6 +74,7 @@ END_META;
 CLASS_FIELDS_META(o2::AnimationAsset)
 {
 	PUBLIC_FIELD(animation).EXPANDED_BY_DEFAULT_ATTRIBUTE().SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(bake).SERIALIZABLE_ATTRIBUTE();
 }
 END_META;
 CLASS_METHODS_META(o2::AnimationAsset)
@@ -71,3 +87,21 @@ CLASS_METHODS_META(o2::AnimationAsset)
 	PUBLIC_STATIC_FUNCTION(bool, IsReferenceCanOwnInstance);
 }
 END_META;
+
+CLASS_BASES_META(o2::AnimationAsset::BakeSettings)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(o2::AnimationAsset::BakeSettings)
+{
+	PUBLIC_FIELD(enabled).DEFAULT_VALUE(false).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(sampleRate).DEFAULT_VALUE(30.0f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(tolerance).DEFAULT_VALUE(0.001f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(keepCurves).DEFAULT_VALUE(true).SERIALIZABLE_ATTRIBUTE();
+}
+END_META;
+CLASS_METHODS_META(o2::AnimationAsset::BakeSettings)
+{
+}
+END_META;
@@ -15,6 +15,13 @@
 #define RENDER_DEBUG false
 #endif
 
+// Enables frame profiler zones and counters. When disabled profiling macros are compiled out
+#if defined DISABLE_PROFILER
+#define PROFILER_ENABLED false
+#else
+#define PROFILER_ENABLED true
+#endif
+
 // Describes that engine running as editor
 #define IS_EDITOR true
 
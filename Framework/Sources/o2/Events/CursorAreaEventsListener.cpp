@@ -4,6 +4,7 @@
 #include "o2/Events/EventSystem.h"
 #include "o2/Render/IDrawable.h"
 #include "o2/Render/Render.h"
+#include "o2/Scene/UI/Widget.h"
 
 namespace o2
 {
@@ -25,6 +26,15 @@ namespace o2
 		return false;
 	}
 
+	RectF CursorAreaEventsListener::GetCursorAreaBounds() const
+	{
+		// Widget listeners are under point inside layout, drawing layers or children, like properties boxes
+		if (auto widget = dynamic_cast<const Widget*>(this))
+			return widget->mBoundsWithChilds;
+
+		return mScissorRect;
+	}
+
 	bool CursorAreaEventsListener::IsScrollable() const
 	{
 		return false;
@@ -36,6 +36,11 @@ namespace o2
 		// Returns true if point is in this object
 		virtual bool IsUnderPoint(const Vec2F& point);
 
+		// Returns rectangle, out of which listener is never under point. Used for fast search of listeners under cursor.
+		// By default it is widget bounds for widgets, and scissor rect at drawing moment for others. Listeners with
+		// scissor rect bounds are checked at each point, override it when listener area is known
+		virtual RectF GetCursorAreaBounds() const;
+
 		// Returns is listener scrollable
 		virtual bool IsScrollable() const;
 
@@ -37,12 +37,23 @@ namespace o2
 		return point*mLocalToWorldTransform;
 	}
 
-	void CursorAreaEventListenersLayer::Update()
+	void CursorAreaEventListenersLayer::AddDrawnListener(CursorAreaEventsListener* listener)
 	{
-		cursorEventAreaListeners.Reverse();
-		mDragListeners.Reverse();
+		RectF bounds = listener->GetCursorAreaBounds().GetIntersection(listener->mScissorRect);
+
+		if (mListenersBounds.IsEmpty())
+			mListenersBoundsUnion = bounds;
+		else
+			mListenersBoundsUnion.Expand(bounds);
 
-		mLastUnderCursorListeners = mUnderCursorListeners;
+		cursorEventAreaListeners.Add(listener);
+		mListenersBounds.Add(bounds);
+		mGridBuilt = false;
+	}
+
+	void CursorAreaEventListenersLayer::Update()
+	{
+		mLastUnderCursorListeners.swap(mUnderCursorListeners);
 		mUnderCursorListeners.Clear();
 
 		if (mEnabled)
@@ -97,7 +108,9 @@ namespace o2
 	void CursorAreaEventListenersLayer::PostUpdate()
 	{
 		cursorEventAreaListeners.Clear();
+		mListenersBounds.Clear();
 		mDragListeners.Clear();
+		mGridBuilt = false;
 	}
 
 	void CursorAreaEventListenersLayer::BreakCursorEvent()
@@ -116,7 +129,13 @@ namespace o2
 
 	void CursorAreaEventListenersLayer::UnregCursorAreaListener(CursorAreaEventsListener* listener)
 	{
-		cursorEventAreaListeners.RemoveAll([&](auto x) { return x == listener; });
+		// Keeping indices of other listeners, they are used by grid
+		for (auto& x : cursorEventAreaListeners)
+		{
+			if (x == listener)
+				x = nullptr;
+		}
+
 		mRightButtonPressedListeners.RemoveAll([&](auto x) { return x == listener; });
 		mMiddleButtonPressedListeners.RemoveAll([&](auto x) { return x == listener; });
 
@@ -137,7 +156,24 @@ namespace o2
 
 	Vector<CursorAreaEventsListener*> CursorAreaEventListenersLayer::GetAllCursorListenersUnderCursor(CursorId cursorId) const
 	{
-		return cursorEventAreaListeners;
+		auto res = cursorEventAreaListeners.FindAll([](CursorAreaEventsListener* x) { return x != nullptr; });
+		res.Reverse();
+
+		return res;
+	}
+
+	Vector<CursorAreaEventsListener*> CursorAreaEventListenersLayer::GetListenersUnderPoint(const Vec2F& point) const
+	{
+		Vector<CursorAreaEventsListener*> res;
+		ForEachListenerAtPoint(point, [&](CursorAreaEventsListener* listener)
+		{
+			if (listener->mInteractable && listener->IsUnderPoint(point) && listener->mScissorRect.IsInside(point))
+				res.Add(listener);
+
+			return true;
+		});
+
+		return res;
 	}
 
 	bool CursorAreaEventListenersLayer::IsUnderPoint(const Vec2F& point)
@@ -167,34 +203,144 @@ namespace o2
 	void CursorAreaEventListenersLayer::ProcessCursorTracing(const Input::Cursor& cursor)
 	{
 		auto localCursor = ConvertLocalCursor(cursor);
+		Vector<CursorAreaEventsListener*>* underCursorListeners = nullptr;
 
-		for (auto listener : cursorEventAreaListeners)
+		ForEachListenerAtPoint(localCursor.position, [&](CursorAreaEventsListener* listener)
 		{
 			if (!listener->IsUnderPoint(localCursor.position) || !listener->mScissorRect.IsInside(localCursor.position))
-				continue;
+				return true;
 
 			auto drag = dynamic_cast<DragableObject*>(listener);
 			if (drag && drag->IsDragging())
+				return true;
+
+			if (!underCursorListeners)
+				underCursorListeners = &mUnderCursorListeners[localCursor.id];
+
+			underCursorListeners->Add(listener);
+
+			return listener->IsInputTransparent();
+		});
+	}
+
+	void CursorAreaEventListenersLayer::BuildGrid() const
+	{
+		mGridBuilt = true;
+		mGridWideListeners.Clear();
+
+		for (auto& cell : mGridCells)
+			cell.Clear();
+
+		int count = cursorEventAreaListeners.Count();
+		Vec2F size = mListenersBoundsUnion.Size();
+
+		if (count < mMinGridListeners || size.x < FLT_EPSILON || size.y < FLT_EPSILON)
+		{
+			mGridSize = Vec2I();
+			return;
+		}
+
+		int side = Math::Clamp(Math::CeilToInt(Math::Sqrt((float)count)*0.5f), 1, mMaxGridSize);
+		mGridSize = Vec2I(side, side);
+		mGridRect = mListenersBoundsUnion;
+		mGridInvCellSize = Vec2F((float)side/size.x, (float)side/size.y);
+
+		if (mGridCells.Count() < side*side)
+			mGridCells.Resize(side*side);
+
+		// Listeners covering big part of grid are checked for each point, it's cheaper than adding them into each cell
+		int maxCells = Math::Max(side*side/4, 1);
+
+		for (int i = 0; i < count; i++)
+		{
+			const RectF& bounds = mListenersBounds[i];
+			if (!cursorEventAreaListeners[i] || bounds.Width() <= 0.0f || bounds.Height() <= 0.0f)
 				continue;
 
-			if (!mUnderCursorListeners.ContainsKey(localCursor.id))
-				mUnderCursorListeners.Add(localCursor.id, {});
+			int left = Math::Clamp(Math::FloorToInt((bounds.left - mGridRect.left)*mGridInvCellSize.x), 0, side - 1);
+			int right = Math::Clamp(Math::FloorToInt((bounds.right - mGridRect.left)*mGridInvCellSize.x), 0, side - 1);
+			int bottom = Math::Clamp(Math::FloorToInt((bounds.bottom - mGridRect.bottom)*mGridInvCellSize.y), 0, side - 1);
+			int top = Math::Clamp(Math::FloorToInt((bounds.top - mGridRect.bottom)*mGridInvCellSize.y), 0, side - 1);
 
-			mUnderCursorListeners[localCursor.id].Add(listener);
+			if ((right - left + 1)*(top - bottom + 1) > maxCells)
+			{
+				mGridWideListeners.Add(i);
+				continue;
+			}
 
-			if (!listener->IsInputTransparent())
+			for (int y = bottom; y <= top; y++)
+			{
+				for (int x = left; x <= right; x++)
+					mGridCells[y*side + x].Add(i);
+			}
+		}
+	}
+
+	template<typename _func>
+	void CursorAreaEventListenersLayer::ForEachListenerAtPoint(const Vec2F& point, const _func& func) const
+	{
+		if (!mGridBuilt)
+			BuildGrid();
+
+		// Not enough listeners for grid, checking all from top to bottom
+		if (mGridSize.x == 0)
+		{
+			for (int i = cursorEventAreaListeners.Count() - 1; i >= 0; i--)
+			{
+				auto listener = cursorEventAreaListeners[i];
+				if (listener && IsInsideBounds(mListenersBounds[i], point) && !func(listener))
+					return;
+			}
+
+			return;
+		}
+
+		static const Vector<int> emptyCell;
+		const Vector<int>* cell = &emptyCell;
+
+		if (IsInsideBounds(mGridRect, point))
+		{
+			int x = Math::Clamp(Math::FloorToInt((point.x - mGridRect.left)*mGridInvCellSize.x), 0, mGridSize.x - 1);
+			int y = Math::Clamp(Math::FloorToInt((point.y - mGridRect.bottom)*mGridInvCellSize.y), 0, mGridSize.y - 1);
+			cell = &mGridCells[y*mGridSize.x + x];
+		}
+
+		// Merging cell and wide listeners by drawing order, from last drawn
+		int cellIdx = cell->Count() - 1;
+		int wideIdx = mGridWideListeners.Count() - 1;
+
+		while (cellIdx >= 0 || wideIdx >= 0)
+		{
+			int idx;
+			if (wideIdx < 0 || (cellIdx >= 0 && (*cell)[cellIdx] > mGridWideListeners[wideIdx]))
+				idx = (*cell)[cellIdx--];
+			else
+				idx = mGridWideListeners[wideIdx--];
+
+			auto listener = cursorEventAreaListeners[idx];
+			if (listener && IsInsideBounds(mListenersBounds[idx], point) && !func(listener))
 				return;
 		}
 	}
 
+	bool CursorAreaEventListenersLayer::IsInsideBounds(const RectF& bounds, const Vec2F& point)
+	{
+		return point.x >= bounds.left && point.x <= bounds.right && point.y >= bounds.bottom && point.y <= bounds.top;
+	}
+
 	void CursorAreaEventListenersLayer::ProcessCursorEnter()
 	{
-		for (auto underCursorListeners : mUnderCursorListeners)
+		for (auto& underCursorListeners : mUnderCursorListeners)
 		{
-			bool lastListenersHasSameCursor = mLastUnderCursorListeners.ContainsKey(underCursorListeners.first);
+			mListenersSet.Clear();
+
+			auto fndLast = mLastUnderCursorListeners.find(underCursorListeners.first);
+			if (fndLast != mLastUnderCursorListeners.end())
+				mListenersSet.Add(fndLast->second.begin(), fndLast->second.end());
+
 			for (auto listener : underCursorListeners.second)
 			{
-				if (!lastListenersHasSameCursor || !mLastUnderCursorListeners[underCursorListeners.first].Contains(listener))
+				if (!mListenersSet.Contains(listener))
 					listener->OnCursorEnter(*o2Input.GetCursor(underCursorListeners.first));
 			}
 		}
@@ -202,12 +348,17 @@ namespace o2
 
 	void CursorAreaEventListenersLayer::ProcessCursorExit()
 	{
-		for (auto lastUnderCursorListeners : mLastUnderCursorListeners)
+		for (auto& lastUnderCursorListeners : mLastUnderCursorListeners)
 		{
-			bool listenersHasSameCursor = mUnderCursorListeners.ContainsKey(lastUnderCursorListeners.first);
+			mListenersSet.Clear();
+
+			auto fnd = mUnderCursorListeners.find(lastUnderCursorListeners.first);
+			if (fnd != mUnderCursorListeners.end())
+				mListenersSet.Add(fnd->second.begin(), fnd->second.end());
+
 			for (auto listener : lastUnderCursorListeners.second)
 			{
-				if (!listenersHasSameCursor || !mUnderCursorListeners[lastUnderCursorListeners.first].Contains(listener))
+				if (!mListenersSet.Contains(listener))
 					listener->OnCursorExit(*o2Input.GetCursor(lastUnderCursorListeners.first));
 			}
 		}
@@ -219,7 +370,7 @@ namespace o2
 
 		for (auto listener : cursorEventAreaListeners)
 		{
-			if (!listener->IsUnderPoint(localCursor.position))
+			if (listener && !listener->IsUnderPoint(localCursor.position))
 				listener->OnCursorPressedOutside(localCursor);
 		}
 
@@ -288,7 +439,7 @@ namespace o2
 
 		for (auto listener : cursorEventAreaListeners)
 		{
-			if (!listener->IsUnderPoint(localCursor.position))
+			if (listener && !listener->IsUnderPoint(localCursor.position))
 				listener->OnCursorReleasedOutside(localCursor);
 		}
 
@@ -1,5 +1,7 @@
 #pragma once
 #include "o2/Utils/Math/Basis.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
+#include "o2/Utils/Types/Containers/HashSet.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Events/CursorAreaEventsListener.h"
 
@@ -14,7 +16,7 @@ namespace o2
 		Basis viewPortBasis;
 		Basis renderBasis;
 
-		Vector<CursorAreaEventsListener*> cursorEventAreaListeners;
+		Vector<CursorAreaEventsListener*> cursorEventAreaListeners; // Drawn listeners in drawing order. Unregistered listeners are replaced with null
 
 	public:
 		// It is called when layer sub listeners has began draw with actual camera
@@ -32,6 +34,9 @@ namespace o2
 		// Converts from local point
 		Vec2F FromLocal(const Vec2F& point) const;
 
+		// Registers drawn listener, remembers its bounds for searching listeners under cursor
+		void AddDrawnListener(CursorAreaEventsListener* listener);
+
 		// Updates and processes events
 		void Update();
 
@@ -50,6 +55,9 @@ namespace o2
 		// Returns all cursor listeners under cursor arranged by depth
 		Vector<CursorAreaEventsListener*> GetAllCursorListenersUnderCursor(CursorId cursorId) const;
 
+		// Returns all interactable listeners under point in local coordinates, from top to bottom
+		Vector<CursorAreaEventsListener*> GetListenersUnderPoint(const Vec2F& point) const;
+
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
@@ -62,11 +70,26 @@ namespace o2
 		Vector<CursorAreaEventsListener*>                mRightButtonPressedListeners;  // Right mouse button pressed listener
 		Vector<CursorAreaEventsListener*>                mMiddleButtonPressedListeners; // Middle mouse button pressed listener
 
-		Map<CursorId, Vector<CursorAreaEventsListener*>> mUnderCursorListeners;     // Under cursor listeners for each cursor
-		Map<CursorId, Vector<CursorAreaEventsListener*>> mLastUnderCursorListeners; // Under cursor listeners for each cursor on last frame
+		HashMap<CursorId, Vector<CursorAreaEventsListener*>> mUnderCursorListeners;     // Under cursor listeners for each cursor
+		HashMap<CursorId, Vector<CursorAreaEventsListener*>> mLastUnderCursorListeners; // Under cursor listeners for each cursor on last frame
 
 		Vector<DragableObject*> mDragListeners; // Drag events listeners
 
+		Vector<RectF> mListenersBounds;      // Bounds of drawn listeners, by index in cursorEventAreaListeners
+		RectF         mListenersBoundsUnion; // Union of all listeners bounds
+
+		mutable bool                mGridBuilt = false; // Is grid built for current drawn listeners
+		mutable RectF               mGridRect;          // Rectangle covered by grid
+		mutable Vec2I               mGridSize;          // Count of grid cells by axes
+		mutable Vec2F               mGridInvCellSize;   // Inverted size of grid cell
+		mutable Vector<Vector<int>> mGridCells;         // Indices of listeners, overlapping cell, in drawing order
+		mutable Vector<int>         mGridWideListeners; // Indices of listeners, overlapping too many cells, in drawing order
+
+		HashSet<CursorAreaEventsListener*> mListenersSet; // Temporary set for under cursor listeners diffing
+
+		static constexpr int mMaxGridSize = 64;       // Max count of grid cells by axis
+		static constexpr int mMinGridListeners = 16;  // Minimal count of listeners, when grid is used instead of linear search
+
 	private:
 		// It is called when cursor enters this object
 		void OnCursorEnter(const Input::Cursor& cursor) override;
@@ -80,6 +103,16 @@ namespace o2
 		// processes cursor tracing for cursor
 		void ProcessCursorTracing(const Input::Cursor& cursor);
 
+		// Builds uniform grid over bounds of drawn listeners
+		void BuildGrid() const;
+
+		// Calls func for listeners, which bounds contain point, from top to bottom. Stops when func returns false
+		template<typename _func>
+		void ForEachListenerAtPoint(const Vec2F& point, const _func& func) const;
+
+		// Returns true when point is inside bounds or on their border
+		static bool IsInsideBounds(const RectF& bounds, const Vec2F& point);
+
 		// Processes cursor enter event
 		void ProcessCursorEnter();
 
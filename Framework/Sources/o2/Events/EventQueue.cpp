@@ -0,0 +1,26 @@
+#include "o2/stdafx.h"
+#include "EventQueue.h"
+
+#include "o2/Events/EventSystem.h"
+
+namespace o2
+{
+	IEventQueue::IEventQueue()
+	{
+		// Queue created on worker thread is still processed by event system thread
+		std::thread::id consumerThread = EventSystem::GetEventQueuesConsumerThread();
+		mConsumerThread = consumerThread != std::thread::id() ? consumerThread : std::this_thread::get_id();
+
+		EventSystem::RegEventQueue(this);
+	}
+
+	IEventQueue::~IEventQueue()
+	{
+		Unregister();
+	}
+
+	void IEventQueue::Unregister()
+	{
+		EventSystem::UnregEventQueue(this);
+	}
+}
@@ -0,0 +1,228 @@
+#pragma once
+
+#include "o2/Utils/Delegates.h"
+#include "o2/Utils/Types/Containers/ConcurrentQueue.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+#include <atomic>
+#include <thread>
+
+namespace o2
+{
+	// ---------------------------------------------------------------------------------------------
+	// Basic events queue interface. Queues are registered in event system on construction and
+	// processed by it once per frame on main thread. Consumer thread is the thread which processes
+	// queue; until first processing it is event system thread, or creating thread without event system
+	// ---------------------------------------------------------------------------------------------
+	class IEventQueue
+	{
+	public:
+		// Default constructor. Registers queue in event system
+		IEventQueue();
+
+		// Destructor. Unregisters queue from event system
+		virtual ~IEventQueue();
+
+		// Processes posted events. Returns count of delivered events. Calling thread becomes consumer thread
+		virtual int Process() = 0;
+
+	protected:
+		std::atomic<std::thread::id> mConsumerThread; // Thread which processes events
+
+	protected:
+		// Unregisters queue from event system. Waits when queues are processing now. Must be called by derived
+		// queue destructor, so queue isn't processed while its members are destroying
+		void Unregister();
+
+		// Copying is not available
+		IEventQueue(const IEventQueue& other) = delete;
+
+		// Copying is not available
+		IEventQueue& operator=(const IEventQueue& other) = delete;
+	};
+
+	// -----------------------------------------------------------------------------------------------------
+	// Typed events queue for many producers and one consumer. Events are posted from any thread without
+	// locks and delivered on consumer thread in posting order of each producer. Consumer is the thread which
+	// processes queue, usually main thread, where it is processed in Application::ProcessFrame.
+	// Events with same coalescing key, posted between processings, are delivered once with last posted value
+	// -----------------------------------------------------------------------------------------------------
+	template<typename _event>
+	class EventQueue: public IEventQueue
+	{
+	public:
+		Function<void(const _event&)>         onEvent;       // Event delivery callback, called for each event
+		Function<void(const Vector<_event>&)> onEventsBatch; // Events batch delivery callback, called once for all processed events
+
+	public:
+		// Constructor with capacity. When queue is full, producers wait until consumer processes events
+		explicit EventQueue(int capacity = 4096);
+
+		// Destructor. Unregisters queue from event system
+		~EventQueue() override;
+
+		// Posts event. Can be called from any thread
+		void Post(const _event& event);
+
+		// Posts event. Can be called from any thread
+		void Post(_event&& event);
+
+		// Sets coalescing key function. Events with same key are delivered once per processing, with last posted value
+		void SetCoalescing(const Function<UInt64(const _event&)>& getKey);
+
+		// Disables coalescing
+		void ResetCoalescing();
+
+		// Processes posted events: delivers them into onEvent and onEventsBatch. Returns count of delivered events
+		int Process() override;
+
+		// Returns approximate count of not processed events
+		int GetPendingCount() const;
+
+	protected:
+		ConcurrentQueue<_event> mQueue; // Lock-free queue of posted events
+
+		Function<UInt64(const _event&)> mGetCoalescingKey; // Coalescing key function, empty when coalescing is disabled
+		HashMap<UInt64, int>            mCoalescedEvents;  // Batch indexes of coalesced events by key
+
+		Vector<_event> mBatch;              // Processing events batch
+		bool           mProcessing = false; // Is events processing now
+
+	protected:
+		// Pushes event into queue. When queue is full, waits for consumer or processes events on consumer thread
+		template<typename _arg>
+		void Push(_arg&& event);
+
+		// Delivers event without queueing
+		void Deliver(const _event& event);
+
+		// Adds popped event into batch, replaces previous event with same coalescing key
+		void AddToBatch(_event& event);
+	};
+
+	template<typename _event>
+	EventQueue<_event>::EventQueue(int capacity /*= 4096*/):
+		mQueue(capacity)
+	{}
+
+	template<typename _event>
+	EventQueue<_event>::~EventQueue()
+	{
+		Unregister();
+	}
+
+	template<typename _event>
+	void EventQueue<_event>::Post(const _event& event)
+	{
+		Push(event);
+	}
+
+	template<typename _event>
+	void EventQueue<_event>::Post(_event&& event)
+	{
+		Push(std::move(event));
+	}
+
+	template<typename _event>
+	template<typename _arg>
+	void EventQueue<_event>::Push(_arg&& event)
+	{
+		while (!mQueue.TryPush(std::forward<_arg>(event)))
+		{
+			if (std::this_thread::get_id() != mConsumerThread)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			// Consumer can't wait for itself: processes events when possible, otherwise delivers event immediately
+			if (mProcessing)
+			{
+				Deliver(event);
+				return;
+			}
+
+			Process();
+		}
+	}
+
+	template<typename _event>
+	void EventQueue<_event>::SetCoalescing(const Function<UInt64(const _event&)>& getKey)
+	{
+		mGetCoalescingKey = getKey;
+	}
+
+	template<typename _event>
+	void EventQueue<_event>::ResetCoalescing()
+	{
+		mGetCoalescingKey.Clear();
+	}
+
+	template<typename _event>
+	int EventQueue<_event>::Process()
+	{
+		if (mProcessing)
+			return 0;
+
+		mProcessing = true;
+		mConsumerThread = std::this_thread::get_id();
+
+		// Pops only events posted before processing, so endless posting from other threads can't stall consumer
+		int count = mQueue.GetApproxCount();
+		_event event;
+		for (int i = 0; i < count && mQueue.TryPop(event); i++)
+			AddToBatch(event);
+
+		mCoalescedEvents.Clear();
+
+		for (auto& batchEvent : mBatch)
+			onEvent(batchEvent);
+
+		if (!mBatch.IsEmpty())
+			onEventsBatch(mBatch);
+
+		int delivered = mBatch.Count();
+		mBatch.Clear();
+
+		mProcessing = false;
+
+		return delivered;
+	}
+
+	template<typename _event>
+	int EventQueue<_event>::GetPendingCount() const
+	{
+		return mQueue.GetApproxCount();
+	}
+
+	template<typename _event>
+	void EventQueue<_event>::Deliver(const _event& event)
+	{
+		onEvent(event);
+
+		Vector<_event> batch;
+		batch.Add(event);
+		onEventsBatch(batch);
+	}
+
+	template<typename _event>
+	void EventQueue<_event>::AddToBatch(_event& event)
+	{
+		if (mGetCoalescingKey)
+		{
+			UInt64 key = mGetCoalescingKey(event);
+
+			int idx;
+			if (mCoalescedEvents.TryGetValue(key, idx))
+			{
+				mBatch[idx] = std::move(event);
+				return;
+			}
+
+			mCoalescedEvents.Add(key, mBatch.Count());
+		}
+
+		mBatch.Add(std::move(event));
+	}
+}
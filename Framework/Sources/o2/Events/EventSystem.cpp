@@ -3,6 +3,7 @@
 
 #include "o2/Events/ApplicationEventsListener.h"
 #include "o2/Events/CursorAreaEventsListener.h"
+#include "o2/Events/EventQueue.h"
 #include "o2/Events/KeyboardEventsListener.h"
 #include "o2/Events/ShortcutKeysListener.h"
 #include "o2/Render/Render.h"
@@ -26,6 +27,8 @@ namespace o2
 		mShortcutEventsManager = mnew ShortcutKeysListenersManager();
 		mCurrentCursorAreaEventsLayer = &mCursorAreaListenersBasicLayer;
 		mCursorAreaListenersBasicLayer.mEnabled = true;
+
+		GetEventQueuesConsumerThread() = std::this_thread::get_id();
 	}
 
 	EventSystem::~EventSystem()
@@ -163,6 +166,22 @@ namespace o2
 		mCursorAreaEventsListenersLayers.Add(&mCursorAreaListenersBasicLayer);
 	}
 
+	void EventSystem::ProcessEventQueues()
+	{
+		GetEventQueuesConsumerThread() = std::this_thread::get_id();
+
+		// Lock is held during processing, so queue can't be destroyed from other thread while it is processed.
+		// Events handlers can create or destroy queues on this thread, processing copy of list
+		std::lock_guard<std::recursive_mutex> lock(GetEventQueuesMutex());
+
+		auto queues = GetEventQueues();
+		for (auto queue : queues)
+		{
+			if (GetEventQueues().Contains(queue))
+				queue->Process();
+		}
+	}
+
 	void EventSystem::OnApplicationStarted()
 	{
 		for (auto listener : mApplicationListeners)
@@ -212,17 +231,7 @@ namespace o2
 
 	Vector<CursorAreaEventsListener*> EventSystem::GetAllCursorListenersUnderCursor(CursorId cursorId) const
 	{
-		Vector<CursorAreaEventsListener*> res;
-		Vec2F cursorPos = o2Input.GetCursorPos(cursorId);
-		for (auto listener : mCursorAreaListenersBasicLayer.cursorEventAreaListeners)
-		{
-			if (!listener->IsUnderPoint(cursorPos) || !listener->mScissorRect.IsInside(cursorPos) || !listener->mInteractable)
-				continue;
-
-			res.Add(listener);
-		}
-
-		return res;
+		return mCursorAreaListenersBasicLayer.GetListenersUnderPoint(o2Input.GetCursorPos(cursorId));
 	}
 
 	void EventSystem::BreakCursorEvent()
@@ -280,7 +289,15 @@ namespace o2
 		if (!listener->IsListeningEvents())
 			return;
 
-		mInstance->mCurrentCursorAreaEventsLayer->cursorEventAreaListeners.Add(listener);
+		mInstance->mCurrentCursorAreaEventsLayer->AddDrawnListener(listener);
+
+		for (auto record : mInstance->mDrawnListenersRecords)
+		{
+			if (record->listenersLayer == mInstance->mCurrentCursorAreaEventsLayer)
+				record->cursorAreaListeners.Add(listener);
+			else
+				record->complete = false;
+		}
 	}
 
 	void EventSystem::UnregCursorAreaListener(CursorAreaEventsListener* listener)
@@ -313,7 +330,55 @@ namespace o2
 			return;
 
 		if (mInstance)
+		{
 			mInstance->mCurrentCursorAreaEventsLayer->mDragListeners.Add(listener);
+
+			for (auto record : mInstance->mDrawnListenersRecords)
+			{
+				if (record->listenersLayer == mInstance->mCurrentCursorAreaEventsLayer)
+					record->dragListeners.Add(listener);
+				else
+					record->complete = false;
+			}
+		}
+	}
+
+	void EventSystem::BeginDrawnListenersRecording(DrawnListenersRecord* record)
+	{
+		record->Clear();
+
+		if (!IsSingletonInitialzed())
+			return;
+
+		record->listenersLayer = mInstance->mCurrentCursorAreaEventsLayer;
+		mInstance->mDrawnListenersRecords.Add(record);
+	}
+
+	void EventSystem::EndDrawnListenersRecording(const RectF& clipRect)
+	{
+		if (!IsSingletonInitialzed() || mInstance->mDrawnListenersRecords.IsEmpty())
+			return;
+
+		auto record = mInstance->mDrawnListenersRecords.PopBack();
+		for (auto listener : record->cursorAreaListeners)
+			listener->mScissorRect = listener->mScissorRect.GetIntersection(clipRect);
+	}
+
+	void EventSystem::ReplayDrawnListeners(const DrawnListenersRecord& record)
+	{
+		for (auto listener : record.cursorAreaListeners)
+			DrawnCursorAreaListener(listener);
+
+		for (auto listener : record.dragListeners)
+			RegDragListener(listener);
+	}
+
+	void DrawnListenersRecord::Clear()
+	{
+		cursorAreaListeners.Clear();
+		dragListeners.Clear();
+		listenersLayer = nullptr;
+		complete = true;
 	}
 
 	void EventSystem::UnregDragListener(DragableObject* listener)
@@ -354,4 +419,34 @@ namespace o2
 		if (mInstance)
 			mInstance->mApplicationListeners.Remove(listener);
 	}
+
+	void EventSystem::RegEventQueue(IEventQueue* queue)
+	{
+		std::lock_guard<std::recursive_mutex> lock(GetEventQueuesMutex());
+		GetEventQueues().Add(queue);
+	}
+
+	void EventSystem::UnregEventQueue(IEventQueue* queue)
+	{
+		std::lock_guard<std::recursive_mutex> lock(GetEventQueuesMutex());
+		GetEventQueues().Remove(queue);
+	}
+
+	std::recursive_mutex& EventSystem::GetEventQueuesMutex()
+	{
+		static std::recursive_mutex mutex;
+		return mutex;
+	}
+
+	Vector<IEventQueue*>& EventSystem::GetEventQueues()
+	{
+		static Vector<IEventQueue*> queues;
+		return queues;
+	}
+
+	std::atomic<std::thread::id>& EventSystem::GetEventQueuesConsumerThread()
+	{
+		static std::atomic<std::thread::id> thread;
+		return thread;
+	}
 }
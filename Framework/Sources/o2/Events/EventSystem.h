@@ -6,6 +6,10 @@
 #include "o2/Utils/Types/Containers/Map.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 // Events system accessor macros
 #define o2Events o2::EventSystem::Instance()
 
@@ -15,9 +19,26 @@ namespace o2
 	class CursorAreaEventsListener;
 	class CursorEventsListener;
 	class DragableObject;
+	class IEventQueue;
 	class KeyboardEventsListener;
 	class ShortcutKeysListenersManager;
 
+	// -----------------------------------------------------------------------------------------
+	// Recorded drawn cursor area and drag listeners. Used for registering listeners of cached
+	// drawing as drawn without drawing them again
+	// -----------------------------------------------------------------------------------------
+	struct DrawnListenersRecord
+	{
+		Vector<CursorAreaEventsListener*> cursorAreaListeners; // Drawn cursor area listeners in drawing order
+		Vector<DragableObject*>           dragListeners;       // Drawn drag listeners in drawing order
+
+		CursorAreaEventListenersLayer* listenersLayer = nullptr; // Listeners layer, current at recording beginning
+		bool                           complete = true;          // False when listeners were drawn into other layer and can't be replayed
+
+		// Removes recorded listeners
+		void Clear();
+	};
+
 	// -----------------------
 	// Event processing system
 	// -----------------------
@@ -43,6 +64,19 @@ namespace o2
 		// Post update events
 		void PostUpdate();
 
+		// Processes events posted into registered events queues. Calling thread becomes consumer of queues.
+		// Queues destruction waits until processing finishes
+		void ProcessEventQueues();
+
+		// Begins recording of drawn listeners into record. Recordings can be nested, listeners are recorded into all of them
+		static void BeginDrawnListenersRecording(DrawnListenersRecord* record);
+
+		// Ends last began recording. Clips scissor rectangles of recorded listeners by clipRect
+		static void EndDrawnListenersRecording(const RectF& clipRect);
+
+		// Registers recorded listeners as drawn at this frame
+		static void ReplayDrawnListeners(const DrawnListenersRecord& record);
+
 	protected:
 		// Default constructor
 		EventSystem();
@@ -92,6 +126,8 @@ namespace o2
 
 		ShortcutKeysListenersManager* mShortcutEventsManager; // Shortcut events manager
 
+		Vector<DrawnListenersRecord*> mDrawnListenersRecords; // Current drawn listeners recordings stack
+
 	protected:
 		// Sets current cursor area events listeners layer
 		static void SetCursorAreaEventsListenersLayer(CursorAreaEventListenersLayer* layer);
@@ -126,12 +162,30 @@ namespace o2
 		// Unregistering application events listener
 		static void UnregApplicationListener(ApplicationEventsListener* listener);
 
+		// Registering events queue. Can be called from any thread and before event system creation
+		static void RegEventQueue(IEventQueue* queue);
+
+		// Unregistering events queue. Can be called from any thread
+		static void UnregEventQueue(IEventQueue* queue);
+
+		// Returns registered events queues list mutex. Held while queues are processed, recursive because events
+		// handlers can create and destroy queues
+		static std::recursive_mutex& GetEventQueuesMutex();
+
+		// Returns registered events queues, processed each frame. Not bound to event system instance, so queues
+		// created before event system are processed too. Must be accessed under GetEventQueuesMutex()
+		static Vector<IEventQueue*>& GetEventQueues();
+
+		// Returns thread which processes registered events queues. Empty id when event system isn't created
+		static std::atomic<std::thread::id>& GetEventQueuesConsumerThread();
+
 		friend class Application;
 		friend class ApplicationEventsListener;
 		friend class CursorAreaEventListenersLayer;
 		friend class CursorAreaEventsListener;
 		friend class CursorEventsListener;
 		friend class DragableObject;
+		friend class IEventQueue;
 		friend class KeyboardEventsListener;
 		friend class WndProcFunc;
 	};
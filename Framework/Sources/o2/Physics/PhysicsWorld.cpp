@@ -5,6 +5,7 @@
 #include "o2/Config/ProjectConfig.h"
 #include "o2/Scene/Physics/ICollider.h"
 #include "o2/Scene/Physics/RigidBody.h"
+#include "o2/Utils/Debug/Profiler.h"
 
 namespace o2
 {
@@ -41,6 +42,7 @@ namespace o2
 
 	void PhysicsWorld::Update(float dt)
 	{
+		PROFILE_FUNCTION();
 		mWorld.Step(dt, o2Config.physics.velocityIterations, o2Config.physics.positionIterations);
 	}
 
@@ -61,7 +63,9 @@ namespace o2
 
 	void PhysicsWorld::DrawDebug()
 	{
+		o2Render.BeginAALinesBatch();
 		mWorld.DrawDebugData();
+		o2Render.EndAALinesBatch();
 	}
 
 	bool PhysicsWorld::IsUpdatingPhysicsNow() const
@@ -101,14 +105,13 @@ namespace o2
 	{
 		float scale = o2Config.physics.scale;
 
-		Vector<Vec2F> points; 
-		points.Resize(vertexCount + 1);
+		mPoints.Resize(vertexCount + 1);
 		for (int i = 0; i < vertexCount; i++)
-			points[i] = Vec2F(vertices[i])*scale;
+			mPoints[i] = Vec2F(vertices[i])*scale;
 
-		points.Last() = Vec2F(vertices[0])*scale;
+		mPoints.Last() = Vec2F(vertices[0])*scale;
 
-		o2Render.DrawAALine(points, Color4(color.r, color.g, color.b, o2Config.physics.debugDrawAlpha));
+		o2Render.DrawAALine(mPoints, Color4(color.r, color.g, color.b, o2Config.physics.debugDrawAlpha));
 	}
 
 	void PhysicsDebugDraw::DrawSegment(const b2Vec2& p1, const b2Vec2& p2, const b2Color& color)
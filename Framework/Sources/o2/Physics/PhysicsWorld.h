@@ -1,6 +1,7 @@
 #pragma once
 
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
 #include "Box2D/Dynamics/b2World.h"
 #include "Box2D/Common/b2Draw.h"
 
@@ -58,5 +59,8 @@ namespace o2
 		void DrawSolidCircle(const b2Vec2& center, float32 radius, const b2Vec2& axis, const b2Color& color) override;
 		void DrawSolidPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color) override;
 		void DrawTransform(const b2Transform& xf) override;
+
+	protected:
+		Vector<Vec2F> mPoints; // Polygon points buffer
 	};
 }
@@ -0,0 +1,198 @@
+#include "o2/stdafx.h"
+#include "AALinesBatch.h"
+
+#include "o2/Render/Render.h"
+#include "o2/Render/Texture.h"
+#include "o2/Utils/Math/Geometry.h"
+
+namespace o2
+{
+	AALinesBatch::AALinesBatch()
+	{}
+
+	void AALinesBatch::SetTexture(LineType lineType, const TextureRef& texture)
+	{
+		Stream& stream = mStreams[(int)lineType];
+		stream.texture = texture;
+		stream.textureSize = texture ? (Vec2F)texture->GetSize() : Vec2F(1, 1);
+	}
+
+	void AALinesBatch::SetPixelSize(const Vec2F& size)
+	{
+		mPixelSize = size;
+	}
+
+	const Vec2F& AALinesBatch::GetPixelSize() const
+	{
+		return mPixelSize;
+	}
+
+	void AALinesBatch::SetLOD(float pixels)
+	{
+		mLOD = pixels;
+	}
+
+	float AALinesBatch::GetLOD() const
+	{
+		return mLOD;
+	}
+
+	void AALinesBatch::AddLine(const Vec2F& a, const Vec2F& b, const Color4& color /*= Color4::White()*/,
+							   float width /*= 1.0f*/, LineType lineType /*= LineType::Solid*/)
+	{
+		ULong dcolor = color.ABGR();
+		Vertex2 points[] = { Vertex2(a, dcolor, 0, 0), Vertex2(b, dcolor, 0, 0) };
+		AddPoints(points, 2, width, lineType);
+	}
+
+	void AALinesBatch::AddPolyLine(const Vec2F* points, int count, const Color4& color /*= Color4::White()*/,
+								   float width /*= 1.0f*/, LineType lineType /*= LineType::Solid*/)
+	{
+		ULong dcolor = color.ABGR();
+
+		// Colored points are placed into points buffer end. Space for decimation is reserved too, so buffer isn't
+		// reallocated while points are decimated
+		int offset = mPoints.Count();
+		mPoints.Reserve(offset + count*2);
+		mPoints.Resize(offset + count);
+		for (int i = 0; i < count; i++)
+			mPoints[offset + i] = Vertex2(points[i], dcolor, 0, 0);
+
+		AddPoints(mPoints.Data() + offset, count, width, lineType);
+		mPoints.Resize(offset);
+	}
+
+	void AALinesBatch::AddPolyLine(const Vertex2* points, int count, float width /*= 1.0f*/,
+								   LineType lineType /*= LineType::Solid*/)
+	{
+		AddPoints(points, count, width, lineType);
+	}
+
+	void AALinesBatch::Draw()
+	{
+		for (auto& stream : mStreams)
+		{
+			for (auto& chunk : stream.chunks)
+			{
+				o2Render.DrawBuffer(PrimitiveType::Polygon, stream.vertices.Data() + chunk.verticesBegin,
+									chunk.verticesCount, stream.indexes.Data() + chunk.indexesBegin,
+									chunk.indexesCount/3, stream.texture);
+			}
+		}
+
+		Clear();
+	}
+
+	void AALinesBatch::Clear()
+	{
+		for (auto& stream : mStreams)
+		{
+			stream.vertices.Clear();
+			stream.indexes.Clear();
+			stream.chunks.Clear();
+		}
+	}
+
+	bool AALinesBatch::IsEmpty() const
+	{
+		return mStreams[0].chunks.IsEmpty() && mStreams[1].chunks.IsEmpty();
+	}
+
+	int AALinesBatch::GetVerticesCount(LineType lineType) const
+	{
+		return mStreams[(int)lineType].vertices.Count();
+	}
+
+	int AALinesBatch::GetChunksCount(LineType lineType) const
+	{
+		return mStreams[(int)lineType].chunks.Count();
+	}
+
+	int AALinesBatch::GetChunkVerticesCount(LineType lineType, int idx) const
+	{
+		return mStreams[(int)lineType].chunks[idx].verticesCount;
+	}
+
+	int AALinesBatch::GetChunkIndexesCount(LineType lineType, int idx) const
+	{
+		return mStreams[(int)lineType].chunks[idx].indexesCount;
+	}
+
+	int AALinesBatch::DecimatePoints(const Vertex2* points, int count, const Vec2F& pixelSize, float lodPixels,
+									 Vertex2* output)
+	{
+		if (count == 0)
+			return 0;
+
+		Vec2F invPixelSize(1.0f/pixelSize.x, 1.0f/pixelSize.y);
+		float minSqrLength = lodPixels*lodPixels;
+
+		int res = 0;
+		output[res++] = points[0];
+
+		for (int i = 1; i < count; i++)
+		{
+			float sqrLength = (((Vec2F)points[i] - (Vec2F)output[res - 1])*invPixelSize).SqrLength();
+
+			if (sqrLength >= minSqrLength && sqrLength > 0.0f)
+				output[res++] = points[i];
+			else if (i == count - 1)
+			{
+				// Last point is kept instead of previous one, it must be reached exactly
+				if (res > 1)
+					output[res - 1] = points[i];
+				else if (sqrLength > 0.0f)
+					output[res++] = points[i];
+			}
+		}
+
+		return res;
+	}
+
+	void AALinesBatch::AddPoints(const Vertex2* points, int count, float width, LineType lineType)
+	{
+		if (count < 2)
+			return;
+
+		int offset = mPoints.Count();
+		mPoints.Resize(offset + count);
+		Vertex2* decimated = mPoints.Data() + offset;
+		count = DecimatePoints(points, count, mPixelSize, mLOD, decimated);
+
+		Stream& stream = mStreams[(int)lineType];
+
+		// Long poly lines are split into pieces, neighbor pieces share one point
+		for (int begin = 0; begin < count - 1; begin += mMaxPiecePoints - 1)
+		{
+			int piecePoints = Math::Min(count - begin, mMaxPiecePoints);
+			int pieceVertices = piecePoints*4;
+			int pieceIndexes = (piecePoints - 1)*18;
+
+			// Chunk is drawn by one buffer drawing, both vertices and indexes must fit into render buffers
+			if (stream.chunks.IsEmpty() || stream.chunks.Last().verticesCount + pieceVertices > mMaxChunkVertices ||
+				stream.chunks.Last().indexesCount + pieceIndexes > mMaxChunkIndexes)
+			{
+				Chunk chunk;
+				chunk.verticesBegin = stream.vertices.Count();
+				chunk.indexesBegin = stream.indexes.Count();
+				stream.chunks.Add(chunk);
+			}
+
+			Chunk& chunk = stream.chunks.Last();
+
+			int verticesBegin = stream.vertices.Count();
+			int indexesBegin = stream.indexes.Count();
+			stream.vertices.Resize(verticesBegin + pieceVertices);
+			stream.indexes.Resize(indexesBegin + pieceIndexes);
+
+			Geometry::TessellatePolyLine(decimated + begin, piecePoints, stream.vertices.Data() + verticesBegin,
+										 stream.indexes.Data() + indexesBegin, (UInt16)chunk.verticesCount,
+										 width, 0.5f, 0.5f, stream.textureSize, mPixelSize);
+
+			chunk.verticesCount += pieceVertices;
+			chunk.indexesCount += pieceIndexes;
+		}
+
+		mPoints.Resize(offset);
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "o2/Render/TextureRef.h"
+#include "o2/Utils/Math/Color.h"
+#include "o2/Utils/Math/Vertex2.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------------------------
+	// Anti-aliased lines batch. Poly lines are tessellated with joins into one vertex stream for each line type and
+	// drawn with few buffer drawings. Points closer than LOD distance in screen pixels are decimated, so line never
+	// has more segments than pixels it spans. Buffers are reused between drawings, no allocations after warm up
+	// -------------------------------------------------------------------------------------------------------------
+	class AALinesBatch
+	{
+	public:
+		// Default constructor
+		AALinesBatch();
+
+		// Sets line type texture. Dash pattern size is taken from texture size
+		void SetTexture(LineType lineType, const TextureRef& texture);
+
+		// Sets size of screen pixel in world units. Lines width and LOD are measured in pixels
+		void SetPixelSize(const Vec2F& size);
+
+		// Returns size of screen pixel in world units
+		const Vec2F& GetPixelSize() const;
+
+		// Sets minimal segment length in screen pixels. Shorter segments are merged
+		void SetLOD(float pixels);
+
+		// Returns minimal segment length in screen pixels
+		float GetLOD() const;
+
+		// Adds line from a to b
+		void AddLine(const Vec2F& a, const Vec2F& b, const Color4& color = Color4::White(), float width = 1.0f,
+					 LineType lineType = LineType::Solid);
+
+		// Adds poly line with color
+		void AddPolyLine(const Vec2F* points, int count, const Color4& color = Color4::White(), float width = 1.0f,
+						 LineType lineType = LineType::Solid);
+
+		// Adds poly line with colored vertices
+		void AddPolyLine(const Vertex2* points, int count, float width = 1.0f, LineType lineType = LineType::Solid);
+
+		// Draws all lines and clears batch
+		void Draw();
+
+		// Removes all lines
+		void Clear();
+
+		// Returns true when there are no lines
+		bool IsEmpty() const;
+
+		// Returns count of tessellated vertices of line type
+		int GetVerticesCount(LineType lineType) const;
+
+		// Returns count of buffer drawings of line type
+		int GetChunksCount(LineType lineType) const;
+
+		// Returns vertices count of line type buffer drawing by index
+		int GetChunkVerticesCount(LineType lineType, int idx) const;
+
+		// Returns indexes count of line type buffer drawing by index
+		int GetChunkIndexesCount(LineType lineType, int idx) const;
+
+		// Decimates points closer than lodPixels in screen pixels. First and last points are kept. Output must have
+		// place for count points. Returns count of output points
+		static int DecimatePoints(const Vertex2* points, int count, const Vec2F& pixelSize, float lodPixels,
+								  Vertex2* output);
+
+	protected:
+		static constexpr int mMaxChunkVertices = 0xffff;                // Maximum vertices count in one drawing, limited by 16 bit indexes
+		static constexpr int mMaxChunkIndexes = 0xffff;                 // Maximum indexes count in one drawing, limited by render index buffer
+		static constexpr int mMaxPiecePoints = mMaxChunkIndexes/18 + 1; // Maximum points count of tessellated piece, 18 indexes per segment
+
+		// --------------------------------------------
+		// Vertices range drawn with one buffer drawing
+		// --------------------------------------------
+		struct Chunk
+		{
+			int verticesBegin = 0; // First vertex index in stream
+			int verticesCount = 0; // Vertices count
+			int indexesBegin = 0;  // First index in stream
+			int indexesCount = 0;  // Indexes count
+		};
+
+		// ----------------------------------------------
+		// Tessellated lines of one line type and texture
+		// ----------------------------------------------
+		struct Stream
+		{
+			TextureRef      texture;                   // Line texture
+			Vec2F           textureSize = Vec2F(1, 1); // Line texture size
+			Vector<Vertex2> vertices;                  // Tessellated vertices
+			Vector<UInt16>  indexes;                   // Polygons indexes, relative to chunk begin
+			Vector<Chunk>   chunks;                    // Drawing chunks
+		};
+
+	protected:
+		Stream mStreams[2]; // Solid and dash lines streams
+
+		Vec2F mPixelSize = Vec2F(1, 1); // Size of screen pixel in world units
+		float mLOD = 1.0f;              // Minimal segment length in pixels
+
+		Vector<Vertex2> mPoints; // Decimated points buffer
+
+	protected:
+		// Decimates and tessellates points into line type stream
+		void AddPoints(const Vertex2* points, int count, float width, LineType lineType);
+	};
+}
@@ -12,6 +12,7 @@
 #include "Render/Texture.h"
 #include "Utils/Debug/Debug.h"
 #include "Utils/Debug/Log/LogStream.h"
+#include "Utils/Debug/Profiler.h"
 #include "Utils/Math/Geometry.h"
 #include "Utils/Math/Interpolation.h"
 #include "Application/Input.h"
@@ -64,6 +65,7 @@ namespace o2
 
 		InitializeFreeType();
 		InitializeLinesIndexBuffer();
+		InitializeSpriteInstancesBuffers();
 		InitializeLinesTextures();
 
 		mCurrentRenderTarget = TextureRef();
@@ -85,6 +87,7 @@ namespace o2
 		mSolidLineTexture = TextureRef::Null();
 		mDashLineTexture = TextureRef::Null();
 
+		DeinitializeSpriteInstancesBuffers();
 		DeinitializeFreeType();
 
 		mReady = false;
@@ -269,6 +272,8 @@ namespace o2
 		if (mLastDrawVertex < 1)
 			return;
 
+		PROFILE_FUNCTION();
+
 		static const GLenum primitiveType[3]{ GL_TRIANGLES, GL_TRIANGLES, GL_LINES };
 
         glBufferData(GL_ARRAY_BUFFER, mLastDrawVertex * sizeof(Vertex2), mVertexData, GL_DYNAMIC_DRAW);
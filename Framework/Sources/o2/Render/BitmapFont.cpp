@@ -83,18 +83,20 @@ namespace o2
 		}
 
 		Vec2F invTexSize(1.0f/mTexture->GetSize().x, 1.0f/mTexture->GetSize().y);
-		for (auto heightKV : mCharacters)
+		for (auto& heightKV : mCharacters)
 		{
-			for (auto charKV : heightKV.second)
+			heightKV.second.ForEach([&](Character& character)
 			{
-				charKV.second.mSize = charKV.second.mTexSrc.Size().InvertedY();
-				charKV.second.mTexSrc.left *= invTexSize.x;
-				charKV.second.mTexSrc.right *= invTexSize.x;
-				charKV.second.mTexSrc.top *= invTexSize.y;
-				charKV.second.mTexSrc.bottom *= invTexSize.y;
-			}
+				character.mSize = character.mTexSrc.Size().InvertedY();
+				character.mTexSrc.left *= invTexSize.x;
+				character.mTexSrc.right *= invTexSize.x;
+				character.mTexSrc.top *= invTexSize.y;
+				character.mTexSrc.bottom *= invTexSize.y;
+			});
 		}
 
+		OnCharactersChanged();
+
 		mReady = true;
 		return true;
 	}
@@ -114,9 +116,9 @@ namespace o2
 		return mLineHeight;
 	}
 
-	const Font::Character& BitmapFont::GetCharacter(UInt16 id, int height)
+	const Font::CharactersTable* BitmapFont::GetCharactersTable(int height) const
 	{
-		return Font::GetCharacter(id, 0);
+		return Font::GetCharactersTable(0);
 	}
 
 }
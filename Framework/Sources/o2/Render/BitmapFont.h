@@ -28,12 +28,13 @@ namespace o2
 		// Returns line height in pixels for font with size
 		float GetLineHeightPx(int height) const;
 
-		// Returns character constant reference by id
-		const Character& GetCharacter(UInt16 id, int height);
-
 	protected:
 		String mFileName;   // Source file name
 		float  mBaseHeight; // Source font height
 		float  mLineHeight; // Source font line height
+
+	protected:
+		// Returns characters table. Bitmap font has characters of one height for all sizes
+		const CharactersTable* GetCharactersTable(int height) const override;
 	};
 }
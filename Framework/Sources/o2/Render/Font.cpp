@@ -5,22 +5,27 @@
 
 namespace o2
 {
+	UInt Font::mCharactersVersionsCounter = 0;
+
 	Font::Font():
-		mReady(false)
+		mReady(false), mCharactersVersion(++mCharactersVersionsCounter)
 	{
-		o2Render.mFonts.Add(this);
+		if (Render::IsSingletonInitialzed())
+			o2Render.mFonts.Add(this);
 	}
 
 	Font::Font(const Font& font):
-		mCharacters(font.mCharacters), mTexture(font.mTexture), 
+		mCharacters(font.mCharacters), mCharactersVersion(++mCharactersVersionsCounter), mTexture(font.mTexture),
 		mTextureSrcRect(font.mTextureSrcRect), mReady(font.mReady)
 	{
-		o2Render.mFonts.Add(this);
+		if (Render::IsSingletonInitialzed())
+			o2Render.mFonts.Add(this);
 	}
 
 	Font::~Font()
 	{
-		o2Render.mFonts.Remove(this);
+		if (Render::IsSingletonInitialzed())
+			o2Render.mFonts.Remove(this);
 	}
 
 	float Font::GetHeightPx(int height) const
@@ -35,12 +40,10 @@ namespace o2
 
 	const Font::Character& Font::GetCharacter(UInt16 id, int height)
 	{
-		auto fndHeight = mCharacters.find(height);
-		if (fndHeight != mCharacters.End())
+		if (auto table = GetCharactersTable(height))
 		{
-			auto fndChar = fndHeight->second.find(id);
-			if (fndChar != fndHeight->second.End())
-				return fndChar->second;
+			if (auto character = table->Find(id))
+				return *character;
 		}
 
 		static Character empty;
@@ -55,13 +58,108 @@ namespace o2
 		return String();
 	}
 
+	const Font::CharactersTable* Font::GetCharactersTable(int height) const
+	{
+		return mCharacters.TryGetValuePtr(height);
+	}
+
 	void Font::AddCharacter(const Character& character)
 	{
-		mCharacters[character.mHeight][character.mId] = character;
+		mCharacters[character.mHeight].Add(character);
+		OnCharactersChanged();
+	}
+
+	void Font::OnCharactersChanged()
+	{
+		mCharactersVersion = ++mCharactersVersionsCounter;
 	}
 
 	bool Font::Character::operator==(const Character& other) const
 	{
 		return mId == other.mId && mHeight == other.mHeight;
 	}
+
+	Font::CharactersTable::CharactersTable()
+	{}
+
+	Font::CharactersTable::CharactersTable(const CharactersTable& other)
+	{
+		*this = other;
+	}
+
+	Font::CharactersTable::CharactersTable(CharactersTable&& other)
+	{
+		*this = std::move(other);
+	}
+
+	Font::CharactersTable::~CharactersTable()
+	{
+		Clear();
+	}
+
+	Font::CharactersTable& Font::CharactersTable::operator=(const CharactersTable& other)
+	{
+		if (&other == this)
+			return *this;
+
+		Clear();
+
+		for (int i = 0; i < mPagesCount; i++)
+		{
+			if (other.mPages[i])
+				mPages[i] = mnew Page(*other.mPages[i]);
+		}
+
+		return *this;
+	}
+
+	Font::CharactersTable& Font::CharactersTable::operator=(CharactersTable&& other)
+	{
+		if (&other == this)
+			return *this;
+
+		Clear();
+
+		for (int i = 0; i < mPagesCount; i++)
+		{
+			mPages[i] = other.mPages[i];
+			other.mPages[i] = nullptr;
+		}
+
+		return *this;
+	}
+
+	void Font::CharactersTable::Add(const Character& character)
+	{
+		Page*& page = mPages[character.mId/mPageSize];
+		if (!page)
+			page = mnew Page();
+
+		page->characters[character.mId%mPageSize] = character;
+		page->added[character.mId%mPageSize] = true;
+	}
+
+	void Font::CharactersTable::ForEach(const Function<void(Character&)>& func)
+	{
+		for (auto page : mPages)
+		{
+			if (!page)
+				continue;
+
+			for (int i = 0; i < mPageSize; i++)
+			{
+				if (page->added[i])
+					func(page->characters[i]);
+			}
+		}
+	}
+
+	void Font::CharactersTable::Clear()
+	{
+		for (auto& page : mPages)
+		{
+			delete page;
+			page = nullptr;
+		}
+	}
 }
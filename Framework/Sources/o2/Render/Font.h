@@ -13,6 +13,7 @@ extern "C"
 
 #include "o2/Render/TextureRef.h"
 #include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Delegates.h"
 #include "o2/Utils/Math/Rect.h"
@@ -32,6 +33,7 @@ namespace o2
 	{
 	protected:
 		struct Character;
+		class CharactersTable;
 
 	public:
 		Function<void()> onCharactersRebuilt;
@@ -77,10 +79,64 @@ namespace o2
 			bool operator==(const Character& other) const;
 		};
 
+		// -----------------------------------------------------------------------------------------------
+		// Characters table of one height. Characters are grouped in pages by high byte of id, so search is
+		// two array indexing. Page is allocated when first character from it is added
+		// -----------------------------------------------------------------------------------------------
+		class CharactersTable
+		{
+		public:
+			// Default constructor
+			CharactersTable();
+
+			// Copy-constructor
+			CharactersTable(const CharactersTable& other);
+
+			// Move-constructor
+			CharactersTable(CharactersTable&& other);
+
+			// Destructor
+			~CharactersTable();
+
+			// Copy-operator
+			CharactersTable& operator=(const CharactersTable& other);
+
+			// Move-operator
+			CharactersTable& operator=(CharactersTable&& other);
+
+			// Returns character by id, nullptr when it isn't added
+			const Character* Find(UInt16 id) const;
+
+			// Adds or replaces character
+			void Add(const Character& character);
+
+			// Invokes function for each added character
+			void ForEach(const Function<void(Character&)>& func);
+
+			// Removes all characters
+			void Clear();
+
+		protected:
+			static const int mPageSize = 256;               // Characters count in page
+			static const int mPagesCount = 65536/mPageSize; // Pages count for all ids
+
+			// Characters page
+			struct Page
+			{
+				Character characters[mPageSize]; // Characters by low byte of id
+				bool      added[mPageSize] = {}; // True for added characters
+			};
+
+			Page* mPages[mPagesCount] = {}; // Pages by high byte of id
+		};
+
 	protected:
+		static UInt mCharactersVersionsCounter; // Last given characters version, shared between all fonts
+
 		Vector<FontRef*>  mRefs; // Array of reference to this font
 
-		Map<int, Map<UInt16, Character>> mCharacters; // Characters map, int - height, uint16 - id
+		HashMap<int, CharactersTable> mCharacters;        // Characters tables by height
+		UInt                          mCharactersVersion; // Changes with any change of characters, unique between fonts
 
 		TextureRef mTexture;        // Texture
 		RectI      mTextureSrcRect; // Texture source rectangle
@@ -88,11 +144,27 @@ namespace o2
 		bool mReady; // True when font is ready to use
 
 	protected:
+		// Returns characters table for height, nullptr when there are no characters with this height
+		virtual const CharactersTable* GetCharactersTable(int height) const;
+
 		// Adds character and registers in cache map
 		void AddCharacter(const Character& character);
 
+		// Updates characters version. Must be called on any characters change, so cached layouts are not used
+		void OnCharactersChanged();
+
 		friend class Text;
+		friend class TextLayoutCache;
 		friend class FontRef;
 		friend class Render;
 	};
+
+	inline const Font::Character* Font::CharactersTable::Find(UInt16 id) const
+	{
+		const Page* page = mPages[id/mPageSize];
+		if (!page || !page->added[id%mPageSize])
+			return nullptr;
+
+		return &page->characters[id%mPageSize];
+	}
 }
@@ -21,10 +21,12 @@ namespace o2
 {
 Render::Render()
 {
+    InitializeSpriteInstancesBuffers();
 }
 
 Render::~Render()
 {
+    DeinitializeSpriteInstancesBuffers();
 }
 
 void
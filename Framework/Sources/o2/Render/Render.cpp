@@ -6,6 +6,7 @@
 #include "o2/Render/Font.h"
 #include "o2/Render/Mesh.h"
 #include "o2/Render/Sprite.h"
+#include "o2/Render/SpritesBatch.h"
 #include "o2/Render/Texture.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
@@ -33,6 +34,31 @@ namespace o2
 		}
 	}
 
+	void Render::InitializeSpriteInstancesBuffers()
+	{
+		mSpriteInstancesVertexData = mnew Vertex2[mSpriteInstancesPerDraw*4];
+		mQuadsIndexData = mnew UInt16[mSpriteInstancesPerDraw*6];
+
+		for (UInt i = 0; i < mSpriteInstancesPerDraw; i++)
+		{
+			mQuadsIndexData[i*6] = i*4;
+			mQuadsIndexData[i*6 + 1] = i*4 + 1;
+			mQuadsIndexData[i*6 + 2] = i*4 + 2;
+			mQuadsIndexData[i*6 + 3] = i*4;
+			mQuadsIndexData[i*6 + 4] = i*4 + 2;
+			mQuadsIndexData[i*6 + 5] = i*4 + 3;
+		}
+	}
+
+	void Render::DeinitializeSpriteInstancesBuffers()
+	{
+		delete[] mSpriteInstancesVertexData;
+		delete[] mQuadsIndexData;
+
+		mSpriteInstancesVertexData = nullptr;
+		mQuadsIndexData = nullptr;
+	}
+
 	void Render::InitializeLinesTextures()
 	{
 		mSolidLineTexture = TextureRef::Null();
@@ -41,6 +67,9 @@ namespace o2
 		bitmap.Fill(Color4(255, 255, 255, 255));
 		bitmap.FillRect(0, 32, 16, 0, Color4(255, 255, 255, 0));
 		mDashLineTexture = new Texture(&bitmap);
+
+		mAALinesBatch.SetTexture(LineType::Solid, mSolidLineTexture);
+		mAALinesBatch.SetTexture(LineType::Dash, mDashLineTexture);
 	}
 
 	void Render::InitializeFreeType()
@@ -194,13 +223,21 @@ namespace o2
 	void Render::DrawAALine(const Vector<Vec2F>& points, const Color4& color /*= Color4::White()*/,
 							float width /*= 1.0f*/, LineType lineType /*= LineType::Solid*/)
 	{
-		ULong dcolor = color.ABGR();
-		Vertex2* v = mnew Vertex2[points.Count()];
-		for (int i = 0; i < points.Count(); i++)
-			v[i] = Vertex2(points[i], dcolor, 0, 0);
+		if (points.Count() < 2)
+			return;
 
-		DrawAAPolyLine(v, points.Count(), width, lineType);
-		delete[] v;
+		DrawAALine(&points[0], points.Count(), color, width, lineType);
+	}
+
+	void Render::DrawAALine(const Vec2F* points, int count, const Color4& color /*= Color4::White()*/,
+							float width /*= 1.0f*/, LineType lineType /*= LineType::Solid*/)
+	{
+		mAALinesBatch.SetPixelSize(mInvViewScale);
+		mAALinesBatch.SetLOD(mAALinesLOD);
+		mAALinesBatch.AddPolyLine(points, count, color, width - 0.5f, lineType);
+
+		if (mAALinesBatchDepth == 0)
+			mAALinesBatch.Draw();
 	}
 
 	void Render::DrawAAArrow(const Vec2F& a, const Vec2F& b, const Color4& color /*= Color4::White()*/,
@@ -267,7 +304,8 @@ namespace o2
 							  int segCount /*= 20*/,
 							  float width /*= 1.0f*/, LineType lineType /*= LineType::Solid*/)
 	{
-		Vertex2* v = mnew Vertex2[segCount + 1];
+		mAALineVertices.Resize(segCount + 1);
+		Vertex2* v = mAALineVertices.Data();
 		ULong dcolor = color.ABGR();
 
 		float angleSeg = 2.0f*Math::PI() / (float)(segCount - 1);
@@ -278,7 +316,6 @@ namespace o2
 		}
 
 		DrawAAPolyLine(v, segCount + 1, width, lineType);
-		delete[] v;
 	}
 
 	void Render::DrawAABezierCurve(const Vec2F& p1, const Vec2F& p2, const Vec2F& p3, const Vec2F& p4,
@@ -557,6 +594,18 @@ namespace o2
 				   mesh->indexes, mesh->polyCount, mesh->mTexture);
 	}
 
+	void Render::DrawSpriteInstances(const SpriteInstance* instances, UInt count, const TextureRef& texture)
+	{
+		for (UInt begin = 0; begin < count; begin += mSpriteInstancesPerDraw)
+		{
+			UInt drawCount = Math::Min(count - begin, mSpriteInstancesPerDraw);
+
+			SpritesBatch::ExpandInstances(instances + begin, drawCount, mSpriteInstancesVertexData);
+			DrawBuffer(PrimitiveType::Polygon, mSpriteInstancesVertexData, drawCount*4, mQuadsIndexData, drawCount*2,
+					   texture);
+		}
+	}
+
 	void Render::DrawMeshWire(Mesh* mesh, const Color4& color /*= Color4::White()*/)
 	{
 		auto dcolor = color.ABGR();
@@ -587,28 +636,42 @@ namespace o2
 								LineType lineType /*= LineType::Solid*/,
 								bool scaleToScreenSpace /*= true*/)
 	{
-		static Mesh mesh(mSolidLineTexture, 1024, 1024);
-
-		TextureRef texture = lineType == LineType::Solid ? mSolidLineTexture : mDashLineTexture;
-		Vec2I texSize = lineType == LineType::Solid ? Vec2I(1, 1) : mDashLineTexture->GetSize();
-
 		if (scaleToScreenSpace)
 		{
-			Geometry::CreatePolyLineMesh(vertices, count,
-										 mesh.vertices, mesh.vertexCount, mesh.mMaxVertexCount,
-										 mesh.indexes, mesh.polyCount, mesh.mMaxPolyCount,
-										 width - 0.5f, 0.5f, 0.5f, texSize, mInvViewScale);
+			mAALinesBatch.SetPixelSize(mInvViewScale);
+			mAALinesBatch.SetLOD(mAALinesLOD);
+			mAALinesBatch.AddPolyLine(vertices, count, width - 0.5f, lineType);
 		}
 		else
 		{
-			Geometry::CreatePolyLineMesh(vertices, count,
-										 mesh.vertices, mesh.vertexCount, mesh.mMaxVertexCount,
-										 mesh.indexes, mesh.polyCount, mesh.mMaxPolyCount,
-										 width, 0.5f, 0.5f, texSize, Vec2F(1, 1));
+			mAALinesBatch.SetPixelSize(Vec2F(1, 1));
+			mAALinesBatch.SetLOD(0.0f);
+			mAALinesBatch.AddPolyLine(vertices, count, width, lineType);
 		}
 
-		mesh.SetTexture(texture);
-		mesh.Draw();
+		if (mAALinesBatchDepth == 0)
+			mAALinesBatch.Draw();
+	}
+
+	void Render::BeginAALinesBatch()
+	{
+		mAALinesBatchDepth++;
+	}
+
+	void Render::EndAALinesBatch()
+	{
+		if (mAALinesBatchDepth == 0)
+			return;
+
+		mAALinesBatchDepth--;
+
+		if (mAALinesBatchDepth == 0)
+			mAALinesBatch.Draw();
+	}
+
+	void Render::SetAALinesLOD(float pixels)
+	{
+		mAALinesLOD = pixels;
 	}
 
 	TextureRef Render::GetRenderTexture() const
@@ -19,6 +19,7 @@ extern "C"
 #include "o2/Render/Android/RenderBase.h"
 #endif
 
+#include "o2/Render/AALinesBatch.h"
 #include "o2/Render/Camera.h"
 #include "o2/Render/TextureRef.h"
 #include "o2/Utils/Math/Vertex2.h"
@@ -33,6 +34,7 @@ namespace o2
 	class Font;
 	class Sprite;
 	class CursorAreaEventListenersLayer;
+	struct SpriteInstance;
 
 	// ------------------
 	// 2D Graphics render
@@ -173,6 +175,10 @@ namespace o2
 		void DrawAALine(const Vector<Vec2F>& points, const Color4& color = Color4::White(),
 						float width = 1.0f, LineType lineType = LineType::Solid);
 
+		// Draws anti-aliased poly line with color
+		void DrawAALine(const Vec2F* points, int count, const Color4& color = Color4::White(),
+						float width = 1.0f, LineType lineType = LineType::Solid);
+
 		// Draws anti-aliased rect frame with color
 		void DrawAARectFrame(const Vec2F& minp, const Vec2F& maxp, const Color4& color = Color4::White(),
 							 float width = 1.0f, LineType lineType = LineType::Solid);
@@ -204,6 +210,16 @@ namespace o2
 									const Color4& color = Color4::White(), const Vec2F& arrowSize = Vec2F(10, 10),
 									float width = 1.0f, LineType lineType = LineType::Solid);
 
+		// Begins anti-aliased lines batching. Lines are collected until EndAALinesBatch() and drawn together over other
+		// drawings. Batching can be nested, lines are drawn at last ending. Camera must not change inside batching
+		void BeginAALinesBatch();
+
+		// Ends anti-aliased lines batching and draws collected lines
+		void EndAALinesBatch();
+
+		// Sets anti-aliased lines level of detail: minimal segment length in screen pixels
+		void SetAALinesLOD(float pixels);
+
 		// Beginning render to stencil buffer
 		void BeginRenderToStencilBuffer();
 
@@ -253,6 +269,9 @@ namespace o2
 		void DrawBuffer(PrimitiveType primitiveType, Vertex2* vertices, UInt verticesCount,
 						UInt16* indexes, UInt elementsCount, const TextureRef& texture);
 
+		// Draws simple sprites quads from compact instances records with specified texture
+		void DrawSpriteInstances(const SpriteInstance* instances, UInt count, const TextureRef& texture);
+
 		// Draws mesh wire
 		void DrawMeshWire(Mesh* mesh, const Color4& color = Color4::White());
 
@@ -328,6 +347,15 @@ namespace o2
 		TextureRef mSolidLineTexture;   // Solid line texture
 		TextureRef mDashLineTexture;    // Dash line texture
 
+		AALinesBatch    mAALinesBatch;          // Anti-aliased lines batch. Lines are drawn immediately when not batching
+		int             mAALinesBatchDepth = 0; // Anti-aliased lines batching nesting depth
+		float           mAALinesLOD = 1.0f;     // Minimal anti-aliased line segment length in screen pixels
+		Vector<Vertex2> mAALineVertices;        // Anti-aliased line vertices buffer
+
+		static constexpr UInt mSpriteInstancesPerDraw = 4096;       // Maximum sprite instances count in one buffer drawing
+		Vertex2*              mSpriteInstancesVertexData = nullptr; // Expanded sprite instances vertices buffer
+		UInt16*               mQuadsIndexData = nullptr;            // Quads index buffer, two polygons for each four vertices
+
 		bool mReady; // True, if render system initialized
 
 	protected:
@@ -340,6 +368,12 @@ namespace o2
 		// Initializes index buffer for drawing lines - pairs of lines beginnings and ends
 		void InitializeLinesIndexBuffer();
 
+		// Initializes quads index buffer and vertex buffer for expanding sprite instances
+		void InitializeSpriteInstancesBuffers();
+
+		// Frees quads index buffer and sprite instances vertex buffer
+		void DeinitializeSpriteInstancesBuffers();
+
 		// Initializeslines textures
 		void InitializeLinesTextures();
 
@@ -397,6 +397,24 @@ namespace o2
 		return 0;
 	}
 
+	bool Sprite::GetInstance(SpriteInstance& instance) const
+	{
+		if (mMode != SpriteMode::Default)
+			return false;
+
+		for (int i = 1; i < 4; i++)
+		{
+			if (mCornersColors[i] != mCornersColors[0])
+				return false;
+		}
+
+		instance.basis = mTransform;
+		instance.uv = SpriteInstance::GetTextureUV(mTextureSrcRect, mMesh->mTexture);
+		instance.color = (mColor*mCornersColors[0]).ABGR();
+
+		return true;
+	}
+
 	void Sprite::NormalizeSize()
 	{
 		SetSize(mTextureSrcRect.Size());
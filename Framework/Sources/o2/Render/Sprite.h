@@ -3,6 +3,7 @@
 #include "o2/Assets/Types/ImageAsset.h"
 #include "o2/Render/Mesh.h"
 #include "o2/Render/RectDrawable.h"
+#include "o2/Render/SpritesBatch.h"
 #include "o2/Render/TextureRef.h"
 #include "o2/Utils/Math/Border.h"
 
@@ -167,6 +168,10 @@ namespace o2
 		// Returns atlas asset id (returns 0 when sprite is not from atlas)
 		UID GetAtlasAssetId() const;
 
+		// Fills compact instance record for drawing in sprites batch. Returns false when sprite can't be drawn as
+		// one quad: it's mode isn't default or corners colors are different
+		bool GetInstance(SpriteInstance& instance) const;
+
 		// Sets size by texture source rectangle size
 		void NormalizeSize();
 
@@ -313,6 +318,7 @@ CLASS_METHODS_META(o2::Sprite)
 	PUBLIC_FUNCTION(ImageAssetRef, GetImageAsset);
 	PUBLIC_FUNCTION(String, GetImageName);
 	PUBLIC_FUNCTION(UID, GetAtlasAssetId);
+	PUBLIC_FUNCTION(bool, GetInstance, SpriteInstance&);
 	PUBLIC_FUNCTION(void, NormalizeSize);
 	PUBLIC_FUNCTION(void, NormalizeAspectByWidth);
 	PUBLIC_FUNCTION(void, NormalizeAspectByHeight);
@@ -0,0 +1,141 @@
+#include "o2/stdafx.h"
+#include "SpritesBatch.h"
+
+#include "o2/Render/Render.h"
+#include "o2/Render/Texture.h"
+
+namespace o2
+{
+	SpriteInstance::SpriteInstance()
+	{}
+
+	SpriteInstance::SpriteInstance(const Basis& basis, const RectF& uv, const Color4& color /*= Color4::White()*/):
+		basis(basis), uv(uv), color(color.ABGR())
+	{}
+
+	bool SpriteInstance::operator==(const SpriteInstance& other) const
+	{
+		return basis == other.basis && uv == other.uv && color == other.color;
+	}
+
+	RectF SpriteInstance::GetTextureUV(const RectI& srcRect, const TextureRef& texture)
+	{
+		Vec2F invTexSize(1.0f, 1.0f);
+		if (texture)
+			invTexSize.Set(1.0f/texture->GetSize().x, 1.0f/texture->GetSize().y);
+
+		// Texture source rectangle is in image coordinates with y axis directed down, so it's bottom is upper
+		// side of quad. Setting fields directly, rectangle constructor reorders them
+		RectF uv;
+		uv.left = srcRect.left*invTexSize.x;
+		uv.right = srcRect.right*invTexSize.x;
+		uv.top = 1.0f - srcRect.bottom*invTexSize.y;
+		uv.bottom = 1.0f - srcRect.top*invTexSize.y;
+
+		return uv;
+	}
+
+	SpritesBatch::SpritesBatch(TextureRef texture /*= TextureRef()*/):
+		mTexture(texture)
+	{}
+
+	void SpritesBatch::Draw()
+	{
+		if (!mInstances.IsEmpty())
+			o2Render.DrawSpriteInstances(mInstances.Data(), mInstances.Count(), mTexture);
+
+		OnDrawn();
+	}
+
+	void SpritesBatch::SetTexture(TextureRef texture)
+	{
+		mTexture = texture;
+	}
+
+	TextureRef SpritesBatch::GetTexture() const
+	{
+		return mTexture;
+	}
+
+	RectF SpritesBatch::GetTextureUV(const RectI& srcRect) const
+	{
+		return SpriteInstance::GetTextureUV(srcRect, mTexture);
+	}
+
+	int SpritesBatch::Add(const SpriteInstance& instance)
+	{
+		mInstances.Add(instance);
+		return mInstances.Count() - 1;
+	}
+
+	int SpritesBatch::Add(const Basis& basis, const RectI& srcRect, const Color4& color /*= Color4::White()*/)
+	{
+		return Add(SpriteInstance(basis, GetTextureUV(srcRect), color));
+	}
+
+	void SpritesBatch::Set(int idx, const SpriteInstance& instance)
+	{
+		mInstances[idx] = instance;
+	}
+
+	const SpriteInstance& SpritesBatch::Get(int idx) const
+	{
+		return mInstances[idx];
+	}
+
+	void SpritesBatch::Remove(int idx)
+	{
+		if (idx != mInstances.Count() - 1)
+			mInstances[idx] = mInstances.Last();
+
+		mInstances.PopBack();
+	}
+
+	void SpritesBatch::Clear()
+	{
+		mInstances.Clear();
+	}
+
+	void SpritesBatch::Reserve(int count)
+	{
+		mInstances.Reserve(count);
+	}
+
+	int SpritesBatch::GetCount() const
+	{
+		return mInstances.Count();
+	}
+
+	Vector<SpriteInstance>& SpritesBatch::GetInstances()
+	{
+		return mInstances;
+	}
+
+	const Vector<SpriteInstance>& SpritesBatch::GetInstances() const
+	{
+		return mInstances;
+	}
+
+	void SpritesBatch::ExpandInstances(const SpriteInstance* instances, UInt count, Vertex2* vertices)
+	{
+		// Plain arithmetic without temporary vectors, compiler keeps it in registers and vectorizes
+		for (UInt i = 0; i < count; i++)
+		{
+			const SpriteInstance& instance = instances[i];
+			Vertex2* v = vertices + i*4;
+
+			float ox = instance.basis.origin.x, oy = instance.basis.origin.y;
+			float xx = instance.basis.xv.x, xy = instance.basis.xv.y;
+			float yx = instance.basis.yv.x, yy = instance.basis.yv.y;
+
+			float uvLeft = instance.uv.left, uvRight = instance.uv.right;
+			float uvUp = instance.uv.top, uvDown = instance.uv.bottom;
+			ULong color = instance.color;
+
+			v[0].x = ox + yx;      v[0].y = oy + yy;      v[0].z = 1.0f; v[0].color = color; v[0].tu = uvLeft;  v[0].tv = uvUp;
+			v[1].x = ox + yx + xx; v[1].y = oy + yy + xy; v[1].z = 1.0f; v[1].color = color; v[1].tu = uvRight; v[1].tv = uvUp;
+			v[2].x = ox + xx;      v[2].y = oy + xy;      v[2].z = 1.0f; v[2].color = color; v[2].tu = uvRight; v[2].tv = uvDown;
+			v[3].x = ox;           v[3].y = oy;           v[3].z = 1.0f; v[3].color = color; v[3].tu = uvLeft;  v[3].tv = uvDown;
+		}
+	}
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "o2/Render/IDrawable.h"
+#include "o2/Render/TextureRef.h"
+#include "o2/Utils/Math/Basis.h"
+#include "o2/Utils/Math/Color.h"
+#include "o2/Utils/Math/Vertex2.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------------------
+	// Compact sprite record: quad basis, texture coordinates and color. Basis origin corner gets left-bottom
+	// texture coordinates, opposite corner gets right-top. Expanded to vertices by render while drawing
+	// -------------------------------------------------------------------------------------------------------
+	struct SpriteInstance
+	{
+		Basis basis;                // Quad transformation
+		RectF uv;                   // Texture coordinates
+		ULong color = 0xffffffff;   // Color in ABGR format
+
+	public:
+		// Default constructor
+		SpriteInstance();
+
+		// Constructor from basis, texture coordinates and color
+		SpriteInstance(const Basis& basis, const RectF& uv, const Color4& color = Color4::White());
+
+		// Equals operator
+		bool operator==(const SpriteInstance& other) const;
+
+		// Returns texture coordinates for texture source rectangle in pixels
+		static RectF GetTextureUV(const RectI& srcRect, const TextureRef& texture);
+	};
+
+	// --------------------------------------------------------------------------------------------------------
+	// Batch of simple textured quads with one texture. Doesn't keep mesh for each sprite, only compact
+	// instances records, which are expanded into render vertex buffer when drawing. Use it for tile maps,
+	// bullets and other big amounts of default mode sprites
+	// --------------------------------------------------------------------------------------------------------
+	class SpritesBatch: public virtual IDrawable
+	{
+	public:
+		// Constructor
+		SpritesBatch(TextureRef texture = TextureRef());
+
+		// Draws all instances
+		void Draw() override;
+
+		// Sets texture
+		void SetTexture(TextureRef texture);
+
+		// Returns texture
+		TextureRef GetTexture() const;
+
+		// Returns texture coordinates for texture source rectangle in pixels
+		RectF GetTextureUV(const RectI& srcRect) const;
+
+		// Adds instance, returns its index
+		int Add(const SpriteInstance& instance);
+
+		// Adds instance with texture source rectangle in pixels, returns its index
+		int Add(const Basis& basis, const RectI& srcRect, const Color4& color = Color4::White());
+
+		// Sets instance by index
+		void Set(int idx, const SpriteInstance& instance);
+
+		// Returns instance by index
+		const SpriteInstance& Get(int idx) const;
+
+		// Removes instance by index. Last instance is moved to its place
+		void Remove(int idx);
+
+		// Removes all instances
+		void Clear();
+
+		// Reserves memory for instances
+		void Reserve(int count);
+
+		// Returns instances count
+		int GetCount() const;
+
+		// Returns instances
+		Vector<SpriteInstance>& GetInstances();
+
+		// Returns instances
+		const Vector<SpriteInstance>& GetInstances() const;
+
+		// Expands instances into vertices, four for each instance in order: left top, right top, right bottom,
+		// left bottom. Vertices buffer must have place for count*4 vertices
+		static void ExpandInstances(const SpriteInstance* instances, UInt count, Vertex2* vertices);
+
+	protected:
+		TextureRef             mTexture;   // Instances texture
+		Vector<SpriteInstance> mInstances; // Instances records
+	};
+}
@@ -4,6 +4,7 @@
 #include "o2/Assets/Assets.h"
 #include "o2/Render/Mesh.h"
 #include "o2/Render/Render.h"
+#include "o2/Render/TextLayoutCache.h"
 
 namespace o2
 {
@@ -475,14 +476,29 @@ namespace o2
 		mSymbolsSet.Move(bas.origin);
 	}
 
+	TextLayoutCache& Text::GetLayoutCache()
+	{
+		static TextLayoutCache cache;
+		return cache;
+	}
+
 	void Text::SymbolsSet::Initialize(FontRef font, const WString& text, int height, const Vec2F& position, const Vec2F& areaSize,
 									  HorAlign horAlign, VerAlign verAlign, bool wordWrap, bool dotsEngings,
 									  float charsDistCoef, float linesDistCoef)
+	{
+		GetLayoutCache().Initialize(*this, font, text, height, position, areaSize, horAlign, verAlign, wordWrap, dotsEngings,
+									charsDistCoef, linesDistCoef);
+	}
+
+	void Text::SymbolsSet::InitializeUncached(FontRef font, const WString& text, int height, const Vec2F& position,
+											  const Vec2F& areaSize, HorAlign horAlign, VerAlign verAlign, bool wordWrap,
+											  bool dotsEngings, float charsDistCoef, float linesDistCoef,
+											  Vector<Vec2F>* linesOrigins /*= nullptr*/)
 	{
 		mFont = font;
 		mText = text;
 		mHeight = height;
-		mPosition = Vec2F(Math::Round(position.x), Math::Round(position.y));
+		mPosition = position;
 		mAreaSize = areaSize;
 		mRealSize = Vec2F();
 		mHorAlign = horAlign;
@@ -495,6 +511,9 @@ namespace o2
 		mLines.Clear();
 		int textLen = mText.Length();
 
+		if (linesOrigins)
+			linesOrigins->Clear();
+
 		if (textLen == 0)
 			return;
 
@@ -505,20 +524,29 @@ namespace o2
 		Line* curLine = &mLines.Last();
 		curLine->mSize.y = fontHeight;
 
-		float dotsSize = mFont->GetCharacter('.', mHeight).mAdvance*3.0f;
+		// Characters are searched in height table directly, without searching table for each character
+		static Font::Character emptyCharacter;
+		const Font::CharactersTable* charactersTable = mFont->GetCharactersTable(mHeight);
+		auto getCharacter = [&](UInt16 id) -> const Font::Character&
+		{
+			const Font::Character* character = charactersTable ? charactersTable->Find(id) : nullptr;
+			return character ? *character : emptyCharacter;
+		};
+
+		float dotsSize = getCharacter('.').mAdvance*3.0f;
 
 		Vec2F fullSize(0, fontHeight);
 		bool checkAreaBounds = mWordWrap && mAreaSize.x > FLT_EPSILON;
 		int wrapCharIdx = -1;
 		for (int i = 0; i < textLen; i++)
 		{
-			const Font::Character& ch = mFont->GetCharacter(mText[i], mHeight);
+			const Font::Character& ch = getCharacter(mText[i]);
 			Vec2F chSize = ch.mSize;
 			Vec2F chPos = Vec2F(curLine->mSize.x - ch.mOrigin.x, -ch.mOrigin.y);
 
 			if (mDotsEndings && mText[i] != '\n' && curLine->mSize.x + ch.mAdvance*mSymbolsDistCoef > mAreaSize.x - dotsSize)
 			{
-				const Font::Character& dotCh = mFont->GetCharacter('.', mHeight);
+				const Font::Character& dotCh = getCharacter('.');
 				Vec2F dotChSize = dotCh.mSize;
 
 				for (int j = 0; j < 3; j++)
@@ -604,8 +632,6 @@ namespace o2
 		else if (mVerAlign == VerAlign::Middle)
 			yOffset -= mAreaSize.y*0.5f - fullSize.y*0.5f;
 
-		yOffset += mPosition.y;
-
 		for (Vector<Line>::Iterator it = mLines.begin(); it != mLines.end(); ++it)
 		{
 			Line* line = &(*it);
@@ -620,9 +646,11 @@ namespace o2
 			else if (mHorAlign == HorAlign::Both)
 				additiveSpaceOffs = Math::Max(0.0f, (mAreaSize.x - line->mSize.x)/(float)line->mSpacesCount);
 
-			xOffset += mPosition.x;
+			if (linesOrigins)
+				linesOrigins->Add(Vec2F(xOffset, yOffset));
 
-			Vec2F locOrigin((float)(int)xOffset, (float)(int)yOffset);
+			// Position is added to origin before flooring, so cached layout at zero position is snapped in same way
+			Vec2F locOrigin(Math::Floor(xOffset + mPosition.x), Math::Floor(yOffset + mPosition.y));
 			line->mPosition = locOrigin;
 			yOffset -= lineHeight;
 
@@ -11,6 +11,7 @@ namespace o2
 {
 	class Mesh;
 	class Render;
+	class TextLayoutCache;
 
 	// ------------------------------------------------------------------------------------------
 	// Text renderer class. Using font, basis and many style parameters. Caching text into meshes
@@ -145,6 +146,9 @@ namespace o2
 								 bool wordWrap = true, bool dotsEngings = false, float charsDistCoef = 1.0f,
 								 float linesDistCoef = 1.0f);
 
+		// Returns layouts cache, shared between all texts
+		static TextLayoutCache& GetLayoutCache();
+
 		SERIALIZABLE(Text);
 
 	public:
@@ -214,11 +218,17 @@ namespace o2
 			Vector<Line> mLines; // Lines definitions
 
 		public:
-			// Calculating characters layout by parameters
+			// Calculating characters layout by parameters. Takes layout from layouts cache when it is possible
 			void Initialize(FontRef font, const WString& text, int height, const Vec2F& position, const Vec2F& areaSize,
 							HorAlign horAlign, VerAlign verAlign, bool wordWrap, bool dotsEngings, float charsDistCoef,
 							float linesDistCoef);
 
+			// Calculating characters layout by parameters without layouts cache. Fills lines origins before flooring to
+			// pixels, when they are required
+			void InitializeUncached(FontRef font, const WString& text, int height, const Vec2F& position, const Vec2F& areaSize,
+									HorAlign horAlign, VerAlign verAlign, bool wordWrap, bool dotsEngings, float charsDistCoef,
+									float linesDistCoef, Vector<Vec2F>* linesOrigins = nullptr);
+
 			// Moves symbols 
 			void Move(const Vec2F& offs);
 		};
@@ -0,0 +1,191 @@
+#include "o2/stdafx.h"
+#include "TextLayoutCache.h"
+
+#include "o2/Render/Font.h"
+
+namespace o2
+{
+	TextLayoutCache::TextLayoutCache(int capacity /*= 4096*/):
+		mCapacity(capacity)
+	{}
+
+	TextLayoutCache::~TextLayoutCache()
+	{
+		Clear();
+	}
+
+	void TextLayoutCache::SetCapacity(int capacity)
+	{
+		mCapacity = Math::Max(capacity, 0);
+		RemoveOverCapacity();
+	}
+
+	int TextLayoutCache::GetCapacity() const
+	{
+		return mCapacity;
+	}
+
+	int TextLayoutCache::GetCount() const
+	{
+		return mLayouts.Count();
+	}
+
+	void TextLayoutCache::Clear()
+	{
+		for (auto& kv : mLayouts)
+			delete kv.second;
+
+		mLayouts.Clear();
+		mFirst = nullptr;
+		mLast = nullptr;
+	}
+
+	bool TextLayoutCache::Initialize(Text::SymbolsSet& symbolsSet, FontRef font, const WString& text, int height,
+									 const Vec2F& position, const Vec2F& areaSize, HorAlign horAlign, VerAlign verAlign,
+									 bool wordWrap, bool dotsEngings, float charsDistCoef, float linesDistCoef)
+	{
+		if (mCapacity == 0 || !font)
+		{
+			symbolsSet.InitializeUncached(font, text, height, position, areaSize, horAlign, verAlign, wordWrap, dotsEngings,
+										  charsDistCoef, linesDistCoef);
+			return false;
+		}
+
+		Font* fontPtr = font.Get();
+		UInt fontVersion = fontPtr->mCharactersVersion;
+
+		UInt64 hash = std::hash<WString>()(text);
+		auto combine = [&](UInt64 value) { hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2); };
+		combine((UInt64)fontPtr);
+		combine(fontVersion);
+		combine((UInt64)height);
+		combine(std::hash<float>()(areaSize.x));
+		combine(std::hash<float>()(areaSize.y));
+		combine((UInt64)horAlign);
+		combine((UInt64)verAlign);
+		combine((UInt64)wordWrap | ((UInt64)dotsEngings << 1));
+		combine(std::hash<float>()(charsDistCoef));
+		combine(std::hash<float>()(linesDistCoef));
+
+		Layout* layout = nullptr;
+		mLayouts.TryGetValue(hash, layout);
+
+		bool isSame = layout && layout->font == fontPtr && layout->fontVersion == fontVersion && layout->height == height &&
+			layout->areaSize == areaSize && layout->horAlign == horAlign && layout->verAlign == verAlign &&
+			layout->wordWrap == wordWrap && layout->dotsEndings == dotsEngings && layout->charsDistCoef == charsDistCoef &&
+			layout->linesDistCoef == linesDistCoef && layout->text == text;
+
+		if (!isSame)
+		{
+			// Layout with same hash and other parameters is replaced
+			if (!layout)
+			{
+				layout = mnew Layout();
+				mLayouts.Add(hash, layout);
+			}
+
+			// Laying out at zero position, so layout can be used for text at any position
+			symbolsSet.InitializeUncached(font, text, height, Vec2F(), areaSize, horAlign, verAlign, wordWrap, dotsEngings,
+										  charsDistCoef, linesDistCoef, &layout->linesOrigins);
+
+			layout->hash = hash;
+			layout->font = fontPtr;
+			layout->fontVersion = fontVersion;
+			layout->text = text;
+			layout->height = height;
+			layout->areaSize = areaSize;
+			layout->horAlign = horAlign;
+			layout->verAlign = verAlign;
+			layout->wordWrap = wordWrap;
+			layout->dotsEndings = dotsEngings;
+			layout->charsDistCoef = charsDistCoef;
+			layout->linesDistCoef = linesDistCoef;
+			layout->lines = symbolsSet.mLines;
+			layout->realSize = symbolsSet.mRealSize;
+
+			MoveToFirst(layout);
+			RemoveOverCapacity();
+		}
+		else
+		{
+			symbolsSet.mFont = font;
+			symbolsSet.mText = text;
+			symbolsSet.mHeight = height;
+			symbolsSet.mAreaSize = areaSize;
+			symbolsSet.mHorAlign = horAlign;
+			symbolsSet.mVerAlign = verAlign;
+			symbolsSet.mWordWrap = wordWrap;
+			symbolsSet.mDotsEndings = dotsEngings;
+			symbolsSet.mSymbolsDistCoef = charsDistCoef;
+			symbolsSet.mLinesDistCoef = linesDistCoef;
+			symbolsSet.mLines = layout->lines;
+			symbolsSet.mRealSize = layout->realSize;
+
+			MoveToFirst(layout);
+		}
+
+		// Snapping lines to pixels as uncached layout does: origin is floored after adding position
+		for (int i = 0; i < symbolsSet.mLines.Count(); i++)
+		{
+			auto& line = symbolsSet.mLines[i];
+			const Vec2F& origin = layout->linesOrigins[i];
+			Vec2F offset = Vec2F(Math::Floor(origin.x + position.x), Math::Floor(origin.y + position.y)) - line.mPosition;
+
+			for (auto& symbol : line.mSymbols)
+				symbol.mFrame += offset;
+
+			line.mPosition += offset;
+		}
+
+		symbolsSet.mPosition = position;
+
+		return isSame;
+	}
+
+	void TextLayoutCache::MoveToFirst(Layout* layout)
+	{
+		if (mFirst == layout)
+			return;
+
+		Unlink(layout);
+
+		layout->next = mFirst;
+		if (mFirst)
+			mFirst->prev = layout;
+
+		mFirst = layout;
+
+		if (!mLast)
+			mLast = layout;
+	}
+
+	void TextLayoutCache::Unlink(Layout* layout)
+	{
+		if (layout->prev)
+			layout->prev->next = layout->next;
+
+		if (layout->next)
+			layout->next->prev = layout->prev;
+
+		if (mFirst == layout)
+			mFirst = layout->next;
+
+		if (mLast == layout)
+			mLast = layout->prev;
+
+		layout->prev = nullptr;
+		layout->next = nullptr;
+	}
+
+	void TextLayoutCache::RemoveOverCapacity()
+	{
+		while (mLayouts.Count() > mCapacity && mLast)
+		{
+			Layout* layout = mLast;
+			Unlink(layout);
+
+			mLayouts.Remove(layout->hash);
+			delete layout;
+		}
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "o2/Render/Text.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------------------
+	// Text layouts cache. Keeps symbols layouts by text and layout parameters, so texts with same strings and
+	// parameters, like list items or properties names, are laid out once. Layouts are stored at zero position
+	// and moved to text position when used. Least recently used layouts are removed when cache is full.
+	// Layout becomes invalid when font characters are changed
+	// -------------------------------------------------------------------------------------------------------
+	class TextLayoutCache
+	{
+	public:
+		// Constructor
+		TextLayoutCache(int capacity = 4096);
+
+		// Destructor
+		~TextLayoutCache();
+
+		// Sets maximum layouts count. Zero disables caching
+		void SetCapacity(int capacity);
+
+		// Returns maximum layouts count
+		int GetCapacity() const;
+
+		// Returns cached layouts count
+		int GetCount() const;
+
+		// Removes all cached layouts
+		void Clear();
+
+		// Initializes symbols set from cached layout, or lays out symbols and puts layout into cache. Returns true
+		// when layout was taken from cache
+		bool Initialize(Text::SymbolsSet& symbolsSet, FontRef font, const WString& text, int height, const Vec2F& position,
+						const Vec2F& areaSize, HorAlign horAlign, VerAlign verAlign, bool wordWrap, bool dotsEngings,
+						float charsDistCoef, float linesDistCoef);
+
+	protected:
+		// -----------------------------------------------------
+		// Cached layout with parameters and recently used links
+		// -----------------------------------------------------
+		struct Layout
+		{
+			UInt64   hash = 0;            // Hash of all parameters
+			Font*    font = nullptr;      // Font
+			UInt     fontVersion = 0;     // Font characters version
+			WString  text;                // Text string
+			int      height = 0;          // Text height
+			Vec2F    areaSize;            // Area size
+			HorAlign horAlign;            // Horizontal align
+			VerAlign verAlign;            // Vertical align
+			bool     wordWrap = false;    // Words wrapping
+			bool     dotsEndings = false; // Dots ending when overflow
+			float    charsDistCoef = 1;   // Characters distance coefficient
+			float    linesDistCoef = 1;   // Lines distance coefficient
+
+			Vector<Text::SymbolsSet::Line> lines;        // Lines laid out at zero position
+			Vector<Vec2F>                  linesOrigins; // Lines origins at zero position before flooring to pixels
+			Vec2F                          realSize;     // Real text size
+
+			Layout* prev = nullptr; // More recently used layout
+			Layout* next = nullptr; // Less recently used layout
+		};
+
+	protected:
+		HashMap<UInt64, Layout*> mLayouts;         // Layouts by parameters hash
+		Layout*                  mFirst = nullptr; // Most recently used layout
+		Layout*                  mLast = nullptr;  // Least recently used layout
+		int                      mCapacity = 4096; // Maximum layouts count
+
+	protected:
+		// Moves layout to beginning of recently used list
+		void MoveToFirst(Layout* layout);
+
+		// Unlinks layout from recently used list
+		void Unlink(Layout* layout);
+
+		// Removes least recently used layouts while count is over capacity
+		void RemoveOverCapacity();
+	};
+}
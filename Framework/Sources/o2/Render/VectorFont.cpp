@@ -11,7 +11,6 @@
 #include "o2/Render/Render.h"
 #include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
-#include "o2/Utils/FileSystem/File.h"
 #include "o2/Utils/System/Time/Timer.h"
 
 namespace o2
@@ -60,20 +59,21 @@ namespace o2
 
 	bool VectorFont::Load(const String& fileName)
 	{
-		InFile file(fileName);
+		// Face reads from mapped data, so it must be released before file remapping
+		if (mFreeTypeFace)
+		{
+			FT_Done_Face(mFreeTypeFace);
+			mFreeTypeFace = nullptr;
+		}
 
-		if (!file.IsOpened())
+		if (!mFontFile.Open(fileName, MappedFile::AccessHint::Random))
 		{
 			o2Render.mLog->Error("Failed to load vector font: " + fileName);
 			return false;
 		}
 
-		UInt8* data = mnew UInt8[file.GetDataSize()];
-		file.ReadFullData(data);
-
-		FT_Error error = FT_New_Memory_Face(o2Render.mFreeTypeLib, data, file.GetDataSize(), 0, &mFreeTypeFace);
-
-		//delete[] data;
+		FT_Error error = FT_New_Memory_Face(o2Render.mFreeTypeLib, (const FT_Byte*)mFontFile.GetData(),
+											(FT_Long)mFontFile.GetDataSize(), 0, &mFreeTypeFace);
 
 		if (error)
 		{
@@ -142,12 +142,8 @@ namespace o2
 		{
 			bool isNew = true;
 			wchar_t c = needChararacters[i];
-			auto fndHeight = mCharacters.find(height);
-			if (fndHeight != mCharacters.End())
-			{
-				auto fndId = fndHeight->second.find(c);
-				isNew = fndHeight->second.find(c) == fndHeight->second.End();
-			}
+			if (auto table = GetCharactersTable(height))
+				isNew = table->Find(c) == nullptr;
 
 			if (isNew)
 				isNew = !needToRenderChars.Contains(c);
@@ -203,6 +199,7 @@ namespace o2
 	void VectorFont::Reset()
 	{
 		mCharacters.Clear();
+		OnCharactersChanged();
 		onCharactersRebuilt();
 	}
 
@@ -296,16 +293,18 @@ namespace o2
 					mTexture = TextureRef(lastTexture->GetSize()*2, PixelFormat::R8G8B8A8, Texture::Usage::Default);
 					mTexture->Copy(*lastTexture.Get(), RectI(Vec2I(0, 0), lastTexture->GetSize()));
 
-					for (auto heightKV : mCharacters)
+					for (auto& heightKV : mCharacters)
 					{
-						for (auto charKV : heightKV.second)
+						heightKV.second.ForEach([](Character& character)
 						{
-							charKV.second.mTexSrc.left *= 0.5f;
-							charKV.second.mTexSrc.right *= 0.5f;
-							charKV.second.mTexSrc.top *= 0.5f;
-							charKV.second.mTexSrc.bottom *= 0.5f;
-						}
+							character.mTexSrc.left *= 0.5f;
+							character.mTexSrc.right *= 0.5f;
+							character.mTexSrc.top *= 0.5f;
+							character.mTexSrc.bottom *= 0.5f;
+						});
 					}
+
+					OnCharactersChanged();
 				}
 			}
 		}
@@ -4,6 +4,7 @@
 #include FT_FREETYPE_H
 
 #include "o2/Render/Font.h"
+#include "o2/Utils/FileSystem/MappedFile.h"
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Serialization/Serializable.h"
 #include "o2/Utils/Tools/RectPacker.h"
@@ -120,8 +121,9 @@ namespace o2
 		};
 
 	protected:
-		String  mFileName;     // Source file name
-		FT_Face mFreeTypeFace; // Free Type font face
+		String     mFileName;     // Source file name
+		MappedFile mFontFile;     // Mapped font file data, face reads glyphs right from it
+		FT_Face    mFreeTypeFace; // Free Type font face
 
 		Vector<Effect*> mEffects; // Font effects
 
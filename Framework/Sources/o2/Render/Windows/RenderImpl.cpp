@@ -13,6 +13,7 @@
 #include "o2/Render/Texture.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Math/Geometry.h"
 #include "o2/Utils/Math/Interpolation.h"
 
@@ -132,6 +133,7 @@ namespace o2
 
 		InitializeFreeType();
 		InitializeLinesIndexBuffer();
+		InitializeSpriteInstancesBuffers();
 		InitializeLinesTextures();
 
 		mCurrentRenderTarget = TextureRef();
@@ -172,6 +174,7 @@ namespace o2
 			mGLContext = NULL;
 		}
 
+		DeinitializeSpriteInstancesBuffers();
 		DeinitializeFreeType();
 
 		mReady = false;
@@ -227,6 +230,8 @@ namespace o2
 		if (mLastDrawVertex < 1)
 			return;
 
+		PROFILE_FUNCTION();
+
 		static const GLenum primitiveType[3]{ GL_TRIANGLES, GL_TRIANGLES, GL_LINES };
 
 		glDrawElements(primitiveType[(int)mCurrentPrimitiveType], mLastDrawIdx, GL_UNSIGNED_SHORT, mVertexIndexData);
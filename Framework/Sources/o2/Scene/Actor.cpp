@@ -1,7 +1,9 @@
 #include "o2/stdafx.h"
 #include "Actor.h"
 
+#include "o2/Assets/Types/ActorAsset.h"
 #include "o2/Scene/ActorDataValueConverter.h"
+#include "o2/Scene/ActorInstantiationPlan.h"
 #include "o2/Scene/Component.h"
 #include "o2/Scene/Scene.h"
 #include "o2/Scene/SceneLayer.h"
@@ -50,13 +52,7 @@ namespace o2
 
 		SetPrototype(prototype);
 
-		Vector<Actor**> actorPointersFields;
-		Vector<Component**> componentPointersFields;
-		Map<const Actor*, Actor*> actorsMap;
-		Map<const Component*, Component*> componentsMap;
-
-		ProcessCopying(this, prototype->GetActor(), actorPointersFields, componentPointersFields, actorsMap, componentsMap, true);
-		FixComponentFieldsPointers(actorPointersFields, componentPointersFields, actorsMap, componentsMap);
+		prototype->GetInstantiationPlan().Instantiate(this);
 
 		transform->SetDirty();
 
@@ -157,6 +153,9 @@ namespace o2
 
 				o2Scene.RemoveActorFromScene(this);
 			}
+
+			if (mPoolId != UID::empty)
+				o2Scene.RemovePooledActor(this);
 		}
 	}
 
@@ -183,6 +182,57 @@ namespace o2
 		return *this;
 	}
 
+	Vector<Actor*> Actor::Instantiate(const ActorAssetRef& prototype, int count,
+									  ActorCreateMode mode /*= ActorCreateMode::Default*/)
+	{
+		Vector<Actor*> res;
+		res.Reserve(count);
+
+		// Building plan before first instance, so all instances share it
+		prototype->GetInstantiationPlan();
+
+		for (int i = 0; i < count; i++)
+			res.Add(mnew Actor(prototype, mode));
+
+		return res;
+	}
+
+	Actor* Actor::Spawn(const ActorAssetRef& prototype)
+	{
+		Actor* actor = o2Scene.TakePooledActor(prototype->GetUID());
+		if (!actor)
+		{
+			actor = mnew Actor(prototype, ActorCreateMode::InScene);
+			actor->mPoolId = prototype->GetUID();
+			return actor;
+		}
+
+		actor->SetPooledInHierarchy(false);
+		o2Scene.SpawnPooledActor(actor);
+
+		return actor;
+	}
+
+	void Actor::Despawn()
+	{
+		if (mIsPooled)
+			return;
+
+		if (mPoolId == UID::empty)
+		{
+			o2Scene.DestroyActor(this);
+			return;
+		}
+
+		SetPooledInHierarchy(true);
+		o2Scene.DespawnActor(this);
+	}
+
+	bool Actor::IsPooled() const
+	{
+		return mIsPooled;
+	}
+
 	void Actor::Update(float dt)
 	{
 		if (transform->IsDirty())
@@ -593,6 +643,7 @@ namespace o2
 	{
 		component->SetOwnerActor(this);
 		mComponents.Add(component);
+		InvalidateComponentsIndex();
 
 		OnComponentAdded(component);
 		OnChanged();
@@ -605,6 +656,7 @@ namespace o2
 		OnComponentRemoving(component);
 
 		mComponents.Remove(component);
+		InvalidateComponentsIndex();
 		component->mOwner = nullptr;
 
 		if (release)
@@ -617,6 +669,7 @@ namespace o2
 	{
 		auto components = mComponents;
 		mComponents.Clear();
+		InvalidateComponentsIndex();
 
 		for (auto component : components)
 		{
@@ -638,11 +691,7 @@ namespace o2
 
 	Component* Actor::GetComponent(const Type* type)
 	{
-		for (auto comp : mComponents)
-			if (comp->GetType().IsBasedOn(*type))
-				return comp;
-
-		return nullptr;
+		return FindComponentIndexed(type);
 	}
 
 	Component* Actor::GetComponent(SceneUID id)
@@ -733,6 +782,36 @@ namespace o2
 		SetParent(actor, false);
 	}
 
+	Component* Actor::FindComponentIndexed(const Type* type) const
+	{
+		Component* res = nullptr;
+		if (mComponentsIndex.TryGetValue(type, res))
+			return res;
+
+		res = mComponents.FindOrDefault([&](Component* x) { return x->GetType().IsBasedOn(*type); });
+		mComponentsIndex.Add(type, res);
+
+		return res;
+	}
+
+	void Actor::InvalidateComponentsIndex()
+	{
+		mComponentsIndex.Clear();
+	}
+
+	void Actor::SetPooledInHierarchy(bool pooled)
+	{
+		mIsPooled = pooled;
+
+		if (pooled)
+			OnPooled();
+		else
+			OnUnpooled();
+
+		for (auto child : mChildren)
+			child->SetPooledInHierarchy(pooled);
+	}
+
 	void Actor::OnAddToScene()
 	{
 		mSceneStatus = SceneStatus::InScene;
@@ -746,7 +825,10 @@ namespace o2
 		}
 
 		for (auto comp : mComponents)
+		{
+			o2Scene.RegisterComponent(comp);
 			comp->OnAddToScene();
+		}
 	}
 
 	void Actor::OnRemoveFromScene()
@@ -759,13 +841,31 @@ namespace o2
 			mLayer->UnregisterActor(this);
 		}
 
+		bool isSceneInitialized = Scene::IsSingletonInitialzed();
 		for (auto comp : mComponents)
+		{
+			if (isSceneInitialized)
+				o2Scene.UnregisterComponent(comp);
+
 			comp->OnRemoveFromScene();
+		}
 	}
 
 	void Actor::OnStart()
 	{}
 
+	void Actor::OnPooled()
+	{
+		for (auto comp : mComponents)
+			comp->OnPooled();
+	}
+
+	void Actor::OnUnpooled()
+	{
+		for (auto comp : mComponents)
+			comp->OnUnpooled();
+	}
+
 	void Actor::OnUpdate(float dt)
 	{}
 
@@ -1200,13 +1300,21 @@ namespace o2
 
 #if !IS_EDITOR
 
-	void Actor::OnChanged() {}
+	void Actor::OnChanged()
+	{
+		if (IsAsset())
+			ActorAsset::InvalidateAllInstantiationPlans();
+	}
 
 	void Actor::OnLockChanged() {}
 
 	void Actor::OnNameChanged() {}
 
-	void Actor::OnChildrenChanged() {}
+	void Actor::OnChildrenChanged()
+	{
+		if (IsAsset())
+			ActorAsset::InvalidateAllInstantiationPlans();
+	}
 
 	void Actor::OnParentChanged(Actor* oldParent)
 	{
@@ -9,6 +9,7 @@
 #include "o2/Utils/Editor/Attributes/EditorPropertyAttribute.h"
 #include "o2/Utils/Editor/SceneEditableObject.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
 #include "o2/Utils/Types/UID.h"
 
 namespace o2
@@ -87,6 +88,23 @@ namespace o2
 		// Assign operator
 		Actor& operator=(const Actor& other);
 
+		// Creates count actors from prototype. Prototype is compiled into instantiation plan once and
+		// shared by all instances
+		static Vector<Actor*> Instantiate(const ActorAssetRef& prototype, int count,
+										  ActorCreateMode mode = ActorCreateMode::Default);
+
+		// Takes actor of prototype from scene pool, or creates new one when pool is empty. Actor is added to scene on
+		// next frame, so it is safe to spawn from update. Return it with Despawn instead of destroying, so next Spawn
+		// reuses it without allocations
+		static Actor* Spawn(const ActorAssetRef& prototype);
+
+		// Returns spawned actor into scene pool: calls OnPooled in hierarchy, actor is removed from scene and
+		// put into pool at the end of frame. Actor that wasn't spawned is destroyed
+		void Despawn();
+
+		// Returns is actor despawned and waiting in pool
+		bool IsPooled() const;
+
 		// Updates actor and components
 		virtual void Update(float dt);
 
@@ -387,6 +405,8 @@ namespace o2
 
 		Vector<Component*> mComponents; // Components vector 
 
+		mutable HashMap<const Type*, Component*> mComponentsIndex; // First components by requested types, null when missing. Cleared on changes
+
 		bool mEnabled = true;               // Is actor enabled
 		bool mResEnabled = true;            // Is actor really enabled. 
 		bool mResEnabledInHierarchy = true; // Is actor enabled in hierarchy
@@ -398,6 +418,9 @@ namespace o2
 
 		Vector<ActorRef*> mReferences; // References to this actor
 
+		UID  mPoolId = UID::empty; // Prototype id of pool, actor was spawned from. Empty when actor wasn't spawned
+		bool mIsPooled = false;    // Is actor despawned and waiting in pool
+
 #if IS_EDITOR
 		ActorAssetRef mPrototype;               // Prototype asset
 		ActorRef      mPrototypeLink = nullptr; // Prototype link actor. Links to source actor from prototype
@@ -481,12 +504,21 @@ namespace o2
 		// Returns dictionary of all components by type names
 		Map<String, Component*> GetAllComponents();
 
+		// Returns first component based on type, cached in components index
+		Component* FindComponentIndexed(const Type* type) const;
+
+		// Clears components index, must be called when components list changed
+		void InvalidateComponentsIndex();
+
 		// Returns all children actors with their children
 		void GetAllChildrenActors(Vector<Actor*>& actors);
 
 		// Sets parent
 		void SetParentProp(Actor* actor);
 
+		// Sets pooled flag in hierarchy and calls OnPooled or OnUnpooled
+		void SetPooledInHierarchy(bool pooled);
+
 		// Is is called when actor has added to scene
 		virtual void OnAddToScene();
 
@@ -496,6 +528,12 @@ namespace o2
 		// It is called on first update
 		virtual void OnStart();
 
+		// It is called when actor returned into pool by Despawn, resets gameplay state here
+		virtual void OnPooled();
+
+		// It is called when actor taken from pool by Spawn, instead of OnStart for reused actor
+		virtual void OnUnpooled();
+
 		// Is is called on update with frame dt
 		virtual void OnUpdate(float dt);
 
@@ -601,6 +639,7 @@ namespace o2
 
 		friend class ActorAsset;
 		friend class ActorDataValueConverter;
+		friend class ActorInstantiationPlan;
 		friend class ActorRef;
 		friend class ActorTransform;
 		friend class Component;
@@ -660,7 +699,7 @@ namespace o2
 	template<typename _type>
 	_type* Actor::GetComponentInChildren() const
 	{
-		_type* res = GetComponent<_type*>();
+		_type* res = GetComponent<_type>();
 
 		if (res)
 			return res;
@@ -678,13 +717,7 @@ namespace o2
 	template<typename _type>
 	_type* Actor::GetComponent() const
 	{
-		for (auto comp : mComponents)
-		{
-			if (comp->GetType().IsBasedOn(TypeOf(_type)))
-				return dynamic_cast<_type*>(comp);
-		}
-
-		return nullptr;
+		return dynamic_cast<_type*>(FindComponentIndexed(&TypeOf(_type)));
 	}
 
 	template<typename _type>
@@ -750,6 +783,7 @@ CLASS_FIELDS_META(o2::Actor)
 	PROTECTED_FIELD(mParent).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(mChildren);
 	PROTECTED_FIELD(mComponents);
+	PROTECTED_FIELD(mComponentsIndex);
 	PROTECTED_FIELD(mEnabled).DEFAULT_VALUE(true);
 	PROTECTED_FIELD(mResEnabled).DEFAULT_VALUE(true);
 	PROTECTED_FIELD(mResEnabledInHierarchy).DEFAULT_VALUE(true);
@@ -757,6 +791,8 @@ CLASS_FIELDS_META(o2::Actor)
 	PROTECTED_FIELD(mIsAsset).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mAssetId);
 	PROTECTED_FIELD(mReferences);
+	PROTECTED_FIELD(mPoolId).DEFAULT_VALUE(UID::empty);
+	PROTECTED_FIELD(mIsPooled).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mPrototype);
 	PROTECTED_FIELD(mPrototypeLink).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(mLocked).DEFAULT_VALUE(false);
@@ -777,6 +813,10 @@ CLASS_METHODS_META(o2::Actor)
 	typedef Map<const Actor*, Actor*>& _tmp9;
 	typedef Map<const Component*, Component*>& _tmp10;
 
+	PUBLIC_STATIC_FUNCTION(Vector<Actor*>, Instantiate, const ActorAssetRef&, int, ActorCreateMode);
+	PUBLIC_STATIC_FUNCTION(Actor*, Spawn, const ActorAssetRef&);
+	PUBLIC_FUNCTION(void, Despawn);
+	PUBLIC_FUNCTION(bool, IsPooled);
 	PUBLIC_FUNCTION(void, Update, float);
 	PUBLIC_FUNCTION(void, FixedUpdate, float);
 	PUBLIC_FUNCTION(void, UpdateChildren, float);
@@ -874,11 +914,16 @@ CLASS_METHODS_META(o2::Actor)
 	PROTECTED_FUNCTION(void, DeserializeRaw, const DataValue&);
 	PROTECTED_FUNCTION(_tmp5, GetAllChilds);
 	PROTECTED_FUNCTION(_tmp6, GetAllComponents);
+	PROTECTED_FUNCTION(Component*, FindComponentIndexed, const Type*);
+	PROTECTED_FUNCTION(void, InvalidateComponentsIndex);
 	PROTECTED_FUNCTION(void, GetAllChildrenActors, Vector<Actor*>&);
 	PROTECTED_FUNCTION(void, SetParentProp, Actor*);
+	PROTECTED_FUNCTION(void, SetPooledInHierarchy, bool);
 	PROTECTED_FUNCTION(void, OnAddToScene);
 	PROTECTED_FUNCTION(void, OnRemoveFromScene);
 	PROTECTED_FUNCTION(void, OnStart);
+	PROTECTED_FUNCTION(void, OnPooled);
+	PROTECTED_FUNCTION(void, OnUnpooled);
 	PROTECTED_FUNCTION(void, OnUpdate, float);
 	PROTECTED_FUNCTION(void, OnFixedUpdate, float);
 	PROTECTED_FUNCTION(void, OnEnabled);
@@ -63,6 +63,7 @@ namespace o2
 
 		friend class Actor;
 		friend class Scene;
+		friend class SceneLoadingTask;
 	};
 
 	template<>
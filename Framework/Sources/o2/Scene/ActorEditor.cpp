@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "Actor.h"
 
+#include "o2/Assets/Types/ActorAsset.h"
 #include "o2/Scene/ActorDataValueConverter.h"
 #include "o2/Scene/Component.h"
 #include "o2/Scene/Scene.h"
@@ -220,6 +221,7 @@ namespace o2
 				Component* newComponent = (Component*)o2Reflection.CreateTypeSample(type);
 
 				mComponents.Add(newComponent);
+				InvalidateComponentsIndex();
 				newComponent->mOwner = this;
 
 				if (newComponent)
@@ -692,6 +694,7 @@ namespace o2
 
 		OnChanged();
 
+		ActorAsset::InvalidateAllInstantiationPlans();
 		mPrototype->Save();
 	}
 
@@ -881,8 +884,13 @@ namespace o2
 
 	void Actor::OnChanged()
 	{
+		mChangesVersion++;
 		onChanged();
 
+		// Prototype edits break cached instantiation plans pointers
+		if (IsAsset())
+			ActorAsset::InvalidateAllInstantiationPlans();
+
 		if (Scene::IsSingletonInitialzed() && IsHieararchyOnScene())
 			o2Scene.OnObjectChanged(this);
 	}
@@ -916,6 +924,9 @@ namespace o2
 		onChildHierarchyChanged();
 		onChanged();
 
+		if (IsAsset())
+			ActorAsset::InvalidateAllInstantiationPlans();
+
 		if (Scene::IsSingletonInitialzed() && IsHieararchyOnScene())
 		{
 			o2Scene.OnObjectChanged(this);
@@ -1019,6 +1030,7 @@ namespace o2
 				(*it)->mOwner = nullptr;
 				delete *it;
 				it = dest->mComponents.Remove(it);
+				dest->InvalidateComponentsIndex();
 			}
 			else ++it;
 		}
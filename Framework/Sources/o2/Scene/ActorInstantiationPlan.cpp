@@ -0,0 +1,168 @@
+#include "o2/stdafx.h"
+#include "ActorInstantiationPlan.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Component.h"
+#include "o2/Scene/Scene.h"
+
+namespace o2
+{
+	ActorInstantiationPlan::ActorInstantiationPlan(const Actor* prototype)
+	{
+		Map<const Actor*, int> actorsIndices;
+		Map<const Component*, int> componentsIndices;
+
+		mActors.Add(ActorNode());
+		mActors[0].source = prototype;
+		mActors[0].type = dynamic_cast<const ObjectType*>(&prototype->GetType());
+
+		for (int i = 0; i < mActors.Count(); i++)
+		{
+			const Actor* source = mActors[i].source;
+			actorsIndices.Add(source, i);
+
+			mActors[i].childrenBegin = mActors.Count();
+			mActors[i].childrenCount = source->mChildren.Count();
+
+			for (auto child : source->mChildren)
+			{
+				ActorNode childNode;
+				childNode.source = child;
+				childNode.type = dynamic_cast<const ObjectType*>(&child->GetType());
+				mActors.Add(childNode);
+			}
+
+			mActors[i].componentsBegin = mComponents.Count();
+			mActors[i].componentsCount = source->mComponents.Count();
+
+			for (auto component : source->mComponents)
+			{
+				componentsIndices.Add(component, mComponents.Count());
+
+				mComponents.Add(ComponentNode());
+				mComponents.Last().source = component;
+			}
+		}
+
+		for (auto& component : mComponents)
+			CollectFixups(component, actorsIndices, componentsIndices);
+	}
+
+	const Actor* ActorInstantiationPlan::GetPrototype() const
+	{
+		return mActors[0].source;
+	}
+
+	int ActorInstantiationPlan::GetActorsCount() const
+	{
+		return mActors.Count();
+	}
+
+	int ActorInstantiationPlan::GetComponentsCount() const
+	{
+		return mComponents.Count();
+	}
+
+	void ActorInstantiationPlan::Instantiate(Actor* dest) const
+	{
+		Vector<Actor*> actors;
+		actors.Resize(mActors.Count());
+
+		Vector<Component*> components;
+		components.Resize(mComponents.Count());
+
+		InstantiateNode(0, dest, actors, components);
+
+		for (int i = 0; i < mComponents.Count(); i++)
+		{
+			char* componentPtr = (char*)components[i];
+
+			for (auto& fixup : mComponents[i].actorsFixups)
+				*(Actor**)(componentPtr + fixup.offset) = actors[fixup.targetIdx];
+
+			for (auto& fixup : mComponents[i].componentsFixups)
+				*(Component**)(componentPtr + fixup.offset) = components[fixup.targetIdx];
+		}
+	}
+
+	void ActorInstantiationPlan::CollectFixups(ComponentNode& node, const Map<const Actor*, int>& actorsIndices,
+											   const Map<const Component*, int>& componentsIndices)
+	{
+		Component* source = const_cast<Component*>(node.source);
+
+		Vector<const FieldInfo*> fields;
+		const_cast<Actor*>(GetPrototype())->GetComponentFields(source, fields);
+
+		for (auto field : fields)
+		{
+			if (field->GetType()->GetUsage() != Type::Usage::Pointer)
+				continue;
+
+			const PointerType* fieldType = (const PointerType*)field->GetType();
+			void* valuePtr = field->GetValuePtrStrong(source);
+
+			PointerFixup fixup;
+			fixup.offset = (int)((char*)valuePtr - (char*)source);
+
+			if (fieldType->GetUnpointedType()->IsBasedOn(TypeOf(Component)) &&
+				componentsIndices.TryGetValue(*(Component**)valuePtr, fixup.targetIdx))
+			{
+				node.componentsFixups.Add(fixup);
+			}
+
+			if (*fieldType == TypeOf(Actor*) && actorsIndices.TryGetValue(*(Actor**)valuePtr, fixup.targetIdx))
+				node.actorsFixups.Add(fixup);
+		}
+	}
+
+	void ActorInstantiationPlan::InstantiateNode(int nodeIdx, Actor* dest, Vector<Actor*>& actors,
+												 Vector<Component*>& components) const
+	{
+		const ActorNode& node = mActors[nodeIdx];
+		const Actor* source = node.source;
+
+		actors[nodeIdx] = dest;
+
+		if (!dest->mPrototype && source->mPrototype)
+		{
+			dest->mPrototype = source->mPrototype;
+
+			ActorAssetRef proto = source->mPrototype;
+			while (proto)
+			{
+				o2Scene.OnActorLinkedToPrototype(proto, dest);
+				proto = proto->GetActor()->GetPrototype();
+			}
+		}
+
+		if (dest->mParent && dest->mParent->mPrototypeLink)
+			dest->mPrototypeLink = const_cast<Actor*>(source);
+
+		dest->mChildren.Reserve(dest->mChildren.Count() + node.childrenCount);
+		dest->mComponents.Reserve(dest->mComponents.Count() + node.componentsCount);
+
+		for (int i = node.childrenBegin; i < node.childrenBegin + node.childrenCount; i++)
+		{
+			Actor* newChild = dynamic_cast<Actor*>(mActors[i].type->DynamicCastToIObject(mActors[i].type->CreateSample()));
+			if (!dest->IsOnScene())
+				newChild->RemoveFromScene();
+
+			dest->AddChild(newChild);
+
+			InstantiateNode(i, newChild, actors, components);
+		}
+
+		for (int i = node.componentsBegin; i < node.componentsBegin + node.componentsCount; i++)
+		{
+			const Component* component = mComponents[i].source;
+			Component* newComponent = dest->AddComponent(component->CloneAs<Component>());
+
+			components[i] = newComponent;
+
+			if (dest->mPrototypeLink)
+				newComponent->mPrototypeLink = const_cast<Component*>(component);
+		}
+
+		dest->CopyData(*source);
+	}
+}
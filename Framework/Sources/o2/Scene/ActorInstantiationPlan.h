@@ -0,0 +1,82 @@
+#pragma once
+
+#include "o2/Utils/Types/Containers/Map.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	class Actor;
+	class Component;
+	class ObjectType;
+
+	// ---------------------------------------------------------------------------------------------------
+	// Compiled instantiation plan of prototype actor. Flattens prototype hierarchy into actors and
+	// components tables once: types of children actors, components to clone and offsets of their actors
+	// and components pointers fields with indices of remapped targets. Instancing by plan doesn't walk
+	// reflection fields and doesn't build pointers maps. Plan keeps pointers to prototype actors, so it
+	// must be rebuilt when prototype is changed
+	// ---------------------------------------------------------------------------------------------------
+	class ActorInstantiationPlan
+	{
+	public:
+		// Constructor, builds plan from prototype actor
+		ActorInstantiationPlan(const Actor* prototype);
+
+		// Returns source prototype actor
+		const Actor* GetPrototype() const;
+
+		// Returns count of actors in plan, including root
+		int GetActorsCount() const;
+
+		// Returns count of components in plan
+		int GetComponentsCount() const;
+
+		// Copies prototype children and components into dest actor and links them with prototype
+		void Instantiate(Actor* dest) const;
+
+	protected:
+		// -----------------------------------------------------------------------------
+		// Pointer field fixup: offset of field in component and index of target in plan
+		// -----------------------------------------------------------------------------
+		struct PointerFixup
+		{
+			int offset = 0;     // Offset of pointer field from component pointer
+			int targetIdx = -1; // Index of target actor or component in plan
+		};
+
+		// -------------------------------------------------------------------------------------------
+		// Plan actor node. Actors are stored in breadth order, so children of each actor are adjacent
+		// -------------------------------------------------------------------------------------------
+		struct ActorNode
+		{
+			const Actor*      source = nullptr;    // Prototype actor
+			const ObjectType* type = nullptr;      // Actor type, used for creating sample
+			int               childrenBegin = 0;   // Index of first child node
+			int               childrenCount = 0;   // Count of children nodes
+			int               componentsBegin = 0; // Index of first component node
+			int               componentsCount = 0; // Count of components nodes
+		};
+
+		// -------------------------------------------------------
+		// Plan component node: prototype component and fixups
+		// -------------------------------------------------------
+		struct ComponentNode
+		{
+			const Component*     source = nullptr; // Prototype component
+			Vector<PointerFixup> actorsFixups;     // Actors pointers fields remapped into instance actors
+			Vector<PointerFixup> componentsFixups; // Components pointers fields remapped into instance components
+		};
+
+	protected:
+		Vector<ActorNode>     mActors;     // Actors nodes, first is root
+		Vector<ComponentNode> mComponents; // Components nodes
+
+	protected:
+		// Collects offsets of actors and components pointers fields of component, which point into prototype
+		void CollectFixups(ComponentNode& node, const Map<const Actor*, int>& actorsIndices,
+						   const Map<const Component*, int>& componentsIndices);
+
+		// Instantiates node children and components into dest actor
+		void InstantiateNode(int nodeIdx, Actor* dest, Vector<Actor*>& actors, Vector<Component*>& components) const;
+	};
+}
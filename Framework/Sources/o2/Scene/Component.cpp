@@ -19,6 +19,9 @@ namespace o2
 	{
 		if (mOwner)
 			mOwner->RemoveComponent(this, false);
+
+		if (mSceneStorageType && Scene::IsSingletonInitialzed())
+			o2Scene.UnregisterComponent(this);
 	}
 
 	Component& Component::operator=(const Component& other)
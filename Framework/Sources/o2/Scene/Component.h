@@ -106,6 +106,9 @@ namespace o2
 		bool       mEnabled = true;          // Is component enabled @SERIALIZABLE @EDITOR_IGNORE
 		bool       mResEnabled = true;       // Is component enabled in hierarchy
 
+		const Type* mSceneStorageType = nullptr; // Type of scene components storage, null when component isn't in scene
+		int         mSceneStorageIdx = -1;       // Index in scene components storage
+
 	protected:
 		// Sets owner actor
 		virtual void SetOwnerActor(Actor* actor);
@@ -119,6 +122,12 @@ namespace o2
 		// It is called when component started working on first update frame
 		virtual void OnStart() {}
 
+		// It is called when owner actor returned into pool, resets gameplay state here
+		virtual void OnPooled() {}
+
+		// It is called when owner actor taken from pool and reused
+		virtual void OnUnpooled() {}
+
 		// Updates component enable
 		virtual void UpdateEnabled();
 
@@ -153,6 +162,7 @@ namespace o2
 		virtual void OnComponentRemoving(Component* component) {}
 
 		friend class Actor;
+		friend class ActorInstantiationPlan;
 		friend class Scene;
 		friend class Widget;
 	};
@@ -191,6 +201,8 @@ CLASS_FIELDS_META(o2::Component)
 	PROTECTED_FIELD(mOwner).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(mEnabled).DEFAULT_VALUE(true).EDITOR_IGNORE_ATTRIBUTE().SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mResEnabled).DEFAULT_VALUE(true);
+	PROTECTED_FIELD(mSceneStorageType).DEFAULT_VALUE(nullptr);
+	PROTECTED_FIELD(mSceneStorageIdx).DEFAULT_VALUE(-1);
 }
 END_META;
 CLASS_METHODS_META(o2::Component)
@@ -216,6 +228,8 @@ CLASS_METHODS_META(o2::Component)
 	PROTECTED_FUNCTION(void, OnAddToScene);
 	PROTECTED_FUNCTION(void, OnRemoveFromScene);
 	PROTECTED_FUNCTION(void, OnStart);
+	PROTECTED_FUNCTION(void, OnPooled);
+	PROTECTED_FUNCTION(void, OnUnpooled);
 	PROTECTED_FUNCTION(void, UpdateEnabled);
 	PROTECTED_FUNCTION(void, OnEnabled);
 	PROTECTED_FUNCTION(void, OnDisabled);
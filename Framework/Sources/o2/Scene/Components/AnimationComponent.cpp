@@ -3,8 +3,102 @@
 
 #include "o2/Animation/Tracks/AnimationTrack.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 namespace o2
 {
+	namespace
+	{
+		// -----------------------------------------------------------------------------------------------
+		// Worker threads for sampling animation players batches. Threads are started once and wait for
+		// next job between frames
+		// -----------------------------------------------------------------------------------------------
+		class AnimationSamplingWorkers
+		{
+		public:
+			// Starts worker threads
+			explicit AnimationSamplingWorkers(int count)
+			{
+				for (int i = 0; i < count; i++)
+					mThreads.emplace_back([this]() { WorkerLoop(); });
+			}
+
+			// Stops and joins worker threads
+			~AnimationSamplingWorkers()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mMutex);
+					mStopping = true;
+				}
+
+				mJobStarted.notify_all();
+
+				for (auto& thread : mThreads)
+					thread.join();
+			}
+
+			// Runs job on all workers and calling thread. Returns when all of them finished
+			void Run(const Function<void()>& job)
+			{
+				{
+					std::lock_guard<std::mutex> lock(mMutex);
+					mJob = job;
+					mJobIdx++;
+					mBusyCount = (int)mThreads.size();
+				}
+
+				mJobStarted.notify_all();
+
+				job();
+
+				std::unique_lock<std::mutex> lock(mMutex);
+				mJobFinished.wait(lock, [this]() { return mBusyCount == 0; });
+				mJob.Clear();
+			}
+
+		private:
+			std::vector<std::thread> mThreads; // Worker threads
+
+			std::mutex              mMutex;            // Job state mutex
+			std::condition_variable mJobStarted;       // Notifies workers about new job or stopping
+			std::condition_variable mJobFinished;      // Notifies calling thread when last worker finished
+			Function<void()>        mJob;              // Current job
+			UInt64                  mJobIdx = 0;       // Index of current job, workers compare it with last done job
+			int                     mBusyCount = 0;    // Count of workers doing current job
+			bool                    mStopping = false; // Is workers stopping
+
+		private:
+			// Waits for jobs and runs them until stopping
+			void WorkerLoop()
+			{
+				UInt64 doneJobIdx = 0;
+				while (true)
+				{
+					Function<void()> job;
+					{
+						std::unique_lock<std::mutex> lock(mMutex);
+						mJobStarted.wait(lock, [&]() { return mStopping || mJobIdx != doneJobIdx; });
+
+						if (mStopping)
+							return;
+
+						doneJobIdx = mJobIdx;
+						job = mJob;
+					}
+
+					job();
+
+					std::lock_guard<std::mutex> lock(mMutex);
+					if (--mBusyCount == 0)
+						mJobFinished.notify_one();
+				}
+			}
+		};
+	}
+
 	AnimationComponent::AnimationComponent()
 	{}
 
@@ -31,6 +125,12 @@ namespace o2
 
 	void AnimationComponent::Update(float dt)
 	{
+		if (mUpdatedByBatch)
+		{
+			mUpdatedByBatch = false;
+			return;
+		}
+
 		if (mInEditMode)
 			return;
 
@@ -47,6 +147,88 @@ namespace o2
 			mBlend.Update(dt);
 	}
 
+	void AnimationComponent::UpdateComponents(const Vector<AnimationComponent*>& components, float dt)
+	{
+		Vector<AnimationPlayer*> sampling;
+
+		for (auto component : components)
+		{
+			component->mUpdatedByBatch = true;
+
+			if (component->mInEditMode)
+				continue;
+
+			for (auto state : component->mStates)
+			{
+				if (!state->mAnimation)
+					continue;
+
+				AnimationPlayer& player = state->player;
+				player.mDeferBatch = true;
+				player.Update(dt);
+				player.mDeferBatch = false;
+
+				if (!player.mBatchPending)
+					continue;
+
+				// Events handlers could change clip tracks, batch must be bound before sampling on workers
+				const AnimationTracksBatch& batch = player.mClip->GetTracksBatch();
+				if (player.mBatchVersion != batch.GetVersion())
+				{
+					player.BindBatchPlayers(batch);
+					player.mBatchPending = true;
+				}
+
+				sampling.Add(&player);
+			}
+		}
+
+		// Players are taken by small chunks, clips have very different tracks count
+		const int chunkSize = 16;
+		const int minParallelPlayers = 128;
+
+		std::atomic<int> nextPlayer(0);
+		auto sampleChunks = [&]()
+		{
+			while (true)
+			{
+				int begin = nextPlayer.fetch_add(chunkSize);
+				if (begin >= sampling.Count())
+					break;
+
+				int end = Math::Min(begin + chunkSize, sampling.Count());
+				for (int i = begin; i < end; i++)
+					sampling[i]->SampleBatch();
+			}
+		};
+
+		if (sampling.Count() >= minParallelPlayers)
+		{
+			static AnimationSamplingWorkers workers(Math::Clamp((int)std::thread::hardware_concurrency() - 1, 1, 7));
+			workers.Run(sampleChunks);
+		}
+		else
+			sampleChunks();
+
+		for (auto player : sampling)
+		{
+			if (player->mBatchPending)
+				player->ApplyBatch();
+		}
+
+		for (auto component : components)
+		{
+			if (component->mInEditMode)
+				continue;
+
+			for (auto val : component->mValues)
+				val->Update();
+
+			if (component->mBlend.time > 0)
+				component->mBlend.Update(dt);
+		}
+	}
+
 	AnimationState* AnimationComponent::AddState(AnimationState* state)
 	{
 		state->player.SetTarget(mOwner);
@@ -30,9 +30,15 @@ namespace o2
 		// Copy-operator
 		AnimationComponent& operator=(const AnimationComponent& other);
 
-		// Updates animations, blendings and assigning blended values
+		// Updates animations, blendings and assigning blended values. Skipped when component was updated by
+		// UpdateComponents in current frame
 		void Update(float dt) override;
 
+		// Updates many components at once. States times and events are updated on calling thread, clips float
+		// tracks are sampled on worker threads, then values are assigned and blended on calling thread.
+		// Scene updates its animation components by it before actors update
+		static void UpdateComponents(const Vector<AnimationComponent*>& components, float dt);
+
 		// Adds new animation state and returns him
 		AnimationState* AddState(AnimationState* state);
 
@@ -169,7 +175,8 @@ namespace o2
 
 		BlendState mBlend;  // Current blend parameters
 
-		bool mInEditMode = false; // True when some state animation is editing now, disables update
+		bool mInEditMode = false;     // True when some state animation is editing now, disables update
+		bool mUpdatedByBatch = false; // Is component updated by UpdateComponents in current frame, own Update skips it
 
 	protected:
 		// Registers value by path and state
@@ -293,12 +300,14 @@ CLASS_FIELDS_META(o2::AnimationComponent)
 	PROTECTED_FIELD(mValues);
 	PROTECTED_FIELD(mBlend);
 	PROTECTED_FIELD(mInEditMode).DEFAULT_VALUE(false);
+	PROTECTED_FIELD(mUpdatedByBatch).DEFAULT_VALUE(false);
 }
 END_META;
 CLASS_METHODS_META(o2::AnimationComponent)
 {
 
 	PUBLIC_FUNCTION(void, Update, float);
+	PUBLIC_STATIC_FUNCTION(void, UpdateComponents, const Vector<AnimationComponent*>&, float);
 	PUBLIC_FUNCTION(AnimationState*, AddState, AnimationState*);
 	PUBLIC_FUNCTION(AnimationState*, AddState, const String&, const AnimationClip&, const AnimationMask&, float);
 	PUBLIC_FUNCTION(AnimationState*, AddState, const String&);
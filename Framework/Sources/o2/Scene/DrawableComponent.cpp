@@ -54,6 +54,7 @@ namespace o2
 		if (mOwner)
 		{
 			mOwner->mComponents.Remove(this);
+			mOwner->InvalidateComponentsIndex();
 
 			if (mOwner->IsOnScene())
 				ISceneDrawable::OnRemoveFromScene();
@@ -64,6 +65,7 @@ namespace o2
 		if (mOwner)
 		{
 			mOwner->mComponents.Add(this);
+			mOwner->InvalidateComponentsIndex();
 
 			if (mOwner->IsOnScene())
 				ISceneDrawable::OnAddToScene();
@@ -6,13 +6,18 @@
 #include "o2/Render/Render.h"
 #include "o2/Scene/Actor.h"
 #include "o2/Scene/ActorDataValueConverter.h"
+#include "o2/Scene/ActorRef.h"
 #include "o2/Scene/CameraActor.h"
 #include "o2/Scene/Component.h"
+#include "o2/Scene/Components/AnimationComponent.h"
 #include "o2/Scene/DrawableComponent.h"
 #include "o2/Scene/SceneLayer.h"
+#include "o2/Scene/SceneLoadingTask.h"
 #include "o2/Scene/Tags.h"
 #include "o2/Scene/UI/Widget.h"
 #include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/Debug/Profiler.h"
+#include "o2/Utils/System/Time/Timer.h"
 #include "o2/Render/VectorFontEffects.h"
 #include "o2/Assets/Assets.h"
 
@@ -29,6 +34,17 @@ namespace o2
 
 	Scene::~Scene()
 	{
+		CancelLoadingTasks();
+
+		for (auto chunk : mStreamingChunks)
+		{
+			for (auto actor : chunk->actors)
+				delete actor;
+
+			delete chunk;
+		}
+
+		ClearPools();
 		Clear();
 		ClearCache();
 
@@ -37,6 +53,9 @@ namespace o2
 
 	void Scene::Update(float dt)
 	{
+		PROFILE_FUNCTION();
+
+		UpdateLoading();
 		UpdateAddedEntities();
 		UpdateStartingEntities();
 		UpdateDestroyingEntities();
@@ -52,16 +71,120 @@ namespace o2
 			actor->FixedUpdateChildren(dt);
 	}
 
+	void Scene::UpdateLoading()
+	{
+		UpdateStreamingChunks();
+
+		if (mLoadingTasks.IsEmpty())
+		{
+			mCompletedLoadingTasks = 0;
+			return;
+		}
+
+		Timer timer;
+		while (!mLoadingTasks.IsEmpty())
+		{
+			float timeBudget = mLoadingTimeBudget - timer.GetTime();
+			if (timeBudget <= 0.0f)
+				break;
+
+			SceneLoadingTask* task = mLoadingTasks[0];
+			if (!task->Update(timeBudget))
+				break;
+
+			mLoadingTasks.RemoveAt(0);
+			mCompletedLoadingTasks++;
+
+			if (auto chunk = mStreamingChunks.FindOrDefault([&](StreamingChunk* x) { return x->task == task; }))
+			{
+				chunk->task = nullptr;
+				chunk->loaded = true;
+
+				for (auto actor : task->GetLoadedActors())
+				{
+					if (actor)
+						chunk->actors.Add(mnew ActorRef(actor));
+				}
+			}
+
+			task->onLoaded();
+			delete task;
+		}
+
+		if (mLoadingTasks.IsEmpty())
+		{
+			mCompletedLoadingTasks = 0;
+			onLoaded();
+		}
+	}
+
+	void Scene::UpdateStreamingChunks()
+	{
+		for (auto chunk : mStreamingChunks)
+		{
+			bool inArea = chunk->region.IsIntersects(mStreamingArea);
+
+			if (inArea && !chunk->loaded && !chunk->task)
+			{
+				chunk->task = mnew SceneLoadingTask(chunk->path, true);
+				mLoadingTasks.Add(chunk->task);
+			}
+			else if (!inArea && (chunk->loaded || chunk->task))
+				UnloadStreamingChunk(chunk);
+		}
+	}
+
+	void Scene::UnloadStreamingChunk(StreamingChunk* chunk)
+	{
+		if (chunk->task)
+		{
+			mLoadingTasks.Remove(chunk->task);
+			delete chunk->task;
+			chunk->task = nullptr;
+		}
+
+		for (auto actor : chunk->actors)
+		{
+			actor->Destroy();
+			delete actor;
+		}
+
+		chunk->actors.Clear();
+		chunk->loaded = false;
+	}
+
+	void Scene::CancelLoadingTasks()
+	{
+		for (auto task : mLoadingTasks)
+			delete task;
+
+		mLoadingTasks.Clear();
+		mCompletedLoadingTasks = 0;
+
+		for (auto chunk : mStreamingChunks)
+			chunk->task = nullptr;
+	}
+
 	void Scene::UpdateAddedEntities()
 	{
 		auto addedActors = mAddedActors;
+		auto spawnActors = mSpawnActors;
 
 		mStartActors = mAddedActors;
 
 		mAddedActors.Clear();
+		mSpawnActors.Clear();
 
 		for (auto actor : addedActors)
 			AddActorToScene(actor);
+
+		// Pooled actors were started before first despawn, they don't receive OnStart again. Actor can be despawned
+		// again before it was added
+		for (auto actor : spawnActors)
+		{
+			if (!actor->mIsPooled)
+				actor->AddToScene();
+		}
 	}
 
 	void Scene::UpdateStartingEntities()
@@ -81,12 +204,23 @@ namespace o2
 
 	void Scene::UpdateDestroyingEntities()
 	{
+		auto despawnActors = mDespawnActors;
 		auto destroyActors = mDestroyActors;
 		auto destroyComponents = mDestroyComponents;
 
+		mDespawnActors.Clear();
 		mDestroyActors.Clear();
 		mDestroyComponents.Clear();
 
+		for (auto actor : despawnActors)
+		{
+			if (actor->mParent)
+				actor->SetParent(nullptr, false);
+
+			actor->RemoveFromScene();
+			PutPooledActor(actor);
+		}
+
 		for (auto actor : destroyActors)
 			delete actor;
 
@@ -106,6 +240,18 @@ namespace o2
 
 	void Scene::UpdateActors(float dt)
 	{
+		// Animations are updated together, so clips are sampled in one pass, on worker threads when there are many.
+		// Disabled actors animations are left to actors updates, widgets don't update them
+		Vector<AnimationComponent*> animations;
+		animations.Reserve(GetComponentsCount<AnimationComponent>());
+		ForEach<AnimationComponent>([&](AnimationComponent* animation)
+		{
+			if (animation->GetOwnerActor()->IsEnabledInHierarchy())
+				animations.Add(animation);
+		});
+
+		AnimationComponent::UpdateComponents(animations, dt);
+
 		for (auto actor : mRootActors)
 			actor->Update(dt);
 
@@ -240,13 +386,80 @@ namespace o2
 		}
 	}
 
+	Actor* Scene::TakePooledActor(const UID& prototypeId)
+	{
+		if (!mActorsPools.ContainsKey(prototypeId))
+			return nullptr;
+
+		auto& pool = mActorsPools[prototypeId];
+		if (pool.IsEmpty())
+			return nullptr;
+
+		return pool.PopBack();
+	}
+
+	void Scene::PutPooledActor(Actor* actor)
+	{
+		mActorsPools[actor->mPoolId].Add(actor);
+	}
+
+	void Scene::SpawnPooledActor(Actor* actor)
+	{
+		mSpawnActors.Add(actor);
+	}
+
+	void Scene::DespawnActor(Actor* actor)
+	{
+		mDespawnActors.Add(actor);
+	}
+
+	void Scene::RemovePooledActor(Actor* actor)
+	{
+		if (mActorsPools.ContainsKey(actor->mPoolId))
+			mActorsPools[actor->mPoolId].Remove(actor);
+
+		mSpawnActors.Remove(actor);
+		mDespawnActors.Remove(actor);
+	}
+
+	void Scene::RegisterComponent(Component* component)
+	{
+		if (component->mSceneStorageType)
+			return;
+
+		auto type = &component->GetType();
+		auto& storage = mComponentsByType[type];
+
+		component->mSceneStorageType = type;
+		component->mSceneStorageIdx = storage.Count();
+		storage.Add(component);
+	}
+
+	void Scene::UnregisterComponent(Component* component)
+	{
+		if (!component->mSceneStorageType)
+			return;
+
+		auto& storage = mComponentsByType[component->mSceneStorageType];
+
+		Component* last = storage.Last();
+		storage[component->mSceneStorageIdx] = last;
+		last->mSceneStorageIdx = component->mSceneStorageIdx;
+		storage.PopBack();
+
+		component->mSceneStorageType = nullptr;
+		component->mSceneStorageIdx = -1;
+	}
+
 	void Scene::OnComponentAdded(Component* component)
 	{
+		RegisterComponent(component);
 		mStartComponents.Add(component);
 	}
 
 	void Scene::OnComponentRemoved(Component* component)
 	{
+		UnregisterComponent(component);
 		mStartComponents.Remove(component);
 	}
 
@@ -481,6 +694,9 @@ namespace o2
 
 	void Scene::Load(const DataDocument& doc, bool append /*= false*/)
 	{
+		if (!append)
+			CancelLoadingTasks();
+
 		ActorDataValueConverter::Instance().LockPointersResolving();
 
 		if (!append)
@@ -521,6 +737,124 @@ namespace o2
 #endif
 	}
 
+	SceneLoadingTask* Scene::LoadAsync(const String& path, bool append /*= false*/)
+	{
+		if (!append)
+		{
+			CancelLoadingTasks();
+
+			// Chunks actors are destroyed with scene, chunks in streaming area will be loaded again after it
+			for (auto chunk : mStreamingChunks)
+			{
+				for (auto actor : chunk->actors)
+					delete actor;
+
+				chunk->actors.Clear();
+				chunk->loaded = false;
+			}
+		}
+
+		auto task = mnew SceneLoadingTask(path, append);
+		mLoadingTasks.Add(task);
+
+		return task;
+	}
+
+	bool Scene::IsLoading() const
+	{
+		return !mLoadingTasks.IsEmpty();
+	}
+
+	float Scene::GetLoadingProgress() const
+	{
+		if (mLoadingTasks.IsEmpty())
+			return 1.0f;
+
+		int tasksCount = mCompletedLoadingTasks + mLoadingTasks.Count();
+		return ((float)mCompletedLoadingTasks + mLoadingTasks[0]->GetProgress())/(float)tasksCount;
+	}
+
+	void Scene::SetLoadingTimeBudget(float seconds)
+	{
+		mLoadingTimeBudget = seconds;
+	}
+
+	float Scene::GetLoadingTimeBudget() const
+	{
+		return mLoadingTimeBudget;
+	}
+
+	void Scene::AddStreamingChunk(const String& path, const RectF& region)
+	{
+		if (auto chunk = mStreamingChunks.FindOrDefault([&](StreamingChunk* x) { return x->path == path; }))
+		{
+			chunk->region = region;
+			return;
+		}
+
+		auto chunk = mnew StreamingChunk();
+		chunk->path = path;
+		chunk->region = region;
+		mStreamingChunks.Add(chunk);
+	}
+
+	void Scene::RemoveStreamingChunk(const String& path)
+	{
+		auto chunk = mStreamingChunks.FindOrDefault([&](StreamingChunk* x) { return x->path == path; });
+		if (!chunk)
+			return;
+
+		UnloadStreamingChunk(chunk);
+		mStreamingChunks.Remove(chunk);
+		delete chunk;
+	}
+
+	void Scene::SetStreamingArea(const RectF& area)
+	{
+		mStreamingArea = area;
+	}
+
+	const RectF& Scene::GetStreamingArea() const
+	{
+		return mStreamingArea;
+	}
+
+	void Scene::PrewarmPool(const ActorAssetRef& prototype, int count)
+	{
+		auto actors = Actor::Instantiate(prototype, count, ActorCreateMode::NotInScene);
+		for (auto actor : actors)
+		{
+			actor->mPoolId = prototype->GetUID();
+			actor->SetPooledInHierarchy(true);
+			PutPooledActor(actor);
+		}
+	}
+
+	int Scene::GetPooledActorsCount(const ActorAssetRef& prototype) const
+	{
+		auto fnd = mActorsPools.find(prototype->GetUID());
+		return fnd != mActorsPools.end() ? fnd->second.Count() : 0;
+	}
+
+	void Scene::ClearPools()
+	{
+		auto pools = mActorsPools;
+		auto spawnActors = mSpawnActors;
+
+		mActorsPools.Clear();
+		mSpawnActors.Clear();
+
+		for (auto& pool : pools)
+		{
+			for (auto actor : pool.second)
+				delete actor;
+		}
+
+		// Spawned actors waiting for adding are out of pools and scene, nobody else owns them
+		for (auto actor : spawnActors)
+			delete actor;
+	}
+
 	void Scene::Save(const String& path)
 	{
 		DataDocument data;
@@ -699,6 +1033,9 @@ namespace o2
 
 	void Scene::OnObjectChanged(SceneEditableObject* object)
 	{
+		if (object)
+			object->mChangesVersion++;
+
 		mChangedObjects.Add(object);
 	}
 
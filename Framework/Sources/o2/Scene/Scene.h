@@ -3,10 +3,14 @@
 #include "o2/Assets/Types/ActorAsset.h"
 #include "o2/Utils/Serialization/Serializable.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Types/String.h"
 #include "o2/Utils/Types/UID.h"
 #include "o2/Utils/Property.h"
+#include "o2/Utils/Math/Rect.h"
+
+#include <tuple>
 
 // Scene graph access macros
 #define o2Scene Scene::Instance()
@@ -16,7 +20,9 @@ namespace o2
 	class Actor;
 	class CameraActor;
 	class Component;
+	class ActorRef;
 	class SceneLayer;
+	class SceneLoadingTask;
 	class Tag;
 
 #if IS_EDITOR
@@ -31,6 +37,8 @@ namespace o2
 	public:
 		PROPERTIES(Scene);
 
+		Function<void()> onLoaded; // It is called when all loading tasks and streaming chunks are loaded
+
 #if IS_EDITOR
 		Function<void(SceneEditableObject*)> onAddedToScene;             // Actor added to scene event
 		Function<void(SceneEditableObject*)> onRemovedFromScene;         // Actor removed from scene event
@@ -119,6 +127,16 @@ namespace o2
 		template<typename _type>
 		Vector<_type>* FindAllActorsComponents();
 
+		// Calls func(_type*, _others*...) for each scene component based on _type, with components of other types
+		// from same actor; actors without some of them are skipped. Components of one type are iterated by dense
+		// array. Components must not be added to or removed from scene inside func
+		template<typename _type, typename ... _others, typename _func>
+		void ForEach(const _func& func);
+
+		// Returns count of scene components based on type
+		template<typename _type>
+		int GetComponentsCount() const;
+
 		// Removes all actors
 		void Clear(bool keepDefaultLayer = true);
 
@@ -131,6 +149,45 @@ namespace o2
 		// Loads scene from document. If append is true, old actors will not be destroyed
 		void Load(const DataDocument& doc, bool append = false);
 
+		// Starts incremental scene loading: file is parsed in background, actors are instantiated by slices in Update.
+		// If append is false, old actors will be destroyed and other loading tasks canceled. Task is deleted by scene
+		// after completion
+		SceneLoadingTask* LoadAsync(const String& path, bool append = false);
+
+		// Returns true when scene loading tasks are in progress
+		bool IsLoading() const;
+
+		// Returns total progress of current loading tasks from 0 to 1
+		float GetLoadingProgress() const;
+
+		// Sets time in seconds spent for loading in each Update
+		void SetLoadingTimeBudget(float seconds);
+
+		// Returns time in seconds spent for loading in each Update
+		float GetLoadingTimeBudget() const;
+
+		// Adds streaming chunk: scene file appended when region intersects streaming area, and destroyed when it doesn't
+		void AddStreamingChunk(const String& path, const RectF& region);
+
+		// Removes streaming chunk and destroys its actors
+		void RemoveStreamingChunk(const String& path);
+
+		// Sets streaming area, usually around camera or player. Chunks are loaded and unloaded in next Update
+		void SetStreamingArea(const RectF& area);
+
+		// Returns streaming area
+		const RectF& GetStreamingArea() const;
+
+		// Creates actors of prototype in pool in advance, so Actor::Spawn doesn't allocate. Prewarmed actors receive
+		// OnUnpooled instead of OnStart when spawned
+		void PrewarmPool(const ActorAssetRef& prototype, int count);
+
+		// Returns count of despawned actors of prototype waiting in pool
+		int GetPooledActorsCount(const ActorAssetRef& prototype) const;
+
+		// Destroys all pooled actors
+		void ClearPools();
+
 		// Saves scene into file
 		void Save(const String& path);
 
@@ -148,6 +205,19 @@ namespace o2
 
 		IOBJECT(Scene);
 
+	protected:
+		// ----------------------------------------------------
+		// Streaming chunk: scene file bound to region of world
+		// ----------------------------------------------------
+		struct StreamingChunk
+		{
+			String            path;           // Chunk scene file path
+			RectF             region;         // Chunk region, loaded when intersects streaming area
+			SceneLoadingTask* task = nullptr; // Current loading task
+			Vector<ActorRef*> actors;         // Loaded chunk root actors
+			bool              loaded = false; // Is chunk loaded
+		};
+
 	protected:
 		Vector<CameraActor*> mCameras; // List of cameras on scene
 
@@ -170,6 +240,19 @@ namespace o2
 
 		Vector<ActorAssetRef> mCache; // Cached actors assets
 
+		Vector<SceneLoadingTask*> mLoadingTasks;               // Loading tasks queue, processed one by one
+		int                       mCompletedLoadingTasks = 0;  // Count of completed tasks since loading started
+		float                     mLoadingTimeBudget = 0.005f; // Time in seconds spent for loading in each Update
+
+		Vector<StreamingChunk*> mStreamingChunks; // Streaming chunks
+		RectF                   mStreamingArea;   // Streaming area, chunks intersecting it are loaded
+
+		Map<UID, Vector<Actor*>> mActorsPools;   // Despawned actors by prototypes ids, reused by Actor::Spawn
+		Vector<Actor*>           mSpawnActors;   // List of actors taken from pools on current frame. Will be added to scene at next frame without OnStart
+		Vector<Actor*>           mDespawnActors; // List of despawned on current frame actors. Will be removed from scene and put into pools at the end of frame
+
+		HashMap<const Type*, Vector<Component*>> mComponentsByType; // Scene components by exact types, for typed queries
+
 	protected:
 		// Default constructor
 		Scene();
@@ -180,6 +263,18 @@ namespace o2
 		// Updates root actors and their children
 		void UpdateActors(float dt);
 
+		// Loads and unloads streaming chunks, updates loading tasks within time budget
+		void UpdateLoading();
+
+		// Loads or unloads streaming chunks by streaming area
+		void UpdateStreamingChunks();
+
+		// Unloads streaming chunk: cancels loading task and destroys actors
+		void UnloadStreamingChunk(StreamingChunk* chunk);
+
+		// Cancels and deletes all loading tasks
+		void CancelLoadingTasks();
+
 		// Updates just added actors and components
 		void UpdateAddedEntities();
 
@@ -204,6 +299,27 @@ namespace o2
 		// It is called when actor removing from scene; unregisters from actors list and events list
 		void RemoveActorFromScene(Actor* actor, bool keepEditorObjects = false);
 
+		// Takes despawned actor of prototype from pool. Returns null when pool is empty
+		Actor* TakePooledActor(const UID& prototypeId);
+
+		// Puts despawned actor into pool of its prototype
+		void PutPooledActor(Actor* actor);
+
+		// Adds actor taken from pool to spawn list. It will be added to scene on next frame
+		void SpawnPooledActor(Actor* actor);
+
+		// Adds actor to despawn list. It will be removed from scene and put into pool at the end of frame
+		void DespawnActor(Actor* actor);
+
+		// Removes destroyed actor from pool and spawn and despawn lists
+		void RemovePooledActor(Actor* actor);
+
+		// Adds component into storage of its type
+		void RegisterComponent(Component* component);
+
+		// Removes component from storage of its type, last component of storage takes its place
+		void UnregisterComponent(Component* component);
+
 		// It is called when component added to actor, registers for calling OnAddOnScene
 		void OnComponentAdded(Component* component);
 
@@ -223,8 +339,10 @@ namespace o2
 		friend class ActorRef;
 		friend class Application;
 		friend class CameraActor;
+		friend class Component;
 		friend class DrawableComponent;
 		friend class SceneLayer;
+		friend class SceneLoadingTask;
 		friend class Widget;
 		friend class WidgetLayer;
 
@@ -331,6 +449,55 @@ namespace o2
 
 		return nullptr;
 	}
+
+	template<typename _type, typename ... _others, typename _func>
+	void Scene::ForEach(const _func& func)
+	{
+		const Type& type = TypeOf(_type);
+		for (auto& storage : mComponentsByType)
+		{
+			if (!storage.first->IsBasedOn(type))
+				continue;
+
+			auto& components = storage.second;
+			for (int i = 0; i < components.Count(); i++)
+			{
+				_type* component;
+				if constexpr (std::is_base_of<Component, _type>::value)
+					component = static_cast<_type*>(components[i]);
+				else
+					component = dynamic_cast<_type*>(components[i]);
+
+				Actor* actor = component->GetOwnerActor();
+
+				if constexpr (sizeof...(_others) == 0)
+					func(component);
+				else
+				{
+					auto others = std::make_tuple(actor->GetComponent<_others>()...);
+					bool hasAll = std::apply([](auto... x) { return ((x != nullptr) && ...); }, others);
+
+					if (hasAll)
+						std::apply([&](auto... x) { func(component, x...); }, others);
+				}
+			}
+		}
+	}
+
+	template<typename _type>
+	int Scene::GetComponentsCount() const
+	{
+		const Type& type = TypeOf(_type);
+
+		int count = 0;
+		for (auto& storage : mComponentsByType)
+		{
+			if (storage.first->IsBasedOn(type))
+				count += storage.second.Count();
+		}
+
+		return count;
+	}
 };
 
 CLASS_BASES_META(o2::Scene)
@@ -341,6 +508,7 @@ CLASS_BASES_META(o2::Scene)
 END_META;
 CLASS_FIELDS_META(o2::Scene)
 {
+	PUBLIC_FIELD(onLoaded);
 	PUBLIC_FIELD(onAddedToScene);
 	PUBLIC_FIELD(onRemovedFromScene);
 	PUBLIC_FIELD(onEnableChanged);
@@ -362,6 +530,15 @@ CLASS_FIELDS_META(o2::Scene)
 	PROTECTED_FIELD(mDefaultLayer);
 	PROTECTED_FIELD(mTags);
 	PROTECTED_FIELD(mCache);
+	PROTECTED_FIELD(mLoadingTasks);
+	PROTECTED_FIELD(mCompletedLoadingTasks).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mLoadingTimeBudget).DEFAULT_VALUE(0.005f);
+	PROTECTED_FIELD(mStreamingChunks);
+	PROTECTED_FIELD(mStreamingArea);
+	PROTECTED_FIELD(mActorsPools);
+	PROTECTED_FIELD(mSpawnActors);
+	PROTECTED_FIELD(mDespawnActors);
+	PROTECTED_FIELD(mComponentsByType);
 	PROTECTED_FIELD(mPrototypeLinksCache);
 	PROTECTED_FIELD(mChangedObjects);
 	PROTECTED_FIELD(mEditableObjects);
@@ -401,12 +578,28 @@ CLASS_METHODS_META(o2::Scene)
 	PUBLIC_FUNCTION(void, ClearCache);
 	PUBLIC_FUNCTION(void, Load, const String&, bool);
 	PUBLIC_FUNCTION(void, Load, const DataDocument&, bool);
+	PUBLIC_FUNCTION(SceneLoadingTask*, LoadAsync, const String&, bool);
+	PUBLIC_FUNCTION(bool, IsLoading);
+	PUBLIC_FUNCTION(float, GetLoadingProgress);
+	PUBLIC_FUNCTION(void, SetLoadingTimeBudget, float);
+	PUBLIC_FUNCTION(float, GetLoadingTimeBudget);
+	PUBLIC_FUNCTION(void, AddStreamingChunk, const String&, const RectF&);
+	PUBLIC_FUNCTION(void, RemoveStreamingChunk, const String&);
+	PUBLIC_FUNCTION(void, SetStreamingArea, const RectF&);
+	PUBLIC_FUNCTION(const RectF&, GetStreamingArea);
+	PUBLIC_FUNCTION(void, PrewarmPool, const ActorAssetRef&, int);
+	PUBLIC_FUNCTION(int, GetPooledActorsCount, const ActorAssetRef&);
+	PUBLIC_FUNCTION(void, ClearPools);
 	PUBLIC_FUNCTION(void, Save, const String&);
 	PUBLIC_FUNCTION(void, Save, DataDocument&);
 	PUBLIC_FUNCTION(void, Draw);
 	PUBLIC_FUNCTION(void, Update, float);
 	PUBLIC_FUNCTION(void, FixedUpdate, float);
 	PROTECTED_FUNCTION(void, UpdateActors, float);
+	PROTECTED_FUNCTION(void, UpdateLoading);
+	PROTECTED_FUNCTION(void, UpdateStreamingChunks);
+	PROTECTED_FUNCTION(void, UnloadStreamingChunk, StreamingChunk*);
+	PROTECTED_FUNCTION(void, CancelLoadingTasks);
 	PROTECTED_FUNCTION(void, UpdateAddedEntities);
 	PROTECTED_FUNCTION(void, UpdateStartingEntities);
 	PROTECTED_FUNCTION(void, UpdateDestroyingEntities);
@@ -415,6 +608,13 @@ CLASS_METHODS_META(o2::Scene)
 	PROTECTED_FUNCTION(void, AddActorToScene, Actor*);
 	PROTECTED_FUNCTION(void, AddActorToSceneDeferred, Actor*);
 	PROTECTED_FUNCTION(void, RemoveActorFromScene, Actor*, bool);
+	PROTECTED_FUNCTION(Actor*, TakePooledActor, const UID&);
+	PROTECTED_FUNCTION(void, PutPooledActor, Actor*);
+	PROTECTED_FUNCTION(void, SpawnPooledActor, Actor*);
+	PROTECTED_FUNCTION(void, DespawnActor, Actor*);
+	PROTECTED_FUNCTION(void, RemovePooledActor, Actor*);
+	PROTECTED_FUNCTION(void, RegisterComponent, Component*);
+	PROTECTED_FUNCTION(void, UnregisterComponent, Component*);
 	PROTECTED_FUNCTION(void, OnComponentAdded, Component*);
 	PROTECTED_FUNCTION(void, OnComponentRemoved, Component*);
 	PROTECTED_FUNCTION(void, OnLayerRenamed, SceneLayer*, const String&);
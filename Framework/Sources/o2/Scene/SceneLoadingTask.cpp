@@ -0,0 +1,219 @@
+#include "o2/stdafx.h"
+#include "SceneLoadingTask.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Scene.h"
+#include "o2/Scene/SceneLayer.h"
+#include "o2/Scene/Tags.h"
+#include "o2/Utils/System/Time/Timer.h"
+
+namespace o2
+{
+	SceneLoadingTask::SceneLoadingTask(const String& path, bool append):
+		mPath(path), mAppend(append), mParsed(false), mParsingSucceed(false)
+	{
+		mParsingThread = std::thread(&SceneLoadingTask::ParsingThreadFunc, this);
+	}
+
+	SceneLoadingTask::~SceneLoadingTask()
+	{
+		// Parsing can't be interrupted, wait it
+		if (mParsingThread.joinable())
+			mParsingThread.join();
+
+		if (mStage != Stage::Completed)
+		{
+			for (auto actor : mLoadedActors)
+			{
+				if (actor)
+					o2Scene.DestroyActor(actor);
+			}
+		}
+	}
+
+	float SceneLoadingTask::GetProgress() const
+	{
+		if (mStage == Stage::Completed)
+			return 1.0f;
+
+		if (mStage == Stage::Parsing)
+			return 0.0f;
+
+		// First tenth is parsing, the rest is actors instantiation
+		return 0.1f + 0.9f*(float)mLoadedActors.Count()/(float)Math::Max(mActorsCount, 1);
+	}
+
+	bool SceneLoadingTask::IsCompleted() const
+	{
+		return mStage == Stage::Completed;
+	}
+
+	bool SceneLoadingTask::IsAppend() const
+	{
+		return mAppend;
+	}
+
+	const String& SceneLoadingTask::GetPath() const
+	{
+		return mPath;
+	}
+
+	const Vector<Actor*>& SceneLoadingTask::GetLoadedActors() const
+	{
+		return mLoadedActors;
+	}
+
+	bool SceneLoadingTask::Update(float timeBudget)
+	{
+		if (mStage == Stage::Parsing)
+		{
+			if (!mParsed)
+				return false;
+
+			mParsingThread.join();
+
+			if (!mParsingSucceed)
+			{
+				o2Debug.LogError("Can't load scene " + mPath + ": failed to parse file");
+				mStage = Stage::Completed;
+				return true;
+			}
+
+			LoadLayersAndTags();
+
+			auto actorsNode = mData.FindMember("Actors");
+			mActorsCount = actorsNode ? actorsNode->GetElementsCount() : 0;
+			mLoadedActors.Reserve(mActorsCount);
+
+			mStage = Stage::Actors;
+		}
+
+		if (mStage == Stage::Actors)
+		{
+			LoadActors(timeBudget);
+
+			if (mLoadedActors.Count() == mActorsCount)
+				Complete();
+		}
+
+		return mStage == Stage::Completed;
+	}
+
+	void SceneLoadingTask::ParsingThreadFunc()
+	{
+		mParsingSucceed = mData.LoadFromFile(mPath);
+		mParsed = true;
+	}
+
+	void SceneLoadingTask::LoadLayersAndTags()
+	{
+		Scene& scene = o2Scene;
+
+		if (!mAppend)
+			scene.Clear(false);
+
+		if (auto layersNode = mData.FindMember("Layers"))
+		{
+			for (auto& layerNode : *layersNode)
+			{
+				auto layer = mnew SceneLayer();
+				layer->Deserialize(layerNode);
+
+				// Appended chunks usually share layers with scene
+				if (scene.mLayersMap.ContainsKey(layer->GetName()))
+				{
+					delete layer;
+					continue;
+				}
+
+				scene.mLayers.Add(layer);
+				scene.mLayersMap[layer->GetName()] = layer;
+			}
+		}
+
+		if (!mAppend)
+			scene.mDefaultLayer = scene.GetLayer(mData.GetMember("DefaultLayer"));
+
+		scene.onLayersListChanged();
+
+		if (auto tagsNode = mData.FindMember("Tags"))
+		{
+			for (auto& tagNode : *tagsNode)
+			{
+				auto tag = mnew Tag();
+				tag->Deserialize(tagNode);
+
+				if (scene.GetTag(tag->GetName()))
+				{
+					delete tag;
+					continue;
+				}
+
+				scene.mTags.Add(tag);
+			}
+		}
+	}
+
+	void SceneLoadingTask::LoadActors(float timeBudget)
+	{
+		if (mLoadedActors.Count() == mActorsCount)
+			return;
+
+		Scene& scene = o2Scene;
+		ActorDataValueConverter& converter = ActorDataValueConverter::Instance();
+		DataValue& actorsNode = mData.GetMember("Actors");
+
+		int unresolvedActorsBegin = converter.mUnresolvedActors.Count();
+		int newActorsBegin = converter.mNewActors.Count();
+		int addedActorsBegin = scene.mAddedActors.Count();
+
+		converter.LockPointersResolving();
+
+		Timer timer;
+		do
+		{
+			int idx = mLoadedActors.Count();
+			Actor*& actor = mLoadedActors.Add(nullptr);
+			actorsNode[idx].Get(actor);
+
+			if (actor)
+				actor->UpdateTransform();
+		}
+		while (mLoadedActors.Count() < mActorsCount && timer.GetTime() < timeBudget);
+
+		// Pointers between actors can't be resolved until all actors are loaded, and the scene must not see actors
+		// until then. Take slice results out of converter and scene, so other code can use them between slices
+		mUnresolvedActors.Add(converter.mUnresolvedActors.Take(unresolvedActorsBegin, converter.mUnresolvedActors.Count()));
+		converter.mUnresolvedActors.RemoveRange(unresolvedActorsBegin, converter.mUnresolvedActors.Count());
+
+		mNewActors.Add(converter.mNewActors.Take(newActorsBegin, converter.mNewActors.Count()));
+		converter.mNewActors.RemoveRange(newActorsBegin, converter.mNewActors.Count());
+
+		mPendingActors.Add(scene.mAddedActors.Take(addedActorsBegin, scene.mAddedActors.Count()));
+		scene.mAddedActors.RemoveRange(addedActorsBegin, scene.mAddedActors.Count());
+
+		converter.UnlockPointersResolving();
+	}
+
+	void SceneLoadingTask::Complete()
+	{
+		Scene& scene = o2Scene;
+		ActorDataValueConverter& converter = ActorDataValueConverter::Instance();
+
+		converter.mUnresolvedActors.Add(mUnresolvedActors);
+		converter.mNewActors.Add(mNewActors);
+		converter.ResolvePointers();
+
+		scene.mAddedActors.Add(mPendingActors);
+
+		mUnresolvedActors.Clear();
+		mNewActors.Clear();
+		mPendingActors.Clear();
+
+#if IS_EDITOR
+		scene.mChangedObjects.Clear();
+#endif
+
+		mStage = Stage::Completed;
+	}
+}
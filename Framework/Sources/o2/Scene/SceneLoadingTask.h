@@ -0,0 +1,91 @@
+#pragma once
+
+#include "o2/Scene/ActorDataValueConverter.h"
+#include "o2/Utils/Delegates.h"
+#include "o2/Utils/Serialization/DataValue.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+#include <atomic>
+#include <thread>
+
+namespace o2
+{
+	class Actor;
+
+	// ---------------------------------------------------------------------------------------------------------------
+	// Incremental scene loading task. File is parsed on worker thread, then actors are instantiated on main thread by
+	// slices limited by time budget, one slice per frame. Instantiated actors are kept out of scene until all of them
+	// are loaded and actors pointers are resolved, so OnAddToScene and OnStart see same state as with Scene::Load.
+	// Created by Scene::LoadAsync and updated by scene. Deleting not completed task destroys instantiated actors
+	// ---------------------------------------------------------------------------------------------------------------
+	class SceneLoadingTask
+	{
+	public:
+		Function<void()> onLoaded; // Loading completed event, called by scene on main thread
+
+	public:
+		// Destructor. Waits parsing thread, destroys instantiated actors when loading isn't completed
+		~SceneLoadingTask();
+
+		// Returns loading progress from 0 to 1
+		float GetProgress() const;
+
+		// Returns true when all actors are loaded and added to scene
+		bool IsCompleted() const;
+
+		// Returns true when old scene actors are kept
+		bool IsAppend() const;
+
+		// Returns scene file path
+		const String& GetPath() const;
+
+		// Returns loaded root actors
+		const Vector<Actor*>& GetLoadedActors() const;
+
+	protected:
+		// -------------
+		// Loading stage
+		// -------------
+		enum class Stage { Parsing, Actors, Completed };
+
+	protected:
+		String mPath;   // Scene file path
+		bool   mAppend; // Is old scene actors are kept
+
+		Stage mStage = Stage::Parsing; // Current loading stage
+
+		DataDocument      mData;           // Parsed scene data
+		std::thread       mParsingThread;  // Scene file parsing thread
+		std::atomic<bool> mParsed;         // Is parsing thread finished
+		bool              mParsingSucceed; // Is file parsed successfully. Written by parsing thread before mParsed
+
+		int            mActorsCount = 0; // Root actors count in scene data
+		Vector<Actor*> mLoadedActors;    // Loaded root actors. Storage is reserved, pointers resolving writes into it
+		Vector<Actor*> mPendingActors;   // Instantiated actors and their children, added to scene on completion
+
+		Vector<ActorDataValueConverter::ActorDef> mUnresolvedActors; // Not resolved actors pointers from loaded actors
+		Vector<Actor*>                            mNewActors;        // Created actors, used for pointers resolving
+
+	protected:
+		// Constructor. Starts parsing thread
+		SceneLoadingTask(const String& path, bool append);
+
+		// Instantiates actors until time budget is spent, at least one actor. Returns true when loading is completed
+		bool Update(float timeBudget);
+
+		// Parsing thread function
+		void ParsingThreadFunc();
+
+		// Loads layers and tags, clears scene when not appending
+		void LoadLayersAndTags();
+
+		// Instantiates actors until time budget is spent
+		void LoadActors(float timeBudget);
+
+		// Resolves actors pointers and adds actors to scene
+		void Complete();
+
+		friend class Scene;
+	};
+}
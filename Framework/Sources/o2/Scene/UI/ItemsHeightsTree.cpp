@@ -0,0 +1,213 @@
+#include "o2/stdafx.h"
+#include "ItemsHeightsTree.h"
+
+#include "o2/Utils/Math/Math.h"
+
+namespace o2
+{
+	ItemsHeightsTree::ItemsHeightsTree(float defaultHeight /*= 0.0f*/):
+		mDefaultHeight(defaultHeight)
+	{
+		mTree.Add(0.0);
+	}
+
+	void ItemsHeightsTree::SetDefaultHeight(float height)
+	{
+		if (Math::Equals(mDefaultHeight, height))
+			return;
+
+		mDefaultHeight = height;
+		RebuildTree();
+	}
+
+	float ItemsHeightsTree::GetDefaultHeight() const
+	{
+		return mDefaultHeight;
+	}
+
+	void ItemsHeightsTree::Reset(int count)
+	{
+		mHeights.Clear();
+		Resize(count);
+	}
+
+	void ItemsHeightsTree::Resize(int count)
+	{
+		count = Math::Max(count, 0);
+
+		int lastCount = mHeights.Count();
+		if (count == lastCount)
+			return;
+
+		if (count < lastCount)
+		{
+			mHeights.RemoveRange(count, lastCount);
+			mTree.RemoveRange(count + 1, lastCount + 1);
+			return;
+		}
+
+		mHeights.Resize(count);
+		for (int i = lastCount; i < count; i++)
+			mHeights[i] = -1.0f;
+
+		AppendNodes(lastCount);
+	}
+
+	void ItemsHeightsTree::Insert(int position, int count)
+	{
+		position = Math::Clamp(position, 0, mHeights.Count());
+		if (count <= 0)
+			return;
+
+		if (position == mHeights.Count())
+		{
+			Resize(mHeights.Count() + count);
+			return;
+		}
+
+		Vector<float> inserting;
+		inserting.Resize(count);
+		for (auto& height : inserting)
+			height = -1.0f;
+
+		mHeights.Insert(inserting, position);
+		RebuildTree();
+	}
+
+	void ItemsHeightsTree::Remove(int position, int count)
+	{
+		position = Math::Clamp(position, 0, mHeights.Count());
+		count = Math::Min(count, mHeights.Count() - position);
+		if (count <= 0)
+			return;
+
+		if (position + count == mHeights.Count())
+		{
+			Resize(position);
+			return;
+		}
+
+		mHeights.RemoveRange(position, position + count);
+		RebuildTree();
+	}
+
+	int ItemsHeightsTree::GetCount() const
+	{
+		return mHeights.Count();
+	}
+
+	void ItemsHeightsTree::SetHeight(int idx, float height)
+	{
+		if (idx < 0 || idx >= mHeights.Count())
+			return;
+
+		height = Math::Max(height, 0.0f);
+		float lastHeight = GetHeight(idx);
+		mHeights[idx] = height;
+
+		if (!Math::Equals(lastHeight, height))
+			AddHeight(idx, (double)height - (double)lastHeight);
+	}
+
+	float ItemsHeightsTree::GetHeight(int idx) const
+	{
+		float height = mHeights[idx];
+		return height < 0.0f ? mDefaultHeight : height;
+	}
+
+	bool ItemsHeightsTree::IsMeasured(int idx) const
+	{
+		return mHeights[idx] >= 0.0f;
+	}
+
+	float ItemsHeightsTree::GetPosition(int idx) const
+	{
+		return (float)GetPrefixSum(Math::Clamp(idx, 0, mHeights.Count()));
+	}
+
+	int ItemsHeightsTree::FindItem(float position) const
+	{
+		int count = mHeights.Count();
+		if (count == 0)
+			return -1;
+
+		int step = 1;
+		while (step*2 <= count)
+			step *= 2;
+
+		// Descends from the largest node, collecting items which end before or at position
+		int idx = 0;
+		double rest = position;
+		for (; step > 0; step /= 2)
+		{
+			int next = idx + step;
+			if (next <= count && mTree[next] <= rest)
+			{
+				idx = next;
+				rest -= mTree[next];
+			}
+		}
+
+		return Math::Min(idx, count - 1);
+	}
+
+	float ItemsHeightsTree::GetTotalHeight() const
+	{
+		return (float)GetPrefixSum(mHeights.Count());
+	}
+
+	ItemsHeightsTree::Anchor ItemsHeightsTree::GetAnchor(float position) const
+	{
+		Anchor anchor;
+		anchor.index = Math::Max(FindItem(position), 0);
+		anchor.offset = position - GetPosition(anchor.index);
+		return anchor;
+	}
+
+	float ItemsHeightsTree::GetPosition(const Anchor& anchor) const
+	{
+		return GetPosition(anchor.index) + anchor.offset;
+	}
+
+	double ItemsHeightsTree::GetPrefixSum(int count) const
+	{
+		double sum = 0.0;
+		for (int i = count; i > 0; i -= i & -i)
+			sum += mTree[i];
+
+		return sum;
+	}
+
+	void ItemsHeightsTree::AddHeight(int idx, double delta)
+	{
+		int count = mHeights.Count();
+		for (int i = idx + 1; i <= count; i += i & -i)
+			mTree[i] += delta;
+	}
+
+	void ItemsHeightsTree::AppendNodes(int fromIdx)
+	{
+		// Node i covers items (i - lowbit(i), i], all of them except last are already in tree
+		int count = mHeights.Count();
+		mTree.Resize(count + 1);
+		for (int i = fromIdx + 1; i <= count; i++)
+			mTree[i] = (double)GetHeight(i - 1) + GetPrefixSum(i - 1) - GetPrefixSum(i - (i & -i));
+	}
+
+	void ItemsHeightsTree::RebuildTree()
+	{
+		int count = mHeights.Count();
+		mTree.Resize(count + 1);
+		mTree[0] = 0.0;
+
+		for (int i = 1; i <= count; i++)
+			mTree[i] = GetHeight(i - 1);
+
+		for (int i = 1; i <= count; i++)
+		{
+			int parent = i + (i & -i);
+			if (parent <= count)
+				mTree[parent] += mTree[i];
+		}
+	}
+}
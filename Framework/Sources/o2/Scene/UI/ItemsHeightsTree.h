@@ -0,0 +1,93 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------------------------
+	// Vertical list items heights with prefix sums in Fenwick tree. Maps item index to position and position to item in
+	// O(log n), so virtualized lists don't need fixed item height. Items are measured lazily: not measured item uses
+	// default height until SetHeight is called for it, usually when item widget becomes visible first time
+	// -----------------------------------------------------------------------------------------------------------------
+	class ItemsHeightsTree
+	{
+	public:
+		// ---------------------------------------------------------------------------------------------
+		// Scroll anchor: item and offset from its top. Keeps view on same item when heights are changed
+		// ---------------------------------------------------------------------------------------------
+		struct Anchor
+		{
+			int   index = 0;     // Anchor item index
+			float offset = 0.0f; // Offset from item top
+		};
+
+	public:
+		// Constructor
+		ItemsHeightsTree(float defaultHeight = 0.0f);
+
+		// Sets height of not measured items
+		void SetDefaultHeight(float height);
+
+		// Returns height of not measured items
+		float GetDefaultHeight() const;
+
+		// Sets items count, all items become not measured
+		void Reset(int count);
+
+		// Sets items count, keeps heights of remaining items. New items are added to the end not measured
+		void Resize(int count);
+
+		// Inserts not measured items at position
+		void Insert(int position, int count);
+
+		// Removes items range from position
+		void Remove(int position, int count);
+
+		// Returns items count
+		int GetCount() const;
+
+		// Sets measured item height
+		void SetHeight(int idx, float height);
+
+		// Returns item height, default for not measured item
+		float GetHeight(int idx) const;
+
+		// Returns true when item height was measured
+		bool IsMeasured(int idx) const;
+
+		// Returns item top position, sum of heights of items before it
+		float GetPosition(int idx) const;
+
+		// Returns index of item at position, clamped by items range. Returns -1 when there are no items
+		int FindItem(float position) const;
+
+		// Returns sum of all items heights
+		float GetTotalHeight() const;
+
+		// Returns anchor of position
+		Anchor GetAnchor(float position) const;
+
+		// Returns position of anchor
+		float GetPosition(const Anchor& anchor) const;
+
+	protected:
+		float mDefaultHeight = 0.0f; // Height of not measured items
+
+		Vector<float>  mHeights; // Measured items heights, negative when item is not measured
+		Vector<double> mTree;    // Fenwick tree of items heights, 1-based. Node i is sum of items (i - lowbit(i), i]
+
+	protected:
+		// Returns sum of heights of first count items
+		double GetPrefixSum(int count) const;
+
+		// Adds height delta to item
+		void AddHeight(int idx, double delta);
+
+		// Appends tree nodes for new items in the end of heights
+		void AppendNodes(int fromIdx);
+
+		// Rebuilds whole tree from heights
+		void RebuildTree();
+	};
+}
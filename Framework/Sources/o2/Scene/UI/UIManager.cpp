@@ -27,6 +27,10 @@
 #include "o2/Scene/UI/Widgets/Window.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
+#include "o2/Utils/Editor/EditorScope.h"
+#include "o2/Utils/FileSystem/File.h"
+#include "o2/Utils/Serialization/BinaryDataFormat.h"
 #include "o2/Utils/System/Time/Timer.h"
 
 #undef CreateWindow
@@ -123,15 +127,15 @@ namespace o2
 	{
 		Timer t;
 
-		for (auto st : mStyleSamples)
-			delete st;
-
-		mStyleSamples.Clear();
+		ClearStyle();
 
 		data.Get(mStyleSamples);
 
 		for (auto styleSample : mStyleSamples)
+		{
 			styleSample->Hide(true);
+			AddStyleToIndex(styleSample);
+		}
 
 		o2Debug.Log("Loaded styles for " + String(t.GetDeltaTime()) + "sec");
 	}
@@ -147,15 +151,133 @@ namespace o2
 
 	void UIManager::SaveStyle(DataValue& data)
 	{
+		LoadAllStyleSamples();
 		data = mStyleSamples;
 	}
 
+	bool UIManager::LoadStyleSnapshot(const String& path, const DataValue& tag)
+	{
+		Timer t;
+
+		MappedFile snapshot(path, MappedFile::AccessHint::Random);
+		if (!snapshot.IsOpened())
+			return false;
+
+		// Header is signature and index size, index is followed by samples data
+		UInt64 header[2];
+		if (snapshot.GetDataSize() < sizeof(header))
+			return false;
+
+		memcpy(header, snapshot.GetData(), sizeof(header));
+		if (header[0] != mStyleSnapshotMagic || header[1] > snapshot.GetDataSize() - sizeof(header))
+			return false;
+
+		DataDocument index;
+		if (!ParseBinary(snapshot.GetData() + sizeof(header), (size_t)header[1], index))
+			return false;
+
+		const DataValue* snapshotTag = index.FindMember("tag");
+		const DataValue* samples = index.FindMember("samples");
+		if (!snapshotTag || !samples || !samples->IsArray() || *snapshotTag != tag)
+			return false;
+
+		ClearStyle();
+
+		mStyleSnapshotDataOffset = sizeof(header) + header[1];
+		UInt64 samplesDataSize = snapshot.GetDataSize() - mStyleSnapshotDataOffset;
+
+		for (auto& sampleData : *samples)
+		{
+			String typeName = sampleData["type"];
+			String style = sampleData["style"];
+
+			StyleSample sample;
+			sample.snapshotOffset = sampleData["offset"];
+			sample.snapshotSize = sampleData["size"];
+
+			const Type* type = Reflection::GetType(typeName);
+			if (!type || sample.snapshotSize == 0 || sample.snapshotOffset > samplesDataSize ||
+				sample.snapshotSize > samplesDataSize - sample.snapshotOffset)
+			{
+				mLog->WarningStr("Can't load style " + style + " of type " + typeName + " from snapshot " + path);
+				continue;
+			}
+
+			auto& typeStyles = mStylesIndex[type];
+			if (typeStyles.ContainsKey(style))
+				continue;
+
+			typeStyles.Add(style, sample);
+			mStyleSnapshotNotLoaded++;
+		}
+
+		if (mStyleSnapshotNotLoaded > 0)
+		{
+			mStyleSnapshot = std::move(snapshot);
+			mStyleSnapshotScopeDepth = EditorScope::GetDepth();
+		}
+
+		o2Debug.Log("Loaded styles snapshot " + path + " with " + String(mStyleSnapshotNotLoaded) + " styles for " +
+					String(t.GetDeltaTime()) + "sec");
+
+		return true;
+	}
+
+	bool UIManager::SaveStyleSnapshot(const String& path, const DataValue& tag)
+	{
+		LoadAllStyleSamples();
+
+		DataDocument index;
+		index.AddMember("tag") = tag;
+		DataValue& samplesIndex = index.AddMember("samples");
+
+		String samplesData;
+		for (auto& typeStyles : mStylesIndex)
+		{
+			for (auto& style : typeStyles.second)
+			{
+				if (!style.second.widget)
+					continue;
+
+				DataDocument sampleData;
+				sampleData = style.second.widget;
+
+				String sampleBuffer = sampleData.SaveAsString(DataDocument::Format::Binary);
+
+				DataValue& sampleIndex = samplesIndex.AddElement();
+				sampleIndex.AddMember("type") = typeStyles.first->GetName();
+				sampleIndex.AddMember("style") = style.first;
+				sampleIndex.AddMember("offset") = (UInt64)samplesData.size();
+				sampleIndex.AddMember("size") = (UInt64)sampleBuffer.size();
+
+				samplesData += sampleBuffer;
+			}
+		}
+
+		String indexData = index.SaveAsString(DataDocument::Format::Binary);
+		UInt64 header[2] = { mStyleSnapshotMagic, (UInt64)indexData.size() };
+
+		OutFile file(path);
+		if (!file.IsOpened())
+			return false;
+
+		file.WriteData(header, sizeof(header));
+		file.WriteData(indexData.Data(), (UInt)indexData.size());
+		file.WriteData(samplesData.Data(), (UInt)samplesData.size());
+
+		return true;
+	}
+
 	void UIManager::ClearStyle()
 	{
 		for (auto sample : mStyleSamples)
 			delete sample;
 
 		mStyleSamples.Clear();
+		mStylesIndex.Clear();
+
+		mStyleSnapshot.Close();
+		mStyleSnapshotNotLoaded = 0;
 	}
 
 	void UIManager::AddWidgetStyle(Widget* widget, const String& style)
@@ -163,6 +285,18 @@ namespace o2
 		widget->Hide(true);
 		widget->SetName(style);
 		mStyleSamples.Add(widget);
+		AddStyleToIndex(widget);
+	}
+
+	void UIManager::RemoveWidgetStyle(const Type& type, const String& style)
+	{
+		Widget* widget = GetWidgetStyle(type, style);
+		if (!widget)
+			return;
+
+		mStyleSamples.Remove(widget);
+		RemoveStyleFromIndex(widget);
+		delete widget;
 	}
 
 	Widget* UIManager::CreateWidget(const Type& type, const String& style /*= "standard"*/)
@@ -186,16 +320,18 @@ namespace o2
 
 	Widget* UIManager::GetWidgetStyle(const Type& type, const String& style)
 	{
-		for (auto styleWidget : mStyleSamples)
-		{
-			if (type == styleWidget->GetType())
-			{
-				if (style == styleWidget->GetName())
-					return styleWidget;
-			}
-		}
+		auto typeStyles = mStylesIndex.TryGetValuePtr(&type);
+		if (!typeStyles)
+			return nullptr;
+
+		auto sample = typeStyles->TryGetValuePtr(style);
+		if (!sample)
+			return nullptr;
+
+		if (sample->snapshotSize > 0)
+			return LoadStyleSample(&type, style);
 
-		return nullptr;
+		return sample->widget;
 	}
 
 	Button* UIManager::CreateButton(const WString& caption, const Function<void()>& onClick /*= Function<void()>()*/,
@@ -329,8 +465,10 @@ namespace o2
 
 	void UIManager::Draw()
 	{
+		PROFILE_FUNCTION();
+
 		for (auto widget : mTopWidgets)
-			widget->Draw();
+			widget->DrawWithCache();
 
 		mTopWidgets.Clear();
 
@@ -348,6 +486,7 @@ namespace o2
 
 	const Vector<Widget*>& UIManager::GetWidgetStyles() const
 	{
+		LoadAllStyleSamples();
 		return mStyleSamples;
 	}
 
@@ -356,4 +495,109 @@ namespace o2
 		if (o2Assets.IsAssetExist("ui_style.json"))
 			LoadStyle("ui_style.json");
 	}
+
+	void UIManager::AddStyleToIndex(Widget* widget)
+	{
+		auto& typeStyles = mStylesIndex[&widget->GetType()];
+		if (typeStyles.ContainsKey(widget->GetName()))
+			return;
+
+		StyleSample sample;
+		sample.widget = widget;
+		typeStyles.Add(widget->GetName(), sample);
+	}
+
+	void UIManager::RemoveStyleFromIndex(Widget* widget)
+	{
+		auto typeStyles = mStylesIndex.TryGetValuePtr(&widget->GetType());
+		if (!typeStyles)
+			return;
+
+		auto sample = typeStyles->TryGetValuePtr(widget->GetName());
+		if (!sample || sample->widget != widget)
+			return;
+
+		typeStyles->Remove(widget->GetName());
+
+		for (auto styleWidget : mStyleSamples)
+		{
+			if (styleWidget != widget && styleWidget->GetType() == widget->GetType() &&
+				styleWidget->GetName() == widget->GetName())
+			{
+				AddStyleToIndex(styleWidget);
+				break;
+			}
+		}
+	}
+
+	Widget* UIManager::LoadStyleSample(const Type* type, const String& name) const
+	{
+		auto typeStyles = mStylesIndex.TryGetValuePtr(type);
+		if (!typeStyles)
+			return nullptr;
+
+		auto sample = typeStyles->TryGetValuePtr(name);
+		if (!sample)
+			return nullptr;
+
+		if (sample->snapshotSize == 0)
+			return sample->widget;
+
+		const char* data = mStyleSnapshot.GetData() + mStyleSnapshotDataOffset + sample->snapshotOffset;
+		size_t size = (size_t)sample->snapshotSize;
+
+		// Sample is marked as loaded before deserialization, so nested requests don't load it again
+		sample->snapshotSize = 0;
+		mStyleSnapshotNotLoaded--;
+
+		Widget* widget = nullptr;
+		DataDocument sampleData;
+		if (ParseBinary(data, size, sampleData))
+		{
+			// Samples are deserialized in same editor scope as styles were loaded, not as requesting code
+			ForcePopEditorScopeOnStack popScope;
+			PushEditorScopeOnStack pushScope(mStyleSnapshotScopeDepth);
+
+			sampleData.Get(widget);
+		}
+
+		if (widget)
+		{
+			widget->Hide(true);
+			mStyleSamples.Add(widget);
+		}
+		else
+			mLog->ErrorStr("Failed to load style sample from snapshot " + mStyleSnapshot.GetFilename());
+
+		// Deserialization can add styles into index and move samples, so sample is searched again
+		typeStyles = mStylesIndex.TryGetValuePtr(type);
+		sample = typeStyles ? typeStyles->TryGetValuePtr(name) : nullptr;
+		if (sample && !sample->widget)
+			sample->widget = widget;
+
+		if (mStyleSnapshotNotLoaded == 0)
+			mStyleSnapshot.Close();
+
+		return widget;
+	}
+
+	void UIManager::LoadAllStyleSamples() const
+	{
+		if (mStyleSnapshotNotLoaded == 0)
+			return;
+
+		// Deserialization can change index, so keys of not loaded samples are collected first
+		Vector<Pair<const Type*, String>> notLoadedSamples;
+		for (auto& typeStyles : mStylesIndex)
+		{
+			for (auto& style : typeStyles.second)
+			{
+				if (style.second.snapshotSize > 0)
+					notLoadedSamples.Add(Pair<const Type*, String>(typeStyles.first, style.first));
+			}
+		}
+
+		for (auto& sampleKey : notLoadedSamples)
+			LoadStyleSample(sampleKey.first, sampleKey.second);
+	}
 }
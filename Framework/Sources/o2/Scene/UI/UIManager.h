@@ -2,9 +2,11 @@
 
 #include "o2/Scene/UI/Widgets/ContextMenu.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/FileSystem/MappedFile.h"
 #include "o2/Utils/Property.h"
 #include "o2/Utils/Reflection/Type.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
 
 // User interfaces manager access macros
 #define o2UI UIManager::Instance()
@@ -32,9 +34,10 @@ namespace o2
 
 #undef CreateWindow
 
-	// ------------------------------------------------
-	// UI manager, contains all root widgets and styles
-	// ------------------------------------------------
+	// --------------------------------------------------------------------------------------------------------------
+	// UI manager, contains all root widgets and styles. Styles are indexed by type and name. Styles can be loaded
+	// from binary snapshot: it is mapped into memory and each style sample is deserialized only when it is requested
+	// --------------------------------------------------------------------------------------------------------------
 	class UIManager : public Singleton<UIManager>
 	{
 	public:
@@ -50,6 +53,13 @@ namespace o2
 		// Saves style
 		void SaveStyle(DataValue& data);
 
+		// Loads styles snapshot. Snapshot is loaded only when its tag is equal to tag. Style samples are deserialized
+		// on first request, so loading doesn't depend on styles count. Returns true when snapshot is loaded
+		bool LoadStyleSnapshot(const String& path, const DataValue& tag);
+
+		// Saves all styles into binary snapshot with tag. Returns true when snapshot is saved
+		bool SaveStyleSnapshot(const String& path, const DataValue& tag);
+
 		// Clears style widgets
 		void ClearStyle();
 
@@ -66,6 +76,9 @@ namespace o2
 		template<typename _type>
 		_type* GetWidgetStyle(const String& style);
 
+		// Removes widget style
+		void RemoveWidgetStyle(const Type& type, const String& style);
+
 		// Removes widget style
 		template<typename _type>
 		void RemoveWidgetStyle(const String& style);
@@ -141,9 +154,22 @@ namespace o2
 		// Registering widget for drawing at top of all regular widgets
 		void DrawWidgetAtTop(Widget* widget);
 
-		// Returns all styles widgets
+		// Returns all styles widgets. Loads all not loaded styles from snapshot
 		const Vector<Widget*>& GetWidgetStyles() const;
 
+	protected:
+		// ------------------------------------------------------------------------
+		// Style sample in index. Not loaded sample has snapshot data and no widget
+		// ------------------------------------------------------------------------
+		struct StyleSample
+		{
+			Widget* widget = nullptr;   // Loaded sample widget
+			UInt64  snapshotOffset = 0; // Sample data offset in snapshot
+			UInt64  snapshotSize = 0;   // Sample data size in snapshot, zero when sample isn't in snapshot or loaded
+		};
+
+		static constexpr UInt64 mStyleSnapshotMagic = 0x31544e534c595453; // Styles snapshot file signature
+
 	protected:
 		LogStream * mLog = nullptr;          // UI Log stream
 
@@ -151,7 +177,13 @@ namespace o2
 		Vector<Widget*> mFocusableWidgets;        // List of selectable widgets
 		Vector<Widget*> mTopWidgets;              // Top widgets, drawing after mScreenWidget 
 
-		Vector<Widget*> mStyleSamples; // Style widgets
+		mutable Vector<Widget*>                                    mStyleSamples; // Loaded style widgets. Lazy loaded from snapshot
+		mutable HashMap<const Type*, HashMap<String, StyleSample>> mStylesIndex;  // Style samples by type and name, first added sample wins
+
+		mutable MappedFile mStyleSnapshot;               // Mapped styles snapshot, opened while there are not loaded samples
+		UInt64             mStyleSnapshotDataOffset = 0; // Offset of samples data in snapshot
+		int                mStyleSnapshotScopeDepth = 0; // Editor scope depth when snapshot was loaded, samples are deserialized with it
+		mutable int        mStyleSnapshotNotLoaded = 0;  // Count of not loaded samples from snapshot
 
 	protected:
 		// Default constructor
@@ -163,6 +195,18 @@ namespace o2
 		// Tries to load style "ui_style.json"
 		void TryLoadStyle();
 
+		// Adds style sample into index, when there is no style with same type and name
+		void AddStyleToIndex(Widget* widget);
+
+		// Removes style sample from index. Other sample with same type and name takes its place
+		void RemoveStyleFromIndex(Widget* widget);
+
+		// Deserializes style sample with type and name from snapshot. Closes snapshot when all samples are loaded
+		Widget* LoadStyleSample(const Type* type, const String& name) const;
+
+		// Deserializes all not loaded style samples from snapshot
+		void LoadAllStyleSamples() const;
+
 		friend class Application;
 		friend class BaseApplication;
 		friend class CustomDropDown;
@@ -173,27 +217,13 @@ namespace o2
 	template<typename _type>
 	_type* UIManager::GetWidgetStyle(const String& style /*= "standard"*/)
 	{
-		for (auto styleWidget : mStyleSamples)
-		{
-			if (TypeOf(_type) == styleWidget->GetType())
-			{
-				if (style == styleWidget->GetName())
-					return dynamic_cast<_type*>(styleWidget);
-			}
-		}
-
-		return nullptr;
+		return dynamic_cast<_type*>(GetWidgetStyle(TypeOf(_type), style));
 	}
 
 	template<typename _type>
 	void UIManager::RemoveWidgetStyle(const String& style)
 	{
-		_type* widgetStyle = GetWidgetStyle<_type>(style);
-		if (widgetStyle)
-		{
-			mStyleSamples.Remove(widgetStyle);
-			delete widgetStyle;
-		}
+		RemoveWidgetStyle(TypeOf(_type), style);
 	}
 
 	template<typename _type>
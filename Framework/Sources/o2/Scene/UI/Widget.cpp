@@ -2,7 +2,9 @@
 #include "Widget.h"
 
 #include "o2/Application/Input.h"
+#include "o2/Events/EventSystem.h"
 #include "o2/Render/Render.h"
+#include "o2/Render/Sprite.h"
 #include "o2/Scene/Scene.h"
 #include "o2/Scene/SceneLayer.h"
 #include "o2/Scene/UI/UIManager.h"
@@ -42,7 +44,7 @@ namespace o2
 
 	Widget::Widget(const Widget& other):
 		Actor(mnew WidgetLayout(*other.layout), other), layout(dynamic_cast<WidgetLayout*>(transform)),
-		mTransparency(other.mTransparency), transparency(this), resTransparency(this),
+		mTransparency(other.mTransparency), mCacheAsBitmap(other.mCacheAsBitmap), transparency(this), resTransparency(this),
 		childrenWidgets(this), layers(this), states(this), childWidget(this), layer(this), state(this)
 	{
 		layout->SetOwner(this);
@@ -118,6 +120,8 @@ namespace o2
 		if (UIManager::IsSingletonInitialzed())
 			o2UI.mFocusableWidgets.Remove(this);
 
+		ReleaseCache();
+
 		if (IsOnScene())
 			ISceneDrawable::OnRemoveFromScene();
 	}
@@ -186,8 +190,11 @@ namespace o2
 
 	void Widget::UpdateTransform()
 	{
-		if (GetLayoutData().drivenByParent && mParentWidget) {
+		// Parent arranges this widget and updates whole subtree, so arranging once from top widget
+		if (GetLayoutData().drivenByParent && mParentWidget)
+		{
 			mParentWidget->UpdateTransform();
+			return;
 		}
 
 		UpdateSelfTransform();
@@ -215,6 +222,12 @@ namespace o2
 		layout->SetDirty(false);
 	}
 
+	void Widget::InvalidateMeasure()
+	{
+		for (Widget* widget = this; widget; widget = widget->mParentWidget)
+			widget->mMeasureDirty = true;
+	}
+
 	void Widget::Draw()
 	{
 		if (!mResEnabledInHierarchy || mIsClipped)
@@ -222,7 +235,7 @@ namespace o2
 			if (mIsClipped)
 			{
 				for (auto child : mDrawingChildren)
-					child->Draw();
+					child->DrawWithCache();
 			}
 
 			return;
@@ -234,10 +247,10 @@ namespace o2
 		OnDrawn();
 
 		for (auto child : mDrawingChildren)
-			child->Draw();
+			child->DrawWithCache();
 
 		for (auto child : mInternalWidgets)
-			child->Draw();
+			child->DrawWithCache();
 
 		for (auto layer : mTopDrawingLayers)
 			layer->Draw();
@@ -245,6 +258,124 @@ namespace o2
 		DrawDebugFrame();
 	}
 
+	void Widget::DrawWithCache()
+	{
+		if (!mCacheAsBitmap || !mResEnabledInHierarchy || mIsClipped)
+		{
+			Draw();
+			return;
+		}
+
+		if (mCacheDirty || !mCacheListeners || !mCacheListeners->complete)
+		{
+			if (!RedrawCache())
+			{
+				Draw();
+				return;
+			}
+		}
+		else
+			EventSystem::ReplayDrawnListeners(*mCacheListeners);
+
+		mCacheSprite->Draw();
+	}
+
+	void Widget::SetCacheAsBitmap(bool enabled)
+	{
+		mCacheAsBitmap = enabled;
+
+		if (mCacheAsBitmap)
+			InvalidateCache();
+		else
+			ReleaseCache();
+	}
+
+	bool Widget::IsCacheAsBitmap() const
+	{
+		return mCacheAsBitmap;
+	}
+
+	void Widget::InvalidateCache()
+	{
+		// Parent's cache contains this widget too. Cached ancestors can be clean while this one is dirty,
+		// so going up to the root every time
+		for (Widget* widget = this; widget; widget = widget->mParentWidget)
+		{
+			if (widget->mCacheAsBitmap)
+				widget->mCacheDirty = true;
+		}
+	}
+
+	bool Widget::RedrawCache()
+	{
+		// Unbinding cache texture returns drawing into back buffer, so widget can't be cached while other render
+		// target is bound, for example by cached parent. Parent's bitmap contains this widget anyway
+		if (!o2Render.IsRenderTextureAvailable() || o2Render.GetRenderTexture())
+			return false;
+
+		RectF bounds = mBoundsWithChilds;
+		for (auto child : mInternalWidgets)
+		{
+			if (child->mResEnabledInHierarchy)
+				bounds.Expand(child->mBoundsWithChilds);
+		}
+
+		RectI rect(Math::FloorToInt(bounds.left), Math::CeilToInt(bounds.top),
+				   Math::CeilToInt(bounds.right), Math::FloorToInt(bounds.bottom));
+
+		Vec2I size = rect.Size();
+		Vec2I maxSize = o2Render.GetMaxTextureSize();
+		if (size.x <= 0 || size.y <= 0 || size.x > maxSize.x || size.y > maxSize.y)
+			return false;
+
+		if (!mCacheSprite)
+		{
+			mCacheSprite = mnew Sprite();
+			mCacheListeners = mnew DrawnListenersRecord();
+		}
+
+		if (!mCacheTexture || mCacheTexture->GetSize() != size)
+		{
+			mCacheTexture = TextureRef(size, PixelFormat::R8G8B8A8, Texture::Usage::RenderTarget);
+			*mCacheSprite = Sprite(mCacheTexture, RectI(Vec2I(), size));
+		}
+
+		mCacheSprite->SetRect((RectF)rect);
+
+		RectF clipRect = (RectF)o2Render.GetResScissorRect();
+		Camera prevCamera = o2Render.GetCamera();
+
+		o2Render.BindRenderTexture(mCacheTexture);
+		o2Render.Clear(Color4(0, 0, 0, 0));
+		o2Render.SetCamera(Camera(((RectF)rect).Center(), (Vec2F)size));
+
+		// Widget can be invalidated while drawing, then it must be redrawn on next frame
+		mCacheDirty = false;
+
+		EventSystem::BeginDrawnListenersRecording(mCacheListeners);
+		Draw();
+		EventSystem::EndDrawnListenersRecording(clipRect);
+
+		o2Render.UnbindRenderTexture();
+		o2Render.SetCamera(prevCamera);
+
+		return true;
+	}
+
+	void Widget::ReleaseCache()
+	{
+		if (mCacheSprite)
+			delete mCacheSprite;
+
+		if (mCacheListeners)
+			delete mCacheListeners;
+
+		mCacheSprite = nullptr;
+		mCacheListeners = nullptr;
+		mCacheTexture = TextureRef();
+		mCacheDirty = true;
+	}
+
 	void Widget::DrawDebugFrame()
 	{
 		if (!IsUIDebugEnabled() && !o2Input.IsKeyDown(VK_F2))
@@ -263,6 +394,8 @@ namespace o2
 
 	void Widget::OnTransformUpdated()
 	{
+		InvalidateCache();
+
 		mIsClipped = false;
 		Actor::OnTransformUpdated();
 		UpdateLayersLayouts();
@@ -679,22 +812,41 @@ namespace o2
 
 	float Widget::GetMinWidthWithChildren() const
 	{
-		return GetLayoutData().minSize.x;
+		UpdateMeasure();
+		return mMeasuredMinSize.x;
 	}
 
 	float Widget::GetMinHeightWithChildren() const
 	{
-		return GetLayoutData().minSize.y;
+		UpdateMeasure();
+		return mMeasuredMinSize.y;
 	}
 
 	float Widget::GetWidthWeightWithChildren() const
 	{
-		return GetLayoutData().weight.x;
+		UpdateMeasure();
+		return mMeasuredWeight.x;
 	}
 
 	float Widget::GetHeightWeightWithChildren() const
 	{
-		return GetLayoutData().weight.y;
+		UpdateMeasure();
+		return mMeasuredWeight.y;
+	}
+
+	void Widget::UpdateMeasure() const
+	{
+		if (!mMeasureDirty)
+			return;
+
+		MeasureWithChildren(mMeasuredMinSize, mMeasuredWeight);
+		mMeasureDirty = false;
+	}
+
+	void Widget::MeasureWithChildren(Vec2F& minSize, Vec2F& weight) const
+	{
+		minSize = GetLayoutData().minSize;
+		weight = GetLayoutData().weight;
 	}
 
 	void Widget::UpdateBoundsWithChilds()
@@ -721,6 +873,8 @@ namespace o2
 
 	void Widget::UpdateTransparency()
 	{
+		InvalidateCache();
+
 		if (mParentWidget)
 			mResTransparency = mTransparency*mParentWidget->mResTransparency;
 		else
@@ -756,6 +910,8 @@ namespace o2
 
 	void Widget::UpdateLayersLayouts()
 	{
+		InvalidateCache();
+
 		for (auto layer : mLayers)
 			layer->UpdateLayout();
 
@@ -764,6 +920,8 @@ namespace o2
 
 	void Widget::UpdateDrawingChildren()
 	{
+		InvalidateCache();
+
 		mDrawingChildren.Clear();
 
 		for (auto child : mChildWidgets)
@@ -799,6 +957,8 @@ namespace o2
 
 	void Widget::UpdateLayersDrawingSequence()
 	{
+		InvalidateCache();
+
 		const float topLayersDepth = 1000.0f;
 
 		mDrawingLayers.Clear();
@@ -1156,6 +1316,7 @@ namespace o2
 			}
 
 			layout->SetDirty(false);
+			InvalidateCache();
 
 			if constexpr (IS_EDITOR)
 			{
@@ -1205,6 +1366,11 @@ namespace o2
 		mTransparency = other.mTransparency;
 		mIsFocusable = other.mIsFocusable;
 
+		// Cached bitmap is drawn from old layers and children, and isn't needed when other isn't cached
+		ReleaseCache();
+		mCacheAsBitmap = other.mCacheAsBitmap;
+		InvalidateCache();
+
 		for (auto layer : other.mLayers)
 		{
 			auto newLayer = mnew WidgetLayer(*layer);
@@ -1303,6 +1469,8 @@ namespace o2
 
 	void Widget::MoveAndCheckClipping(const Vec2F& delta, const RectF& clipArea)
 	{
+		InvalidateCache();
+
 		mBoundsWithChilds += delta;
 		mIsClipped = !mBoundsWithChilds.IsIntersects(clipArea);
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "o2/Assets/Types/AnimationAsset.h"
+#include "o2/Render/TextureRef.h"
 #include "o2/Scene/Actor.h"
 #include "o2/Scene/ISceneDrawable.h"
 #include "o2/Utils/Editor/Attributes/AnimatableAttribute.h"
@@ -13,11 +14,14 @@
 namespace o2
 {
 	class IRectDrawable;
+	class Sprite;
 	class WidgetLayer;
 	class WidgetLayout;
 	class WidgetLayoutData;
 	class WidgetState;
 
+	struct DrawnListenersRecord;
+
 	// ------------------------------------------------------
 	// Basic UI Widget. Its a simple and basic element of UI, 
 	// everything other UI's are based on this
@@ -89,9 +93,27 @@ namespace o2
 		// Forcible drawing in area with transparency
 		void ForceDraw(const RectF& area, float transparency);
 
+		// Draws widget from cached bitmap when caching is enabled, otherwise draws it as usual. Parents draw children by it
+		void DrawWithCache();
+
+		// Enables caching widget with children into bitmap. While nothing inside changes, widget is drawn by one sprite.
+		// Suits for mostly static opaque panels: semi-transparent edges are blended twice. Widget inside cached parent
+		// or other render target is redrawn without own cache
+		void SetCacheAsBitmap(bool enabled);
+
+		// Returns is widget with children cached into bitmap
+		bool IsCacheAsBitmap() const;
+
+		// Marks cached bitmaps of this widget and parents as dirty. Call it when drawing changes without layout,
+		// transparency, states or text changes
+		void InvalidateCache();
+
 		// Sets layout dirty, and update it in update loop
 		void SetLayoutDirty();
 
+		// Marks measured sizes of this widget and parents as dirty. They are measured again once on next request
+		void InvalidateMeasure();
+
 		// Returns parent widget
 		Widget* GetParentWidget() const;
 
@@ -285,6 +307,16 @@ namespace o2
 		RectF mBounds;           // Widget bounds by drawing layers
 		RectF mBoundsWithChilds; // Widget with childs bounds
 
+		bool                  mCacheAsBitmap = false;    // Is widget with children cached into bitmap @SERIALIZABLE
+		bool                  mCacheDirty = true;        // Is cached bitmap must be redrawn
+		TextureRef            mCacheTexture;             // Cached bitmap render target
+		Sprite*               mCacheSprite = nullptr;    // Cached bitmap sprite
+		DrawnListenersRecord* mCacheListeners = nullptr; // Cursor listeners drawn into cached bitmap, registered again when drawing from cache
+
+		mutable Vec2F mMeasuredMinSize;     // Cached minimal size with children
+		mutable Vec2F mMeasuredWeight;      // Cached weight with children
+		mutable bool  mMeasureDirty = true; // Is cached sizes must be measured again
+
 	protected:
 		// Updates result read enable flag
 		void UpdateResEnabled() override;
@@ -346,17 +378,23 @@ namespace o2
 		// It is called when widget was deselected
 		virtual void OnUnfocused();
 
-		// Returns layout width with children
-		virtual float GetMinWidthWithChildren() const;
+		// Returns layout width with children. Measured once after layout changes
+		float GetMinWidthWithChildren() const;
+
+		// Returns layout height with children. Measured once after layout changes
+		float GetMinHeightWithChildren() const;
 
-		// Returns layout height with childer
-		virtual float GetMinHeightWithChildren() const;
+		// Returns layout width weight with children. Measured once after layout changes
+		float GetWidthWeightWithChildren() const;
 
-		// Returns layout width weight with children
-		virtual float GetWidthWeightWithChildren() const;
+		// Returns layout height weight with children. Measured once after layout changes
+		float GetHeightWeightWithChildren() const;
 
-		// Returns layout height weight with children
-		virtual float GetHeightWeightWithChildren() const;
+		// Measures minimal size and weight with children again when they are dirty
+		void UpdateMeasure() const;
+
+		// Measures minimal size and weight with children. By default they are taken from layout
+		virtual void MeasureWithChildren(Vec2F& minSize, Vec2F& weight) const;
 
 		// Updates bounds by drawing layers
 		virtual void UpdateBounds();
@@ -391,6 +429,12 @@ namespace o2
 		// Draws debug frame by mAbsoluteRect
 		void DrawDebugFrame();
 
+		// Redraws widget into cached bitmap. Returns false when widget can't be cached
+		bool RedrawCache();
+
+		// Releases cached bitmap
+		void ReleaseCache();
+
 		// Updates drawing children widgets list
 		void UpdateDrawingChildren();
 
@@ -431,6 +475,7 @@ namespace o2
 		void OnDeserialized(const DataValue& node) override;
 
 		friend class ContextMenu;
+		friend class CursorAreaEventsListener;
 		friend class CustomDropDown;
 		friend class CustomList;
 		friend class DropDown;
@@ -739,6 +784,13 @@ CLASS_FIELDS_META(o2::Widget)
 	PROTECTED_FIELD(mIsClipped).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mBounds);
 	PROTECTED_FIELD(mBoundsWithChilds);
+	PROTECTED_FIELD(mCacheAsBitmap).DEFAULT_VALUE(false).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mCacheDirty).DEFAULT_VALUE(true);
+	PROTECTED_FIELD(mCacheTexture);
+	PROTECTED_FIELD(mCacheSprite).DEFAULT_VALUE(nullptr);
+	PROTECTED_FIELD(mMeasuredMinSize);
+	PROTECTED_FIELD(mMeasuredWeight);
+	PROTECTED_FIELD(mMeasureDirty).DEFAULT_VALUE(true);
 	PROTECTED_FIELD(layersEditable);
 	PROTECTED_FIELD(internalChildrenEditable);
 }
@@ -757,7 +809,12 @@ CLASS_METHODS_META(o2::Widget)
 	PUBLIC_FUNCTION(void, UpdateChildrenTransforms);
 	PUBLIC_FUNCTION(void, Draw);
 	PUBLIC_FUNCTION(void, ForceDraw, const RectF&, float);
+	PUBLIC_FUNCTION(void, DrawWithCache);
+	PUBLIC_FUNCTION(void, SetCacheAsBitmap, bool);
+	PUBLIC_FUNCTION(bool, IsCacheAsBitmap);
+	PUBLIC_FUNCTION(void, InvalidateCache);
 	PUBLIC_FUNCTION(void, SetLayoutDirty);
+	PUBLIC_FUNCTION(void, InvalidateMeasure);
 	PUBLIC_FUNCTION(Widget*, GetParentWidget);
 	PUBLIC_FUNCTION(const RectF&, GetChildrenWorldRect);
 	PUBLIC_FUNCTION(Widget*, GetChildWidget, const String&);
@@ -828,6 +885,8 @@ CLASS_METHODS_META(o2::Widget)
 	PROTECTED_FUNCTION(float, GetMinHeightWithChildren);
 	PROTECTED_FUNCTION(float, GetWidthWeightWithChildren);
 	PROTECTED_FUNCTION(float, GetHeightWeightWithChildren);
+	PROTECTED_FUNCTION(void, UpdateMeasure);
+	PROTECTED_FUNCTION(void, MeasureWithChildren, Vec2F&, Vec2F&);
 	PROTECTED_FUNCTION(void, UpdateBounds);
 	PROTECTED_FUNCTION(void, UpdateBoundsWithChilds);
 	PROTECTED_FUNCTION(void, CheckClipping, const RectF&);
@@ -839,6 +898,8 @@ CLASS_METHODS_META(o2::Widget)
 	PROTECTED_FUNCTION(void, OnStateAdded, WidgetState*);
 	PROTECTED_FUNCTION(void, OnStatesListChanged);
 	PROTECTED_FUNCTION(void, DrawDebugFrame);
+	PROTECTED_FUNCTION(bool, RedrawCache);
+	PROTECTED_FUNCTION(void, ReleaseCache);
 	PROTECTED_FUNCTION(void, UpdateDrawingChildren);
 	PROTECTED_FUNCTION(void, UpdateLayersDrawingSequence);
 	PROTECTED_FUNCTION(void, RetargetStatesAnimations);
@@ -102,6 +102,7 @@ namespace o2
 		{
 			mOwnerWidget->UpdateLayersDrawingSequence();
 			mOwnerWidget->UpdateTransform();
+			mOwnerWidget->InvalidateCache();
 		}
 	}
 
@@ -133,6 +134,9 @@ namespace o2
 	void WidgetLayer::SetEnabled(bool enabled)
 	{
 		mEnabled = enabled;
+
+		if (mOwnerWidget)
+			mOwnerWidget->InvalidateCache();
 	}
 
 	WidgetLayer* WidgetLayer::AddChild(WidgetLayer* node)
@@ -299,7 +303,10 @@ namespace o2
 	{
 		mDepth = depth;
 		if (mOwnerWidget)
+		{
 			mOwnerWidget->UpdateLayersDrawingSequence();
+			mOwnerWidget->InvalidateCache();
+		}
 	}
 
 	float WidgetLayer::GetDepth() const
@@ -411,6 +418,9 @@ namespace o2
 		if (mDrawable)
 			mDrawable->SetTransparency(mResTransparency);
 
+		if (mOwnerWidget)
+			mOwnerWidget->InvalidateCache();
+
 		for (auto child : mChildren)
 			child->UpdateResTransparency();
 	}
@@ -625,6 +635,8 @@ namespace o2
 
 	void WidgetLayer::OnChanged()
 	{
+		mChangesVersion++;
+
 		if (mOwnerWidget)
 			mOwnerWidget->OnChanged();
 	}
@@ -606,6 +606,10 @@ namespace o2
 
 	void WidgetLayout::SetDirty(bool fromParent /*= false*/)
 	{
+		// Parent's changes don't affect measured sizes, only own and children's changes do
+		if (!fromParent && mData->owner)
+			mData->owner->InvalidateMeasure();
+
 		if (!fromParent && mData->drivenByParent && mData->owner)
 		{
 			if (auto parent = mData->owner->mParent)
@@ -75,6 +75,9 @@ namespace o2
 
 		mState = state;
 
+		if (mOwner)
+			mOwner->InvalidateCache();
+
 		if (state)
 		{
 			player.speed = 1.0f;
@@ -104,6 +107,9 @@ namespace o2
 
 		mState = state;
 
+		if (mOwner)
+			mOwner->InvalidateCache();
+
 		if (mState)
 		{
 			player.GoToEnd();
@@ -131,6 +137,9 @@ namespace o2
 		{
 			player.Update(dt);
 
+			if (mOwner)
+				mOwner->InvalidateCache();
+
 			if (!player.IsPlaying())
 			{
 				if (mState) onStateFullyTrue();
@@ -4,6 +4,7 @@
 #include "o2/Render/Text.h"
 #include "o2/Scene/UI/UIManager.h"
 #include "o2/Scene/UI/WidgetLayer.h"
+#include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Scene/UI/WidgetState.h"
 
 namespace o2
@@ -42,6 +43,8 @@ namespace o2
 	{
 		if (mCaptionText)
 			mCaptionText->SetText(text);
+
+		InvalidateCache();
 	}
 
 	WString Button::GetCaption() const
@@ -79,6 +82,15 @@ namespace o2
 		return mDrawingScissorRect.IsInside(point) && isPointInside(point);
 	}
 
+	RectF Button::GetCursorAreaBounds() const
+	{
+		// Custom area can be anywhere in clipping rect
+		if (!isPointInside.IsEmpty())
+			return mScissorRect;
+
+		return layout->GetWorldAxisAlignedRect();
+	}
+
 	String Button::GetCreateMenuGroup()
 	{
 		return "Basic";
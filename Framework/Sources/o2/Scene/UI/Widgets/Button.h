@@ -58,6 +58,9 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns world rectangle of button, or scissor rect when custom point checking function is used
+		RectF GetCursorAreaBounds() const override;
+
 		// Returns create menu group in editor
 		static String GetCreateMenuGroup();
 
@@ -135,6 +138,7 @@ CLASS_METHODS_META(o2::Button)
 	PUBLIC_FUNCTION(Sprite*, GetIcon);
 	PUBLIC_FUNCTION(bool, IsFocusable);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
 	PROTECTED_FUNCTION(void, OnCursorPressed, const Input::Cursor&);
@@ -671,7 +671,7 @@ namespace o2
 		o2Render.EnableScissorTest(mAbsoluteClipArea);
 
 		for (auto child : mChildWidgets)
-			child->Draw();
+			child->DrawWithCache();
 
 		mSelectionDrawable->Draw();
 
@@ -872,6 +872,8 @@ namespace o2
 		auto textLayer = GetLayerDrawable<Text>("basic/caption");
 		if (textLayer)
 			textLayer->text = text;
+
+		InvalidateCache();
 	}
 
 	WString ContextMenuItem::GetText() const
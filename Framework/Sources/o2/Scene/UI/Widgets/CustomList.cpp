@@ -97,7 +97,7 @@ namespace o2
 		o2Render.EnableScissorTest(mAbsoluteClipArea);
 
 		for (auto child : mDrawingChildren)
-			child->Draw();
+			child->DrawWithCache();
 
 		for (auto& sel : mSelectedItems)
 			sel.selection->Draw();
@@ -479,8 +479,37 @@ namespace o2
 		if (!mVerLayout)
 			return nullptr;
 
+		auto& items = mVerLayout->mChildWidgets;
+
+		// Items arranged from top to bottom are searched in O(log n): first item with bottom under point
+		if (items.Count() > 1 && items[0]->layout->GetWorldBottom() >= items.Last()->layout->GetWorldBottom())
+		{
+			int first = 0, last = items.Count() - 1;
+			while (first < last)
+			{
+				int middle = (first + last)/2;
+				if (items[middle]->layout->GetWorldBottom() > point.y)
+					first = middle + 1;
+				else
+					last = middle;
+			}
+
+			if (items[first]->layout->IsPointInside(point))
+			{
+				if (idxPtr)
+					*idxPtr = first;
+
+				return items[first];
+			}
+
+			if (idxPtr)
+				*idxPtr = -1;
+
+			return nullptr;
+		}
+
 		int idx = 0;
-		for (auto child : mVerLayout->mChildWidgets)
+		for (auto child : items)
 		{
 			if (child->layout->IsPointInside(point))
 			{
@@ -75,7 +75,7 @@ namespace o2
 			mCaretDrawable->Draw();
 
 		for (auto child : mDrawingChildren)
-			child->Draw();
+			child->DrawWithCache();
 
 		o2Render.DisableScissorTest();
 
@@ -100,6 +100,10 @@ namespace o2
 		if (!mResEnabledInHierarchy || mIsClipped)
 			return;
 
+		// Caret is blinking while focused, cached drawing isn't actual
+		if (mIsFocused)
+			InvalidateCache();
+
 		UpdateCaretBlinking(dt);
 
 		mJustFocused = false;
@@ -767,6 +771,8 @@ namespace o2
 
 	void EditBox::UpdateSelectionAndCaret()
 	{
+		InvalidateCache();
+
 		Vec2F caretPosition = GetTextCaretPosition(mSelectionEnd);
 		mCaretDrawable->SetPosition(caretPosition);
 
@@ -182,47 +182,38 @@ namespace o2
 		SetLayoutDirty();
 	}
 
-	float HorizontalLayout::GetMinWidthWithChildren() const
+	void HorizontalLayout::MeasureWithChildren(Vec2F& minSize, Vec2F& weight) const
 	{
-		if (!mFitByChildren)
-			return Widget::GetMinWidthWithChildren();
+		Widget::MeasureWithChildren(minSize, weight);
 
-		float res = mBorder.left + mBorder.right + Math::Max(mChildWidgets.Count() - 1, 0)*mSpacing;
+		weight.x = 0;
 		for (auto child : mChildWidgets)
 		{
 			if (child->mResEnabledInHierarchy)
-				res += child->GetMinWidthWithChildren();
+				weight.x += child->GetWidthWeightWithChildren();
 		}
 
-		res = Math::Max(res, GetLayoutData().minSize.x);
-
-		return res;
-	}
-
-	float HorizontalLayout::GetMinHeightWithChildren() const
-	{
 		if (!mFitByChildren)
-			return Widget::GetMinHeightWithChildren();
+			return;
 
-		float res = 0;
+		float height = 0;
 		for (auto child : mChildWidgets)
 		{
 			if (child->mResEnabledInHierarchy)
-				res = Math::Max(res, child->GetMinHeightWithChildren() + mBorder.top + mBorder.bottom);
+				height = Math::Max(height, child->GetMinHeightWithChildren() + mBorder.top + mBorder.bottom);
 		}
 
-		res = Math::Max(res, GetLayoutData().minSize.y);
-
-		return res;
+		minSize.x = Math::Max(GetChildrenMinWidth(), minSize.x);
+		minSize.y = Math::Max(height, minSize.y);
 	}
 
-	float HorizontalLayout::GetWidthWeightWithChildren() const
+	float HorizontalLayout::GetChildrenMinWidth() const
 	{
-		float res = 0;
+		float res = mBorder.left + mBorder.right + Math::Max(mChildWidgets.Count() - 1, 0)*mSpacing;
 		for (auto child : mChildWidgets)
 		{
 			if (child->mResEnabledInHierarchy)
-				res += child->GetWidthWeightWithChildren();
+				res += child->GetMinWidthWithChildren();
 		}
 
 		return res;
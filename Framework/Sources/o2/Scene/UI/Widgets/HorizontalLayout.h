@@ -118,14 +118,12 @@ namespace o2
 		// Copies data of actor from other to this
 		void CopyData(const Actor& otherActor) override;
 
-		// Returns layout width
-		float GetMinWidthWithChildren() const override;
+		// Measures minimal size and weight with children: width weight is sum of children weights, when fitting by
+		// children minimal size contains children
+		void MeasureWithChildren(Vec2F& minSize, Vec2F& weight) const override;
 
-		// Returns layout height
-		float GetMinHeightWithChildren() const override;
-
-		// Returns layout width weight with children
-		float GetWidthWeightWithChildren() const override;
+		// Returns summary minimal width of children with spacing and borders
+		float GetChildrenMinWidth() const;
 
 		// It is called when child widget was added
 		void OnChildAdded(Widget* child) override;
@@ -207,9 +205,8 @@ CLASS_METHODS_META(o2::HorizontalLayout)
 	PUBLIC_FUNCTION(void, UpdateSelfTransform);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
-	PROTECTED_FUNCTION(float, GetMinWidthWithChildren);
-	PROTECTED_FUNCTION(float, GetMinHeightWithChildren);
-	PROTECTED_FUNCTION(float, GetWidthWeightWithChildren);
+	PROTECTED_FUNCTION(void, MeasureWithChildren, Vec2F&, Vec2F&);
+	PROTECTED_FUNCTION(float, GetChildrenMinWidth);
 	PROTECTED_FUNCTION(void, OnChildAdded, Widget*);
 	PROTECTED_FUNCTION(void, OnChildRemoved, Widget*);
 	PROTECTED_FUNCTION(void, RearrangeChilds);
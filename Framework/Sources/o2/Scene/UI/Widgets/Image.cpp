@@ -52,6 +52,7 @@ namespace o2
 			mImage = dynamic_cast<Sprite*>(AddLayer("image", mnew Sprite())->GetDrawable());
 
 		mImage->LoadFromImage(asset);
+		InvalidateCache();
 	}
 
 	ImageAssetRef Image::GetImageAsset() const
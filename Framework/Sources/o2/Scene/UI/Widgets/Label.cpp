@@ -70,7 +70,7 @@ namespace o2
 		OnDrawn();
 
 		for (auto child : mDrawingChildren)
-			child->Draw();
+			child->DrawWithCache();
 
 		for (auto layer : mTopDrawingLayers)
 			layer->Draw();
@@ -98,6 +98,8 @@ namespace o2
 	{
 		if (mTextDrawable)
 			mTextDrawable->SetFontAsset(asset);
+
+		InvalidateCache();
 	}
 
 	FontAssetRef Label::GetFontAsset() const
@@ -113,6 +115,8 @@ namespace o2
 		if (mTextDrawable)
 			mTextDrawable->SetText(text);
 
+		InvalidateCache();
+
 		if (mHorOverflow == HorOverflow::Expand || mVerOverflow == VerOverflow::Expand)
 			SetLayoutDirty();
 	}
@@ -129,6 +133,8 @@ namespace o2
 	{
 		if (mTextDrawable)
 			mTextDrawable->SetColor(color);
+
+		InvalidateCache();
 	}
 
 	Color4 Label::GetColor() const
@@ -247,6 +253,8 @@ namespace o2
 	{
 		if (mTextDrawable)
 			mTextDrawable->SetHeight(height);
+
+		InvalidateCache();
 	}
 
 	int Label::GetHeight() const
@@ -268,7 +276,12 @@ namespace o2
 				float realSize = mTextDrawable->GetRealSize().x + mExpandBorder.x*2.0f;
 				float thisSize = layout->width;
 				float sizeDelta = realSize - thisSize;
-				GetLayoutData().minSize.x = realSize;
+
+				if (!Math::Equals(GetLayoutData().minSize.x, realSize))
+				{
+					GetLayoutData().minSize.x = realSize;
+					InvalidateMeasure();
+				}
 
 				switch (mTextDrawable->GetHorAlign())
 				{
@@ -79,7 +79,7 @@ namespace o2
 		o2Render.EnableScissorTest(mAbsoluteClipArea);
 
 		for (auto child : mDrawingChildren)
-			child->Draw();
+			child->DrawWithCache();
 
 		mSelectionDrawable->Draw();
 		mHoverDrawable->Draw();
@@ -105,6 +105,7 @@ namespace o2
 		delete mItemSample;
 		mItemSample = sample;
 
+		mItemsHeights.Reset(0);
 		SetLayoutDirty();
 	}
 
@@ -183,12 +184,43 @@ namespace o2
 		SetLayoutDirty();
 	}
 
+	void LongList::OnItemsInserted(int position, int count)
+	{
+		auto anchor = mItemsHeights.GetAnchor(mScrollPos.y);
+		if (position <= anchor.index && mScrollPos.y > 0.0f)
+			anchor.index += count;
+
+		if (mSelectedItem >= position)
+			mSelectedItem += count;
+
+		mItemsHeights.Insert(position, count);
+		RestoreScrollAnchor(anchor);
+	}
+
+	void LongList::OnItemsRemoved(int position, int count)
+	{
+		auto anchor = mItemsHeights.GetAnchor(mScrollPos.y);
+		if (anchor.index >= position + count)
+			anchor.index -= count;
+		else if (anchor.index >= position)
+			anchor = { position, 0.0f };
+
+		if (mSelectedItem >= position + count)
+			mSelectedItem -= count;
+		else if (mSelectedItem >= position)
+			mSelectedItem = -1;
+
+		mItemsHeights.Remove(position, count);
+		RestoreScrollAnchor(anchor);
+	}
+
 	void LongList::CalculateScrollArea()
 	{
 		Vec2F offset;
 		InitializeScrollAreaRectCalculation(offset);
 
-		float itemsHeight = (float)getItemsCountFunc()*mItemSample->layout->GetMinHeight();
+		UpdateItemsHeights();
+		float itemsHeight = mItemsHeights.GetTotalHeight();
 		RecalculateScrollAreaRect(RectF(0, mAbsoluteViewArea.Height(), mAbsoluteViewArea.Width(), mAbsoluteViewArea.Height() - itemsHeight), Vec2F());
 	}
 
@@ -228,17 +260,41 @@ namespace o2
 
 	void LongList::UpdateVisibleItems()
 	{
-		int lastMinItemIdx = mMinVisibleItemIdx;
-		int lastMaxItemIdx = mMaxVisibleItemIdx;
+		UpdateItemsHeights();
 
-		float itemHeight = mItemSample->layout->minHeight;
-
-		if (itemHeight < FLT_EPSILON)
+		if (mItemsHeights.GetDefaultHeight() < FLT_EPSILON)
 			return;
 
-		mMinVisibleItemIdx = Math::FloorToInt(mScrollPos.y / itemHeight);
-		mMaxVisibleItemIdx = Math::FloorToInt((mScrollPos.y + mAbsoluteViewArea.Height()) / itemHeight);
-		mMaxVisibleItemIdx = Math::Min(mMaxVisibleItemIdx, getItemsCountFunc() - 1);
+		// Newly visible items are measured, range is updated again when their heights differ from default
+		const int maxMeasurePasses = 3;
+		for (int pass = 0; pass < maxMeasurePasses; pass++)
+		{
+			if (!UpdateVisibleItemsRange())
+				break;
+		}
+
+		float position = mItemsHeights.GetPosition(mMinVisibleItemIdx);
+		for (int i = mMinVisibleItemIdx; i <= mMaxVisibleItemIdx; i++)
+		{
+			float itemHeight = mItemsHeights.GetHeight(i);
+			Widget* child = mChildWidgets[i - mMinVisibleItemIdx];
+
+			*child->layout = WidgetLayout::HorStretch(VerAlign::Top, 0, 0, itemHeight, position);
+			position += itemHeight;
+
+			child->UpdateSelfTransform();
+			child->UpdateChildrenTransforms();
+			child->mIsClipped = false;
+		}
+	}
+
+	bool LongList::UpdateVisibleItemsRange()
+	{
+		int lastMinItemIdx = mMinVisibleItemIdx;
+		int lastMaxItemIdx = mMaxVisibleItemIdx;
+
+		mMinVisibleItemIdx = Math::Max(mItemsHeights.FindItem(mScrollPos.y), 0);
+		mMaxVisibleItemIdx = mItemsHeights.FindItem(mScrollPos.y + mAbsoluteViewArea.Height());
 
 		auto itemsInRange = getItemsRangeFunc(mMinVisibleItemIdx, mMaxVisibleItemIdx + 1);
 		Vector<Widget*> itemsWidgets;
@@ -263,11 +319,9 @@ namespace o2
 		mChildWidgets.Clear();
 		mDrawingChildren.Clear();
 
+		bool heightsChanged = false;
 		for (int i = mMinVisibleItemIdx; i <= mMaxVisibleItemIdx; i++)
 		{
-			if (i < 0)
-				continue;
-
 			if (i >= lastMinItemIdx && i <= lastMaxItemIdx)
 				continue;
 
@@ -282,10 +336,18 @@ namespace o2
 			}
 
 			Widget* newItem = mItemsPool.PopBack();
+			void* itemObject = itemsInRange[i - mMinVisibleItemIdx];
 
-			setupItemFunc(newItem, itemsInRange[i - mMinVisibleItemIdx]);
+			setupItemFunc(newItem, itemObject);
 
-			*newItem->layout = WidgetLayout::HorStretch(VerAlign::Top, 0, 0, itemHeight, itemHeight*(float)i);
+			if (!mItemsHeights.IsMeasured(i))
+			{
+				float defaultHeight = mItemsHeights.GetDefaultHeight();
+				float itemHeight = measureItemFunc ? measureItemFunc(newItem, itemObject) : newItem->layout->GetMinHeight();
+
+				mItemsHeights.SetHeight(i, itemHeight);
+				heightsChanged = heightsChanged || !Math::Equals(itemHeight, defaultHeight);
+			}
 
 			newItem->mParent = this;
 			newItem->mParentWidget = this;
@@ -297,12 +359,37 @@ namespace o2
 		mChildWidgets.Add(itemsWidgets);
 		mDrawingChildren.Add(itemsWidgets);
 
+		return heightsChanged;
+	}
+
+	void LongList::UpdateItemsHeights()
+	{
+		mItemsHeights.SetDefaultHeight(mItemSample->layout->GetMinHeight());
+		mItemsHeights.Resize(getItemsCountFunc());
+	}
+
+	void LongList::ReleaseVisibleItems()
+	{
 		for (auto child : mChildWidgets)
-		{
-			child->UpdateSelfTransform();
-			child->UpdateChildrenTransforms();
-			child->mIsClipped = false;
-		}
+			mItemsPool.Add(child);
+
+		mChildren.Clear();
+		mChildWidgets.Clear();
+		mDrawingChildren.Clear();
+
+		mMinVisibleItemIdx = -1;
+		mMaxVisibleItemIdx = -1;
+	}
+
+	void LongList::RestoreScrollAnchor(const ItemsHeightsTree::Anchor& anchor)
+	{
+		// Visible widgets are bound to old indexes, so they are set up again
+		ReleaseVisibleItems();
+
+		UpdateScrollParams();
+		SetScrollForcible(Vec2F(mScrollPos.x, mItemsHeights.GetPosition(anchor)));
+
+		SetLayoutDirty();
 	}
 
 	void LongList::OnCursorPressed(const Input::Cursor& cursor)
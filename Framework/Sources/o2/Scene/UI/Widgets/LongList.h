@@ -1,14 +1,17 @@
 #pragma once
 
 #include "o2/Render/Sprite.h"
+#include "o2/Scene/UI/ItemsHeightsTree.h"
 #include "ScrollArea.h"
 #include "o2/Scene/UI/Widgets/VerticalLayout.h"
 
 namespace o2
 {
-	// ---------------------------------------------
-	// List view widget with selection and many data
-	// ---------------------------------------------
+	// -----------------------------------------------------------------------------------------------------------------
+	// List view widget with selection and many data. Only visible items have widgets, they are taken from pool and set
+	// up by setupItemFunc. Items can have different heights: item is measured when it becomes visible first time, until
+	// that it has item sample height
+	// -----------------------------------------------------------------------------------------------------------------
 	class LongList: public ScrollArea
 	{
 
@@ -22,6 +25,7 @@ namespace o2
 		Function<int()>                          getItemsCountFunc; // Items count getting function
 		Function<Vector<void*>(int, int)> getItemsRangeFunc; // Items getting in range function
 		Function<void(Widget*, void*)>    setupItemFunc;     // Setup item widget function
+		Function<float(Widget*, void*)>   measureItemFunc;   // Item height measuring function, called after first setup. Item widget minimal height is used when empty
 
 	public:
 	    // Default constructor
@@ -75,6 +79,12 @@ namespace o2
 		// Updates items
 		void OnItemsUpdated(bool itemsRearranged = false);
 
+		// It is called when items were inserted at position. Keeps visible items at their places on screen
+		void OnItemsInserted(int position, int count);
+
+		// It is called when items were removed from position. Keeps visible items at their places on screen
+		void OnItemsRemoved(int position, int count);
+
 		// Updates layout
 		void UpdateSelfTransform() override;
 
@@ -105,6 +115,8 @@ namespace o2
 					 						    
 		Vector<Widget*> mItemsPool; // Items pool
 
+		ItemsHeightsTree mItemsHeights; // Items heights and positions, items are measured when become visible
+
 	protected:
 		// Copies data of actor from other to this
 		void CopyData(const Actor& otherActor) override;
@@ -127,6 +139,19 @@ namespace o2
 		// Updates visible items
 		void UpdateVisibleItems();
 
+		// Updates visible items range, takes widgets for new visible items from pool and measures them. Returns true
+		// when measured heights were changed and range must be updated again
+		bool UpdateVisibleItemsRange();
+
+		// Synchronizes items heights count and default height with items and sample
+		void UpdateItemsHeights();
+
+		// Returns all visible items widgets into pool
+		void ReleaseVisibleItems();
+
+		// Scrolls to anchor after items were inserted or removed
+		void RestoreScrollAnchor(const ItemsHeightsTree::Anchor& anchor);
+
 		// It is called when cursor pressed on this
 		void OnCursorPressed(const Input::Cursor& cursor) override;
 
@@ -174,6 +199,7 @@ CLASS_FIELDS_META(o2::LongList)
 	PUBLIC_FIELD(getItemsCountFunc);
 	PUBLIC_FIELD(getItemsRangeFunc);
 	PUBLIC_FIELD(setupItemFunc);
+	PUBLIC_FIELD(measureItemFunc);
 	PROTECTED_FIELD(mItemSample).DEFAULT_VALUE(nullptr).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mSelectionDrawable).DEFAULT_VALUE(nullptr).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mHoverDrawable).DEFAULT_VALUE(nullptr).SERIALIZABLE_ATTRIBUTE();
@@ -189,6 +215,7 @@ CLASS_FIELDS_META(o2::LongList)
 	PROTECTED_FIELD(mLastHoverCheckCursor);
 	PROTECTED_FIELD(mLastSelectCheckCursor);
 	PROTECTED_FIELD(mItemsPool);
+	PROTECTED_FIELD(mItemsHeights);
 }
 END_META;
 CLASS_METHODS_META(o2::LongList)
@@ -207,6 +234,8 @@ CLASS_METHODS_META(o2::LongList)
 	PUBLIC_FUNCTION(void, SetHoverDrawableLayout, const Layout&);
 	PUBLIC_FUNCTION(Layout, GetHoverDrawableLayout);
 	PUBLIC_FUNCTION(void, OnItemsUpdated, bool);
+	PUBLIC_FUNCTION(void, OnItemsInserted, int, int);
+	PUBLIC_FUNCTION(void, OnItemsRemoved, int, int);
 	PUBLIC_FUNCTION(void, UpdateSelfTransform);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
@@ -216,6 +245,10 @@ CLASS_METHODS_META(o2::LongList)
 	PROTECTED_FUNCTION(void, CalculateScrollArea);
 	PROTECTED_FUNCTION(void, MoveScrollPosition, const Vec2F&);
 	PROTECTED_FUNCTION(void, UpdateVisibleItems);
+	PROTECTED_FUNCTION(bool, UpdateVisibleItemsRange);
+	PROTECTED_FUNCTION(void, UpdateItemsHeights);
+	PROTECTED_FUNCTION(void, ReleaseVisibleItems);
+	PROTECTED_FUNCTION(void, RestoreScrollAnchor, const ItemsHeightsTree::Anchor&);
 	PROTECTED_FUNCTION(void, OnCursorPressed, const Input::Cursor&);
 	PROTECTED_FUNCTION(void, OnCursorStillDown, const Input::Cursor&);
 	PROTECTED_FUNCTION(void, OnCursorMoved, const Input::Cursor&);
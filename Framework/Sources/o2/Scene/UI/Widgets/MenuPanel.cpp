@@ -103,7 +103,7 @@ namespace o2
 		IDrawable::OnDrawn();
 
 		for (auto child : mDrawingChildren)
-			child->Draw();
+			child->DrawWithCache();
 
 		mSelectionDrawable->Draw();
 
@@ -227,7 +227,7 @@ namespace o2
 		o2Render.EnableScissorTest(mAbsoluteClipArea);
 
 		for (auto child : mChildWidgets)
-			child->Draw();
+			child->DrawWithCache();
 
 		o2Render.DisableScissorTest();
 
@@ -75,7 +75,7 @@ namespace o2
 			if (mIsClipped)
 			{
 				for (auto child : mDrawingChildren)
-					child->Draw();
+					child->DrawWithCache();
 			}
 
 			return;
@@ -89,14 +89,14 @@ namespace o2
 		o2Render.EnableScissorTest(mAbsoluteClipArea);
 
 		for (auto child : mDrawingChildren)
-			child->Draw();
+			child->DrawWithCache();
 
 		o2Render.DisableScissorTest();
 
 		CursorAreaEventsListener::OnDrawn();
 
 		for (auto child : mInternalWidgets)
-			child->Draw();
+			child->DrawWithCache();
 
 		for (auto layer : mTopDrawingLayers)
 			layer->Draw();
@@ -444,6 +444,11 @@ namespace o2
 		return Widget::IsUnderPoint(point);
 	}
 
+	RectF ScrollArea::GetCursorAreaBounds() const
+	{
+		return layout->GetWorldAxisAlignedRect();
+	}
+
 	bool ScrollArea::IsScrollable() const
 	{
 		return true;
@@ -68,7 +68,9 @@ namespace o2
 		if (expandBtn)
 			expandBtn->SetState("expanded", expand);
 
-		mTargetHeight = VerticalLayout::GetMinHeightWithChildren();
+		Vec2F expandedMinSize, expandedWeight;
+		VerticalLayout::MeasureWithChildren(expandedMinSize, expandedWeight);
+		mTargetHeight = expandedMinSize.y;
 	}
 
 	bool Spoiler::IsExpanded() const
@@ -94,14 +96,14 @@ namespace o2
 				o2Render.EnableScissorTest(mBounds);
 
 			for (auto child : mDrawingChildren)
-				child->Draw();
+				child->DrawWithCache();
 
 			if (clipping)
 				o2Render.DisableScissorTest();
 		}
 
 		for (auto child : mInternalWidgets)
-			child->Draw();
+			child->DrawWithCache();
 
 		for (auto layer : mTopDrawingLayers)
 			layer->Draw();
@@ -114,6 +116,8 @@ namespace o2
 		auto textLayer = GetLayerDrawable<Text>("caption");
 		if (textLayer)
 			textLayer->text = caption;
+
+		InvalidateCache();
 	}
 
 	const WString& Spoiler::GetCaption() const
@@ -128,6 +132,7 @@ namespace o2
 	void Spoiler::SetHeadHeight(float height)
 	{
 		mHeadHeight = height;
+		layout->SetDirty();
 	}
 
 	float Spoiler::GetHeadHeight() const
@@ -174,22 +179,15 @@ namespace o2
 		mExpandState = AddState("expand", AnimationClip::Parametric("mExpandCoef", 0.0f, 1.0f, 0.4f, 0.0f, 0.4f, 1.0f, 1.0f));
 	}
 
-	float Spoiler::GetMinHeightWithChildren() const
+	void Spoiler::MeasureWithChildren(Vec2F& minSize, Vec2F& weight) const
 	{
-		if (!mFitByChildren)
-			return Widget::GetMinHeightWithChildren();
+		VerticalLayout::MeasureWithChildren(minSize, weight);
 
-		float res = Math::Max(mChildWidgets.Count() - 1, 0)*mSpacing + mBorder.top + mBorder.bottom;
-		for (auto child : mChildWidgets)
-		{
-			if (child->mResEnabledInHierarchy)
-				res += child->GetMinHeightWithChildren();
-		}
-
-		res = res*Math::Clamp01(mExpandCoef) + mHeadHeight;
-		res = Math::Max(res, GetLayoutData().minSize.y);
+		if (!mFitByChildren)
+			return;
 
-		return res;
+		float height = GetChildrenMinHeight()*Math::Clamp01(mExpandCoef) + mHeadHeight;
+		minSize.y = Math::Max(height, GetLayoutData().minSize.y);
 	}
 
 	void Spoiler::UpdateLayoutParametres()
@@ -198,8 +196,13 @@ namespace o2
 			VerticalLayout::UpdateLayoutParametres();
 		else
 		{
-			GetLayoutData().weight.y = 1;
-			GetLayoutData().minSize.y = 0;
+			auto& layoutData = GetLayoutData();
+			if (!Math::Equals(layoutData.weight.y, 1.0f) || !Math::Equals(layoutData.minSize.y, 0.0f))
+			{
+				layoutData.weight.y = 1;
+				layoutData.minSize.y = 0;
+				InvalidateMeasure();
+			}
 		}
 	}
 
@@ -79,8 +79,8 @@ namespace o2
 		// Invokes required function for childs arranging
 		void RearrangeChilds() override;
 
-		// Returns layout height
-		float GetMinHeightWithChildren() const override;
+		// Measures minimal size and weight with children. Height of children is scaled by expanding coefficient
+		void MeasureWithChildren(Vec2F& minSize, Vec2F& weight) const override;
 
 		// Updates expanding
 		void UpdateExpanding(float dt);
@@ -135,7 +135,7 @@ CLASS_METHODS_META(o2::Spoiler)
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
 	PROTECTED_FUNCTION(void, RearrangeChilds);
-	PROTECTED_FUNCTION(float, GetMinHeightWithChildren);
+	PROTECTED_FUNCTION(void, MeasureWithChildren, Vec2F&, Vec2F&);
 	PROTECTED_FUNCTION(void, UpdateExpanding, float);
 	PROTECTED_FUNCTION(void, CreateExpandAnimation);
 	PROTECTED_FUNCTION(void, UpdateLayoutParametres);
@@ -75,6 +75,8 @@ namespace o2
 	{
 		if (mCaptionText)
 			mCaptionText->SetText(text);
+
+		InvalidateCache();
 	}
 
 	WString Toggle::GetCaption() const
@@ -82,6 +82,11 @@ namespace o2
 		return Widget::IsUnderPoint(point);
 	}
 
+	RectF TreeNode::GetCursorAreaBounds() const
+	{
+		return layout->GetWorldAxisAlignedRect();
+	}
+
 	String TreeNode::GetCreateMenuGroup()
 	{
 		return "Tree";
@@ -235,7 +240,7 @@ namespace o2
 		if (mExpandingNodeState == ExpandState::None)
 		{
 			for (auto child : mDrawingChildren)
-				child->Draw();
+				child->DrawWithCache();
 		}
 		else
 		{
@@ -296,6 +301,8 @@ namespace o2
 		if (mIsNeedUpdateView || o2Input.IsKeyPressed('B'))
 			UpdateNodesStructure();
 
+		mFrameStructureChanges = 0;
+
 		if (mIsNeedUdateLayout)
 			SetLayoutDirty();
 
@@ -327,7 +334,7 @@ namespace o2
 		if (mHighlightAnim.IsPlaying())
 		{
 			if (mHighlightObject && !mHighlighNode)
-				mHighlighNode = mAllNodes.FindOrDefault([=](Node* x) { return x->object == mHighlightObject; });
+				mHighlighNode = FindNode(mHighlightObject);
 
 			if (mHighlighNode && mHighlighNode->widget)
 			{
@@ -441,7 +448,7 @@ namespace o2
 
 			uiNode->mIsSelected = true;
 
-			Node* node = mAllNodes.FindOrDefault([=](Node* x) { return x->widget == uiNode; });
+			Node* node = uiNode->mNodeDef;
 			node->SetSelected(true);
 			mSelectedNodes.Add(node);
 			mSelectedObjects.Add(node->object);
@@ -515,7 +522,7 @@ namespace o2
 		float nodeHeight = mNodeWidgetSample->layout->GetMinHeight();
 		for (auto node : mAllNodes)
 		{
-			if (mSelectedNodes.Contains(node))
+			if (node->isSelected)
 			{
 				idx++;
 				continue;
@@ -573,7 +580,7 @@ namespace o2
 		if (immediately)
 		{
 			UpdateNodesStructure();
-			for (int i = 0; i < mAllNodes.Count(); i++)
+			for (int i = mMinVisibleNodeIdx; i <= mMaxVisibleNodeIdx && i < mAllNodes.Count(); i++)
 			{
 				if (mAllNodes[i]->widget)
 					UpdateNodeView(mAllNodes[i], mAllNodes[i]->widget, i);
@@ -584,7 +591,7 @@ namespace o2
 
 	TreeNode* Tree::GetNode(void* object)
 	{
-		Node* fnd = mAllNodes.FindOrDefault([=](Node* x) { return x->object == object; });
+		Node* fnd = FindNode(object);
 		if (fnd)
 			return fnd->widget;
 
@@ -637,7 +644,7 @@ namespace o2
 
 		for (auto obj : objects)
 		{
-			auto node = mAllNodes.FindOrDefault([=](Node* x) { return x->object == obj; });
+			auto node = FindNode(obj);
 
 			if (!node)
 				continue;
@@ -663,7 +670,7 @@ namespace o2
 			return;
 		}
 
-		auto node = mAllNodes.FindOrDefault([=](Node* x) { return x->object == object; });
+		auto node = FindNode(object);
 		if (!node)
 			return;
 
@@ -718,7 +725,8 @@ namespace o2
 
 		ExpandParentObjects(object);
 
-		int idx = mAllNodes.IndexOf([=](Node* x) { return x->object == object; });
+		Node* node = FindNode(object);
+		int idx = node ? IndexOfNode(node) : -1;
 
 		if (idx >= 0)
 			SetScroll(Vec2F(mScrollPos.x, (float)idx*mNodeWidgetSample->layout->minHeight - layout->height*0.5f));
@@ -734,7 +742,8 @@ namespace o2
 
 		ExpandParentObjects(object);
 
-		int idx = mAllNodes.IndexOf([=](Node* x) { return x->object == object; });
+		Node* node = FindNode(object);
+		int idx = node ? IndexOfNode(node) : -1;
 
 		if (idx >= 0)
 		{
@@ -742,7 +751,7 @@ namespace o2
 			float scroll = position - layout->height*0.5f;
 			SetScroll(Vec2F(mScrollPos.x, scroll));
 
-			mHighlighNode = mAllNodes[idx];
+			mHighlighNode = node;
 			mHighlightObject = object;
 			mHighlightAnim.RewindAndPlay();
 		}
@@ -760,7 +769,7 @@ namespace o2
 
 		for (int i = parentsStack.Count() - 1; i >= 0; i--)
 		{
-			auto node = mAllNodes.FindOrDefault([&](Node* x) { return x->object == parentsStack[i]; });
+			auto node = FindNode(parentsStack[i]);
 
 			if (!node)
 			{
@@ -783,12 +792,15 @@ namespace o2
 
 	void Tree::OnObjectCreated(void* object, void* parent)
 	{
-		mIsNeedUpdateView = true;
+		// Each in place change shifts all nodes after it, mass changes are cheaper to apply by one rebuild
+		if (++mFrameStructureChanges > mMaxInPlaceStructureChanges || !InsertObjectNode(object, parent))
+			mIsNeedUpdateView = true;
 	}
 
 	void Tree::OnObjectRemoved(void* object)
 	{
-		mIsNeedUpdateView = true;
+		if (++mFrameStructureChanges > mMaxInPlaceStructureChanges || !RemoveObjectNode(object))
+			mIsNeedUpdateView = true;
 	}
 
 	void Tree::OnObjectsChanged(const Vector<void*>& objects)
@@ -798,12 +810,12 @@ namespace o2
 
 		for (auto object : objects)
 		{
-			int idx = mAllNodes.IndexOf([=](Node* x) { return x->object == object; });
+			Node* node = FindNode(object);
 
-			if (idx < 0 || !mAllNodes[idx]->widget)
+			if (!node || !node->widget)
 				continue;
 
-			UpdateNodeView(mAllNodes[idx], mAllNodes[idx]->widget, idx);
+			UpdateNodeView(node, node->widget, IndexOfNode(node));
 		}
 	}
 
@@ -832,7 +844,7 @@ namespace o2
 			VisibleWidgetDef cache;
 			cache.object = node->object;
 			cache.widget = node->widget;
-			cache.position = mAllNodes.IndexOf(node);
+			cache.position = IndexOfNode(node);
 
 			mVisibleWidgetsCache.Add(cache);
 		}
@@ -840,6 +852,8 @@ namespace o2
 		mNodesBuf.Add(mAllNodes);
 
 		mAllNodes.Clear();
+		mObjectsNodes.Clear();
+		mIsNodesIndexesDirty = true;
 		mVisibleNodes.Clear();
 		mChildren.Clear();
 		mChildWidgets.Clear();
@@ -848,15 +862,14 @@ namespace o2
 		mMinVisibleNodeIdx = 0;
 		mMaxVisibleNodeIdx = -1;
 
-		int position = 0;
 		for (auto object : rootObjects)
 		{
 			if (mIsDraggingNodes && mSelectedObjects.Contains(object))
 				continue;
 
 			Node* node = CreateNode(object, nullptr);
-			mAllNodes.Insert(node, position++);
-			position += InsertNodes(node, position);
+			mAllNodes.Add(node);
+			CreateChildNodes(node, mAllNodes);
 		}
 
 		SetLayoutDirty();
@@ -864,36 +877,42 @@ namespace o2
 
 	int Tree::InsertNodes(Node* parentNode, int position, Vector<Node*>* newNodes /*= nullptr*/)
 	{
-		int initialPosition = position;
+		Vector<Node*> nodes;
+		CreateChildNodes(parentNode, nodes);
 
-		if (mExpandedObjects.Contains(parentNode->object))
-		{
-			auto childObjects = GetObjectChilds(parentNode->object);
-			for (auto child : childObjects)
-			{
-				if (mIsDraggingNodes && mSelectedObjects.Contains(child))
-					continue;
+		mAllNodes.Insert(nodes, position);
+		mIsNodesIndexesDirty = true;
+
+		if (newNodes)
+			newNodes->Add(nodes);
 
-				Node* node = CreateNode(child, parentNode);
+		return nodes.Count();
+	}
 
-				mAllNodes.Insert(node, position++);
+	void Tree::CreateChildNodes(Node* parentNode, Vector<Node*>& nodes)
+	{
+		if (!mExpandedObjects.Contains(parentNode->object))
+			return;
 
-				if (newNodes)
-					newNodes->Add(node);
+		auto childObjects = GetObjectChilds(parentNode->object);
+		for (auto child : childObjects)
+		{
+			if (mIsDraggingNodes && mSelectedObjects.Contains(child))
+				continue;
 
-				position += InsertNodes(node, position, newNodes);
-			}
+			Node* node = CreateNode(child, parentNode);
+			nodes.Add(node);
+			CreateChildNodes(node, nodes);
 		}
-
-		return position - initialPosition;
 	}
 
 	void Tree::RemoveNodes(Node* parentNode)
 	{
-		int begin = mAllNodes.IndexOf(parentNode) + 1;
+		int begin = IndexOfNode(parentNode) + 1;
 		int end = begin - 1 + parentNode->GetChildCount();
 
 		mAllNodes.RemoveRange(begin, end);
+		mIsNodesIndexesDirty = true;
 	}
 
 	Tree::Node* Tree::CreateNode(void* object, Node* parent)
@@ -916,9 +935,204 @@ namespace o2
 		if (node->isSelected)
 			mSelectedNodes.Add(node);
 
+		mObjectsNodes[object] = node;
+
 		return node;
 	}
 
+	Tree::Node* Tree::FindNode(void* object) const
+	{
+		Node* node = nullptr;
+		mObjectsNodes.TryGetValue(object, node);
+		return node;
+	}
+
+	int Tree::IndexOfNode(Node* node)
+	{
+		if (mIsNodesIndexesDirty)
+		{
+			for (int i = 0; i < mAllNodes.Count(); i++)
+				mAllNodes[i]->index = i;
+
+			mIsNodesIndexesDirty = false;
+		}
+
+		return node->index;
+	}
+
+	bool Tree::InsertObjectNode(void* object, void* parent)
+	{
+		// Structure changes in the middle of rebuilding, expanding or dragging are applied by rebuilding whole tree
+		if (mIsNeedUpdateView || mIsDraggingNodes || mExpandingNodeState != ExpandState::None ||
+			!mVisibleWidgetsCache.IsEmpty() || FindNode(object))
+		{
+			return false;
+		}
+
+		Node* parentNode = nullptr;
+		if (parent)
+		{
+			parentNode = FindNode(parent);
+
+			// Parent isn't visible in tree, created object too
+			if (!parentNode)
+				return true;
+
+			if (!parentNode->isExpanded)
+			{
+				if (parentNode->widget)
+					UpdateNodeView(parentNode, parentNode->widget, IndexOfNode(parentNode));
+
+				return true;
+			}
+		}
+
+		auto siblings = GetObjectChilds(parent);
+		int siblingIdx = siblings.IndexOf(object);
+		if (siblingIdx < 0)
+			return false;
+
+		// Node is inserted before next sibling node, or after parent's last child node
+		Node* nextSibling = nullptr;
+		for (int i = siblingIdx + 1; i < siblings.Count() && !nextSibling; i++)
+			nextSibling = FindNode(siblings[i]);
+
+		int position;
+		if (nextSibling)
+			position = IndexOfNode(nextSibling);
+		else if (parentNode)
+			position = IndexOfNode(parentNode) + 1 + parentNode->GetChildCount();
+		else
+			position = mAllNodes.Count();
+
+		Vector<Node*> nodes;
+		Node* node = CreateNode(object, parentNode);
+		nodes.Add(node);
+		CreateChildNodes(node, nodes);
+
+		if (parentNode && nextSibling)
+		{
+			parentNode->childs.Remove(node);
+			parentNode->childs.Insert(node, parentNode->childs.IndexOf(nextSibling));
+		}
+
+		mAllNodes.Insert(nodes, position);
+		mIsNodesIndexesDirty = true;
+
+		OnNodesRangeChanged(position, nodes.Count(), 0);
+
+		if (parentNode && parentNode->widget && parentNode->childs.Count() == 1)
+			UpdateNodeView(parentNode, parentNode->widget, IndexOfNode(parentNode));
+
+		return true;
+	}
+
+	bool Tree::RemoveObjectNode(void* object)
+	{
+		if (mIsNeedUpdateView || mIsDraggingNodes || mExpandingNodeState != ExpandState::None ||
+			!mVisibleWidgetsCache.IsEmpty())
+		{
+			return false;
+		}
+
+		Node* node = FindNode(object);
+		if (!node)
+			return true;
+
+		int position = IndexOfNode(node);
+		int count = 1 + node->GetChildCount();
+
+		for (int i = position; i < position + count; i++)
+		{
+			Node* removingNode = mAllNodes[i];
+
+			FreeNodeWidget(removingNode);
+
+			if (removingNode->isSelected)
+				mSelectedNodes.Remove(removingNode);
+
+			if (removingNode == mHighlighNode)
+				mHighlighNode = nullptr;
+
+			mObjectsNodes.Remove(removingNode->object);
+			mNodesBuf.Add(removingNode);
+		}
+
+		mAllNodes.RemoveRange(position, position + count);
+		mIsNodesIndexesDirty = true;
+
+		OnNodesRangeChanged(position, 0, count);
+
+		if (Node* parentNode = node->parent)
+		{
+			parentNode->childs.Remove(node);
+
+			if (parentNode->childs.IsEmpty() && parentNode->widget && parentNode->widget->mExpandBtn)
+				parentNode->widget->mExpandBtn->Hide(true);
+		}
+
+		return true;
+	}
+
+	void Tree::OnNodesRangeChanged(int position, int insertedCount, int removedCount)
+	{
+		if (removedCount > 0)
+		{
+			int removedBeforeMin = Math::Clamp(mMinVisibleNodeIdx - position, 0, removedCount);
+			int removedBeforeMax = Math::Clamp(mMaxVisibleNodeIdx + 1 - position, 0, removedCount);
+
+			mMinVisibleNodeIdx -= removedBeforeMin;
+			mMaxVisibleNodeIdx -= removedBeforeMax;
+		}
+
+		if (insertedCount > 0)
+		{
+			if (position < mMinVisibleNodeIdx)
+				mMinVisibleNodeIdx += insertedCount;
+
+			if (position <= mMaxVisibleNodeIdx)
+				mMaxVisibleNodeIdx += insertedCount;
+		}
+
+		mMaxVisibleNodeIdx = Math::Min(mMaxVisibleNodeIdx, mAllNodes.Count() - 1);
+		mMinVisibleNodeIdx = Math::Min(mMinVisibleNodeIdx, Math::Max(0, mMaxVisibleNodeIdx));
+
+		// Only visible widgets are moved, other nodes have no widgets
+		for (int i = Math::Max(position, mMinVisibleNodeIdx); i <= mMaxVisibleNodeIdx; i++)
+		{
+			Node* node = mAllNodes[i];
+			if (node->widget)
+			{
+				UpdateNodeWidgetLayout(node, i);
+				node->widget->SetLayoutDirty();
+			}
+		}
+
+		// Inserted nodes get widgets on next visible nodes update
+		mVisibleNodes = mAllNodes.Take(mMinVisibleNodeIdx, mMaxVisibleNodeIdx + 1).FindAll([](Node* x) { return x->widget != nullptr; });
+
+		mIsNeedUpdateVisibleNodes = true;
+		SetLayoutDirty();
+	}
+
+	void Tree::FreeNodeWidget(Node* node)
+	{
+		if (!node->widget)
+			return;
+
+		FreeNodeData(node->widget, node->object);
+
+		mNodeWidgetsBuf.Add(node->widget);
+		mChildren.Remove(node->widget);
+		mChildWidgets.Remove(node->widget);
+		mDrawingChildren.Remove(node->widget);
+
+		node->widget->mParent = nullptr;
+		node->widget->mParentWidget = nullptr;
+		node->widget->mNodeDef = nullptr;
+		node->widget = nullptr;
+	}
+
 	void Tree::CopyData(const Actor& otherActor)
 	{
 		const Tree& other = dynamic_cast<const Tree&>(otherActor);
@@ -1021,22 +1235,7 @@ namespace o2
 				if (i >= mAllNodes.Count())
 					break;
 
-				Node* node = mAllNodes[i];
-
-				if (node->widget)
-				{
-					FreeNodeData(node->widget, node->object);
-
-					mNodeWidgetsBuf.Add(node->widget);
-					mChildren.Remove(node->widget);
-					mChildWidgets.Remove(node->widget);
-					mDrawingChildren.Remove(node->widget);
-
-					node->widget->mParent = nullptr;
-					node->widget->mParentWidget = nullptr;
-					node->widget->mNodeDef = nullptr;
-					node->widget = nullptr;
-				}
+				FreeNodeWidget(mAllNodes[i]);
 			}
 		}
 
@@ -1176,7 +1375,7 @@ namespace o2
 
 	void Tree::ExpandNode(Node* node)
 	{
-		int position = mAllNodes.IndexOf(node) + 1;
+		int position = IndexOfNode(node) + 1;
 
 		if (mExpandingNodeState != ExpandState::None && mExpandingNodeIdx != position - 1)
 			UpdateNodeExpanding(mExpandNodeTime);
@@ -1239,7 +1438,7 @@ namespace o2
 
 	void Tree::CollapseNode(Node* node)
 	{
-		int idx = mAllNodes.IndexOf(node);
+		int idx = IndexOfNode(node);
 
 		if (mExpandingNodeState != ExpandState::None && mExpandingNodeIdx != idx)
 			UpdateNodeExpanding(mExpandNodeTime);
@@ -1260,7 +1459,7 @@ namespace o2
 
 	void Tree::StartExpandingAnimation(ExpandState direction, Node* node, int childrenCount)
 	{
-		int idx = mAllNodes.IndexOf(node);
+		int idx = IndexOfNode(node);
 
 		float nodeHeight = mNodeWidgetSample->layout->GetMinHeight();
 
@@ -1304,21 +1503,9 @@ namespace o2
 				for (int i = mExpandingNodeIdx + 1; i <= mExpandingNodeIdx + mExpandingNodeChildsCount && i < mAllNodes.Count(); i++)
 				{
 					Node* node = mAllNodes[i];
-					if (node->widget)
-					{
-						FreeNodeData(node->widget, node->object);
-
-						mNodeWidgetsBuf.Add(node->widget);
-						mChildren.Remove(node->widget);
-						mChildWidgets.Remove(node->widget);
-						mDrawingChildren.Remove(node->widget);
-
-						node->widget->mParent = nullptr;
-						node->widget->mParentWidget = nullptr;
-						node->widget->mNodeDef = nullptr;
-						node->widget = nullptr;
-					}
+					FreeNodeWidget(node);
 
+					mObjectsNodes.Remove(node->object);
 					mNodesBuf.Add(node);
 
 					if (node->isSelected)
@@ -1326,6 +1513,7 @@ namespace o2
 				}
 
 				mAllNodes.RemoveRange(mExpandingNodeIdx + 1, mExpandingNodeIdx + mExpandingNodeChildsCount + 1);
+				mIsNodesIndexesDirty = true;
 				mExpandingNodeChildsCount = 0;
 			}
 		}
@@ -1609,7 +1797,7 @@ namespace o2
 
 			if (node->widget && changed)
 			{
-				UpdateNodeWidgetLayout(node, mAllNodes.IndexOf(node));
+				UpdateNodeWidgetLayout(node, IndexOfNode(node));
 				node->widget->SetLayoutDirty();
 			}
 		}
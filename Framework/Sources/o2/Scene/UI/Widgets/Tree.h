@@ -4,6 +4,7 @@
 #include "o2/Scene/UI/Widgets/VerticalLayout.h"
 #include "o2/Utils/Editor/DragAndDrop.h"
 #include "o2/Utils/Math/Curve.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
 
 namespace o2
 {
@@ -11,9 +12,11 @@ namespace o2
 	class Button;
 	class TreeNode;
 
-	// -------
-	// UI Tree
-	// -------
+	// -------------------------------------------------------------------------------------------------------------
+	// UI Tree. Keeps flat list of expanded nodes and creates widgets only for visible of them. Nodes are indexed by
+	// objects, so selection and scrolling to object don't search through all nodes. Created and removed objects and
+	// expanded or collapsed nodes update only their ranges in nodes list
+	// -------------------------------------------------------------------------------------------------------------
 	class Tree: public ScrollArea, public DragDropArea, public ISelectableDragableObjectsGroup
 	{
 	public:
@@ -51,10 +54,10 @@ namespace o2
 		// Copy-operator
 		Tree& operator=(const Tree& other);
 
-		// Creates tree node for object
+		// Creates tree node for object. Few changes in frame are applied in place, more changes rebuild tree once
 		void OnObjectCreated(void* object, void* parent);
 
-		// Removes tree node for object
+		// Removes tree node for object. Few changes in frame are applied in place, more changes rebuild tree once
 		void OnObjectRemoved(void* object);
 
 		// Updates tree for changed objects
@@ -197,6 +200,7 @@ namespace o2
 			void*      object;             // Pointer to object
 			TreeNode*  widget = nullptr;   // Node widget
 			int        level = 0;          // Hierarchy depth level
+			int        index = 0;          // Index in all nodes list, valid when nodes indexes aren't dirty
 			bool       isSelected = false; // Is node selected
 			bool       isExpanded = false; // Is node expanded
 
@@ -243,7 +247,12 @@ namespace o2
 		bool mIsNeedUdateLayout = false;        // Is layout needs to rebuild
 		bool mIsNeedUpdateVisibleNodes = false; // In need to update visible nodes
 
-		Vector<Node*> mAllNodes; // All expanded nodes definitions
+		Vector<Node*>         mAllNodes;                  // All expanded nodes definitions
+		HashMap<void*, Node*> mObjectsNodes;              // All expanded nodes definitions by objects
+		bool                  mIsNodesIndexesDirty = true; // Is nodes indexes need to be updated after changing nodes list
+
+		int mFrameStructureChanges = 0;      // Count of objects created and removed in current frame
+		int mMaxInPlaceStructureChanges = 4; // Max count of changes in frame applied in place, each costs nodes list shift
 
 		Vector<void*> mSelectedObjects; // Selected objects
 		Vector<Node*> mSelectedNodes;   // Selected nodes definitions
@@ -389,12 +398,33 @@ namespace o2
 		// Inserts node to hierarchy
 		int InsertNodes(Node* parentNode, int position, Vector<Node*>* newNodes = nullptr);
 
+		// Creates nodes for children of expanded node recursively and adds them into nodes in hierarchy order
+		void CreateChildNodes(Node* parentNode, Vector<Node*>& nodes);
+
 		// Removes node from hierarchy
 		void RemoveNodes(Node* parentNode);
 
 		// Creates node from object with parent
 		Node* CreateNode(void* object, Node* parent);
 
+		// Returns node by object or null when object isn't in expanded nodes
+		Node* FindNode(void* object) const;
+
+		// Returns node index in all nodes list. Updates nodes indexes when they are dirty
+		int IndexOfNode(Node* node);
+
+		// Inserts node of created object and its children into nodes list. Returns false when tree must be rebuilt
+		bool InsertObjectNode(void* object, void* parent);
+
+		// Removes node of removed object and its children from nodes list. Returns false when tree must be rebuilt
+		bool RemoveObjectNode(void* object);
+
+		// Shifts visible nodes range and updates visible widgets layouts after inserting or removing nodes range
+		void OnNodesRangeChanged(int position, int insertedCount, int removedCount);
+
+		// Frees node widget and returns it to widgets buffer
+		void FreeNodeWidget(Node* node);
+
 		// Updates visible nodes (calculates range and initializes nodes)
 		virtual void UpdateVisibleNodes();
 
@@ -531,6 +561,9 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns world rectangle of node
+		RectF GetCursorAreaBounds() const override;
+
 		// Returns create menu group in editor
 		static String GetCreateMenuGroup();
 
@@ -606,6 +639,10 @@ CLASS_FIELDS_META(o2::Tree)
 	PROTECTED_FIELD(mIsNeedUdateLayout).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mIsNeedUpdateVisibleNodes).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mAllNodes);
+	PROTECTED_FIELD(mObjectsNodes);
+	PROTECTED_FIELD(mIsNodesIndexesDirty).DEFAULT_VALUE(true);
+	PROTECTED_FIELD(mFrameStructureChanges).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mMaxInPlaceStructureChanges).DEFAULT_VALUE(4);
 	PROTECTED_FIELD(mSelectedObjects);
 	PROTECTED_FIELD(mSelectedNodes);
 	PROTECTED_FIELD(mNodeWidgetsBuf);
@@ -725,8 +762,15 @@ CLASS_METHODS_META(o2::Tree)
 	PROTECTED_FUNCTION(void, UpdatePressedNodeExpand, float);
 	PROTECTED_FUNCTION(void, UpdateNodesStructure);
 	PROTECTED_FUNCTION(int, InsertNodes, Node*, int, Vector<Node*>*);
+	PROTECTED_FUNCTION(void, CreateChildNodes, Node*, Vector<Node*>&);
 	PROTECTED_FUNCTION(void, RemoveNodes, Node*);
 	PROTECTED_FUNCTION(Node*, CreateNode, void*, Node*);
+	PROTECTED_FUNCTION(Node*, FindNode, void*);
+	PROTECTED_FUNCTION(int, IndexOfNode, Node*);
+	PROTECTED_FUNCTION(bool, InsertObjectNode, void*, void*);
+	PROTECTED_FUNCTION(bool, RemoveObjectNode, void*);
+	PROTECTED_FUNCTION(void, OnNodesRangeChanged, int, int, int);
+	PROTECTED_FUNCTION(void, FreeNodeWidget, Node*);
 	PROTECTED_FUNCTION(void, UpdateVisibleNodes);
 	PROTECTED_FUNCTION(void, CreateVisibleNodeWidget, Node*, int);
 	PROTECTED_FUNCTION(void, UpdateNodeView, Node*, TreeNode*, int);
@@ -783,6 +827,7 @@ CLASS_METHODS_META(o2::TreeNode)
 	PUBLIC_FUNCTION(void, Collapse, bool);
 	PUBLIC_FUNCTION(void*, GetObject);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
 	PROTECTED_FUNCTION(void, UpdateTreeLayout, float);
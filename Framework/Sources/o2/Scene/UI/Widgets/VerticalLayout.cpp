@@ -184,47 +184,38 @@ namespace o2
 		SetLayoutDirty();
 	}
 
-	float VerticalLayout::GetMinWidthWithChildren() const
+	void VerticalLayout::MeasureWithChildren(Vec2F& minSize, Vec2F& weight) const
 	{
-		if (!mFitByChildren)
-			return Widget::GetMinWidthWithChildren();
+		Widget::MeasureWithChildren(minSize, weight);
 
-		float res = 0;
+		weight.y = 0;
 		for (auto child : mChildWidgets)
 		{
 			if (child->mResEnabledInHierarchy)
-				res = Math::Max(res, child->GetMinWidthWithChildren() + mBorder.left + mBorder.right);
+				weight.y += child->GetHeightWeightWithChildren();
 		}
 
-		res = Math::Max(res, GetLayoutData().minSize.x);
-
-		return res;
-	}
-
-	float VerticalLayout::GetMinHeightWithChildren() const
-	{
 		if (!mFitByChildren)
-			return Widget::GetMinHeightWithChildren();
+			return;
 
-		float res = mBorder.top + mBorder.bottom + Math::Max(mChildWidgets.Count() - 1, 0)*mSpacing;
+		float width = 0;
 		for (auto child : mChildWidgets)
 		{
 			if (child->mResEnabledInHierarchy)
-				res += child->GetMinHeightWithChildren();
+				width = Math::Max(width, child->GetMinWidthWithChildren() + mBorder.left + mBorder.right);
 		}
 
-		res = Math::Max(res, GetLayoutData().minSize.y);
-
-		return res;
+		minSize.x = Math::Max(width, minSize.x);
+		minSize.y = Math::Max(GetChildrenMinHeight(), minSize.y);
 	}
 
-	float VerticalLayout::GetHeightWeightWithChildren() const
+	float VerticalLayout::GetChildrenMinHeight() const
 	{
-		float res = 0;
+		float res = mBorder.top + mBorder.bottom + Math::Max(mChildWidgets.Count() - 1, 0)*mSpacing;
 		for (auto child : mChildWidgets)
 		{
 			if (child->mResEnabledInHierarchy)
-				res += child->GetHeightWeightWithChildren();
+				res += child->GetMinHeightWithChildren();
 		}
 
 		return res;
@@ -119,14 +119,12 @@ namespace o2
 		// Copies data of actor from other to this
 		void CopyData(const Actor& otherActor) override;
 
-		// Returns layout width with children
-		float GetMinWidthWithChildren() const override;
+		// Measures minimal size and weight with children: height weight is sum of children weights, when fitting by
+		// children minimal size contains children
+		void MeasureWithChildren(Vec2F& minSize, Vec2F& weight) const override;
 
-		// Returns layout height
-		float GetMinHeightWithChildren() const override;
-
-		// Returns layout height weight with children
-		float GetHeightWeightWithChildren() const override;
+		// Returns summary minimal height of children with spacing and borders
+		float GetChildrenMinHeight() const;
 
 		// It is called when child widget was added
 		void OnChildAdded(Widget* child) override;
@@ -208,9 +206,8 @@ CLASS_METHODS_META(o2::VerticalLayout)
 	PUBLIC_FUNCTION(void, UpdateSelfTransform);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
-	PROTECTED_FUNCTION(float, GetMinWidthWithChildren);
-	PROTECTED_FUNCTION(float, GetMinHeightWithChildren);
-	PROTECTED_FUNCTION(float, GetHeightWeightWithChildren);
+	PROTECTED_FUNCTION(void, MeasureWithChildren, Vec2F&, Vec2F&);
+	PROTECTED_FUNCTION(float, GetChildrenMinHeight);
 	PROTECTED_FUNCTION(void, OnChildAdded, Widget*);
 	PROTECTED_FUNCTION(void, OnChildRemoved, Widget*);
 	PROTECTED_FUNCTION(void, RearrangeChilds);
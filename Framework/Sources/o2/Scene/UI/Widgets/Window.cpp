@@ -48,7 +48,7 @@ namespace o2
 	{
 		if (!mResEnabledInHierarchy || mIsClipped) {
 			for (auto child : mDrawingChildren)
-				child->Draw();
+				child->DrawWithCache();
 
 			return;
 		}
@@ -63,7 +63,7 @@ namespace o2
 		o2Render.EnableScissorTest(mAbsoluteClipArea);
 
 		for (auto child : mDrawingChildren)
-			child->Draw();
+			child->DrawWithCache();
 
 		o2Render.DisableScissorTest();
 
@@ -80,7 +80,7 @@ namespace o2
 		mRightBottomDragHandle.OnDrawn();
 
 		for (auto child : mInternalWidgets)
-			child->Draw();
+			child->DrawWithCache();
 
 		for (auto layer : mTopDrawingLayers)
 			layer->Draw();
@@ -139,6 +139,8 @@ namespace o2
 			if (auto textDrawable = dynamic_cast<Text*>(captionLayer->GetDrawable()))
 				textDrawable->SetText(caption);
 		}
+
+		InvalidateCache();
 	}
 
 	WString Window::GetCaption() const
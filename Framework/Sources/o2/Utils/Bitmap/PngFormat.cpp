@@ -8,18 +8,30 @@
 #endif
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/FileSystem/File.h"
+#include "o2/Utils/FileSystem/MappedFile.h"
 #include "o2/Utils/Bitmap/Bitmap.h"
 
 namespace o2
 {
+	// Png data reading position in mapped file
+	struct PngMemoryReader
+	{
+		const png_byte* data = nullptr;
+		png_size_t      size = 0;
+		png_size_t      position = 0;
+	};
+
 	void CustomPngReadFn(png_structp png_ptr, png_bytep outBytes, png_size_t byteCountToRead)
 	{
 		void* io_ptr = png_get_io_ptr(png_ptr);
 		if (io_ptr == NULL) return;
 
-		InFile* file = (InFile*)io_ptr;
+		PngMemoryReader* reader = (PngMemoryReader*)io_ptr;
+		if (byteCountToRead > reader->size - reader->position)
+			png_error(png_ptr, "Unexpected end of file");
 
-		file->ReadData(outBytes, byteCountToRead);
+		memcpy(outBytes, reader->data + reader->position, byteCountToRead);
+		reader->position += byteCountToRead;
 	}
 
 	void CustomPngWriteFn(png_structp png_ptr, png_bytep bytes, png_size_t byteCountToWrite)
@@ -36,7 +48,7 @@ namespace o2
 
 	bool LoadPngImage(const String& fileName, Bitmap* image, bool errors /*= true*/)
 	{
-		InFile pngImageFile(fileName);
+		MappedFile pngImageFile(fileName);
 		if (!pngImageFile.IsOpened())
 		{
 			if (errors) 
@@ -45,14 +57,12 @@ namespace o2
 			return false;
 		}
 
-		//header for testing if it is a png
-		png_byte header[8];
-
-		//read the header
-		pngImageFile.ReadData(header, 8);
+		PngMemoryReader reader;
+		reader.data = (const png_byte*)pngImageFile.GetData();
+		reader.size = (png_size_t)pngImageFile.GetDataSize();
 
-		//test if png
-		int is_png = !png_sig_cmp(header, 0, 8);
+		//test if png, header is checked right in mapped data
+		int is_png = reader.size >= 8 && !png_sig_cmp(reader.data, 0, 8);
 		if (!is_png)
 		{
 			if (errors) 
@@ -102,7 +112,8 @@ namespace o2
 		}
 
 		//init png reading
-		png_set_read_fn(png_ptr, &pngImageFile, CustomPngReadFn);
+		reader.position = 8;
+		png_set_read_fn(png_ptr, &reader, CustomPngReadFn);
 
 		//png_init_io(png_ptr, fp);
 
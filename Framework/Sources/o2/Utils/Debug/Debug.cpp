@@ -17,6 +17,8 @@
 
 namespace o2
 {
+	LogLevel Debug::mLogLevel = LogLevel::Regular;
+
 	Debug::Debug()
 	{
 		FileLogStream* fileLogStream = mnew FileLogStream("", "log.txt");
@@ -45,6 +47,8 @@ namespace o2
 
 	void Debug::Draw()
 	{
+		o2Render.BeginAALinesBatch();
+
 		Vector<IDbgDrawable*> freeDrawables;
 		for (auto drw : mDbgDrawables)
 		{
@@ -54,57 +58,48 @@ namespace o2
 				freeDrawables.Add(drw);
 		}
 
-		freeDrawables.ForEach([&](auto drw) { mDbgDrawables.Remove(drw); delete drw; });
-	}
-
-	void Debug::Log(WString format, ...)
-	{
-		va_list vlist;
-		va_start(vlist, format);
-
-		mInstance->mLogStream->OutStr(String::Format(format, vlist));
+		o2Render.EndAALinesBatch();
 
-		va_end(vlist);
+		freeDrawables.ForEach([&](auto drw) { mDbgDrawables.Remove(drw); delete drw; });
 	}
 
 	void Debug::LogStr(const WString& out)
 	{
-		mInstance->mLogStream->OutStr(out);
-	}
-
-	void Debug::LogWarning(WString format, ...)
-	{
-		va_list vlist;
-		va_start(vlist, format);
-
-		mInstance->mLogStream->WarningStr(String::Format(format, vlist));
+		if (!IsLogLevelEnabled(LogLevel::Regular))
+			return;
 
-		va_end(vlist);
+		mInstance->mLogStream->OutStr(out);
 	}
 
 	void Debug::LogWarningStr(const WString& out)
 	{
+		if (!IsLogLevelEnabled(LogLevel::Warning))
+			return;
+
 		mInstance->mLogStream->WarningStr(out);
 	}
 
-	void Debug::LogError(WString format, ...)
+	void Debug::LogErrorStr(const WString& out)
 	{
-		va_list vlist;
-		va_start(vlist, format);
+		if (!IsLogLevelEnabled(LogLevel::Error))
+			return;
 
-		mInstance->mLogStream->ErrorStr(String::Format(format, vlist));
+		mInstance->mLogStream->ErrorStr(out);
+	}
 
-		va_end(vlist);
+	LogStream* Debug::GetLog()
+	{
+		return mInstance->mLogStream;
 	}
 
-	void Debug::LogErrorStr(const WString& out)
+	void Debug::SetLogLevel(LogLevel level)
 	{
-		mInstance->mLogStream->ErrorStr(out);
+		mLogLevel = level;
 	}
 
-	LogStream* Debug::GetLog()
+	LogLevel Debug::GetLogLevel()
 	{
-		return mInstance->mLogStream;
+		return mLogLevel;
 	}
 
 	void Debug::DrawRect(const RectF& rect, const Color4& color, float delay)
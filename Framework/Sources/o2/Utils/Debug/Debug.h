@@ -1,5 +1,6 @@
 #pragma once
 
+#include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/Singleton.h"
 #include "o2/Utils/Types/String.h"
 
@@ -20,20 +21,23 @@ namespace o2
 	class Debug: public Singleton<Debug>
 	{
 	public:
-		// Out message into main log with formatting
-		void Log(WString format, ...);
+		// Out message into main log with formatting. Message isn't formatted when regular messages are filtered
+		template<typename ... _args>
+		void Log(const WString& format, _args ... args);
 
 		// Out message string into main log
 		void LogStr(const WString& out);
 
-		// Out warning message into main log with formatting
-		void LogWarning(WString format, ...);
+		// Out warning message into main log with formatting. Message isn't formatted when warnings are filtered
+		template<typename ... _args>
+		void LogWarning(const WString& format, _args ... args);
 
 		// Out warning message string into main log
 		void LogWarningStr(const WString& out);
 
-		// Out error message into main log with formatting
-		void LogError(WString format, ...);
+		// Out error message into main log with formatting. Message isn't formatted when errors are filtered
+		template<typename ... _args>
+		void LogError(const WString& format, _args ... args);
 
 		// Out error message string into main log
 		void LogErrorStr(const WString& out);
@@ -41,6 +45,15 @@ namespace o2
 		// Returns pointer to main log
 		LogStream* GetLog();
 
+		// Sets minimal level of logged messages. Messages with lower level are skipped before formatting
+		static void SetLogLevel(LogLevel level);
+
+		// Returns minimal level of logged messages
+		static LogLevel GetLogLevel();
+
+		// Returns is messages with level are logged
+		static bool IsLogLevelEnabled(LogLevel level) { return level >= mLogLevel; }
+
 		// Draws debug line from begin to end with color and disappearing delay
 		void DrawLine(const Vec2F& begin, const Vec2F& end, const Color4& color, float delay);
 
@@ -207,6 +220,8 @@ namespace o2
 		};
 
 	protected:
+		static LogLevel mLogLevel; // Minimal level of logged messages
+
 		LogStream*            mLogStream;    // Main log stream
 		Vector<IDbgDrawable*> mDbgDrawables; // Debug lines array
 		VectorFont*           mFont;		 // Font for debug captions
@@ -229,4 +244,25 @@ namespace o2
 		friend class BaseApplication;
 		friend class Application;
 	};
+
+	template<typename ... _args>
+	void Debug::Log(const WString& format, _args ... args)
+	{
+		if (IsLogLevelEnabled(LogLevel::Regular))
+			LogStr(WString::Format(format, args ...));
+	}
+
+	template<typename ... _args>
+	void Debug::LogWarning(const WString& format, _args ... args)
+	{
+		if (IsLogLevelEnabled(LogLevel::Warning))
+			LogWarningStr(WString::Format(format, args ...));
+	}
+
+	template<typename ... _args>
+	void Debug::LogError(const WString& format, _args ... args)
+	{
+		if (IsLogLevelEnabled(LogLevel::Error))
+			LogErrorStr(WString::Format(format, args ...));
+	}
 }
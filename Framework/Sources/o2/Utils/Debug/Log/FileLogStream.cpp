@@ -1,37 +1,215 @@
 #include "o2/stdafx.h"
 #include "FileLogStream.h"
 
-#include <fstream>
+#include "o2/Utils/System/Time/Time.h"
 
 namespace o2
 {
 	FileLogStream::FileLogStream(const String& fileName):
-		LogStream(), filename(fileName)
+		LogStream(), mFilename(fileName), mFile(nullptr), mRecords(4096)
 	{
-		std::fstream ofs(filename, std::ios::out);
-		if (ofs) 
-			ofs.close();
+		Initialize();
 	}
 
 	FileLogStream::FileLogStream(const WString& id, const String& fileName):
-		LogStream(id), filename(fileName)
+		LogStream(id), mFilename(fileName), mFile(nullptr), mRecords(4096)
 	{
-		std::fstream ofs(filename, std::ios::out);
-		if (ofs)
-			ofs.close();
+		Initialize();
 	}
 
 	FileLogStream::~FileLogStream()
 	{
+		mStopWriter = true;
+		mWriterCondition.notify_one();
+
+		if (mWriterThread.joinable())
+			mWriterThread.join();
+
+		if (mFile)
+			fclose(mFile);
+	}
+
+	void FileLogStream::SetFlushSize(int bytes)
+	{
+		mFlushSize = bytes;
+	}
+
+	int FileLogStream::GetFlushSize() const
+	{
+		return mFlushSize;
+	}
+
+	void FileLogStream::SetFlushInterval(float seconds)
+	{
+		mFlushInterval = seconds;
+	}
+
+	float FileLogStream::GetFlushInterval() const
+	{
+		return mFlushInterval;
+	}
+
+	void FileLogStream::Flush()
+	{
+		UInt64 pushedCount = mPushedCount;
+
+		{
+			std::lock_guard<std::mutex> lock(mWriterMutex);
+			mFlushRequested = true;
+		}
+		mWriterCondition.notify_one();
+
+		while (mWrittenCount < pushedCount && mWriterThread.joinable())
+			std::this_thread::yield();
 	}
 
 	void FileLogStream::OutStrEx(const WString& str)
 	{
-		/*std::fstream ofs(mFilename, std::ios::app);
-		if (ofs)
+		PushRecord(LogLevel::Regular, str);
+	}
+
+	void FileLogStream::OutErrorEx(const WString& str)
+	{
+		PushRecord(LogLevel::Error, str);
+
+		if (IsStoppingOnLogErrors())
+		{
+			Flush();
+			Assert(false, (const char*)((String)str));
+		}
+	}
+
+	void FileLogStream::OutWarningEx(const WString& str)
+	{
+		PushRecord(LogLevel::Warning, str);
+	}
+
+	void FileLogStream::PushRecord(LogLevel level, const WString& str)
+	{
+		if (!mFile)
+			return;
+
+		Record record;
+		record.time = std::chrono::duration<double>(std::chrono::steady_clock::now() - mStartTime).count();
+		record.frame = Time::IsSingletonInitialzed() ? o2Time.GetCurrentFrame() : 0;
+		record.threadId = GetCurrentThreadIdx();
+		record.level = level;
+		record.message = str;
+
+		// Queue is full only when writer can't keep up; waiting for it instead of losing records
+		while (!mRecords.TryPush(std::move(record)))
 		{
-			ofs << ((String)str).Data() << std::endl;
-			ofs.close();
-		}*/
+			mFlushRequested = true;
+			mWriterCondition.notify_one();
+			std::this_thread::yield();
+		}
+
+		mPushedCount++;
+
+		if (mRecords.GetApproxCount() > mRecords.GetCapacity()/2)
+			mWriterCondition.notify_one();
+	}
+
+	void FileLogStream::Initialize()
+	{
+		mStopWriter = false;
+		mFlushRequested = false;
+		mPushedCount = 0;
+		mWrittenCount = 0;
+		mFlushSize = 64*1024;
+		mFlushInterval = 0.1f;
+		mStartTime = std::chrono::steady_clock::now();
+
+		mFile = fopen(mFilename.Data(), "wb");
+		if (!mFile)
+			return;
+
+		// Batches are written by one call, internal buffering is not required
+		setvbuf(mFile, nullptr, _IONBF, 0);
+
+		mWriterThread = std::thread(&FileLogStream::WriterThreadFunc, this);
+	}
+
+	void FileLogStream::WriterThreadFunc()
+	{
+		String batch;
+		batch.Reserve(mFlushSize);
+
+		auto lastWriteTime = std::chrono::steady_clock::now();
+		UInt64 batchRecordsCount = 0;
+
+		Record record;
+		while (true)
+		{
+			// Flag is taken before draining, so flush requested while draining is handled by next iteration
+			bool flushRequested;
+			{
+				std::lock_guard<std::mutex> lock(mWriterMutex);
+				flushRequested = mFlushRequested;
+				mFlushRequested = false;
+			}
+
+			while (mRecords.TryPop(record))
+			{
+				FormatRecord(record, batch);
+				batchRecordsCount++;
+
+				if (batch.Length() >= mFlushSize)
+				{
+					WriteBatch(batch);
+					mWrittenCount += batchRecordsCount;
+					batchRecordsCount = 0;
+					lastWriteTime = std::chrono::steady_clock::now();
+				}
+			}
+
+			auto flushInterval = std::chrono::duration<float>(mFlushInterval.load());
+			auto now = std::chrono::steady_clock::now();
+			bool stopping = mStopWriter;
+
+			if (batchRecordsCount > 0 && (flushRequested || stopping || now - lastWriteTime >= flushInterval))
+			{
+				WriteBatch(batch);
+				mWrittenCount += batchRecordsCount;
+				batchRecordsCount = 0;
+				lastWriteTime = now;
+			}
+
+			if (stopping && mRecords.IsEmpty())
+				break;
+
+			std::unique_lock<std::mutex> lock(mWriterMutex);
+			mWriterCondition.wait_for(lock, flushInterval, [&]() {
+				return mStopWriter || mFlushRequested || mRecords.GetApproxCount() > mRecords.GetCapacity()/2; });
+		}
+	}
+
+	void FileLogStream::FormatRecord(const Record& record, String& buffer)
+	{
+		static const char* levelNames[] = { "I", "W", "E", "D" };
+
+		char header[64];
+		snprintf(header, sizeof(header), "[%.6f %d %u] %s ", record.time, record.frame, record.threadId,
+				 levelNames[(int)record.level]);
+
+		buffer += header;
+		buffer += (String)record.message;
+		buffer += '\n';
+	}
+
+	void FileLogStream::WriteBatch(String& batch)
+	{
+		if (batch.IsEmpty())
+			return;
+
+		fwrite(batch.Data(), 1, batch.Length(), mFile);
+		batch.Clear();
+	}
+
+	UInt FileLogStream::GetCurrentThreadIdx()
+	{
+		static std::atomic<UInt> threadsCount(0);
+		static thread_local UInt threadIdx = threadsCount++;
+		return threadIdx;
 	}
 }
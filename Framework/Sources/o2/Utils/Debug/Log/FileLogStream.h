@@ -1,16 +1,24 @@
 #pragma once
 
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Types/Containers/ConcurrentQueue.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
 
 namespace o2
 {
-	// ----------------------------------------
-	// File log stream, puts messages into file
-	// ----------------------------------------
+	// --------------------------------------------------------------------------------------------
+	// File log stream, puts messages into file asynchronously. Messages are pushed as records with
+	// time, level, thread and frame into lock-free queue and written by background writer thread.
+	// Writer batches records into one write, flushing when batch is larger than flush size or when
+	// flush interval passed
+	// --------------------------------------------------------------------------------------------
 	class FileLogStream:public LogStream
 	{
-		String filename; // Target file
-
 	public:
 		// Constructor with file name
 		FileLogStream(const String& fileName);
@@ -18,11 +26,83 @@ namespace o2
 		// Constructor with id and file name
 		FileLogStream(const WString& id, const String& fileName);
 
-		// Destructor
+		// Destructor. Writes all pushed records and stops writer thread
 		~FileLogStream();
 
+		// Sets size of batch in bytes, when reached batch is written into file
+		void SetFlushSize(int bytes);
+
+		// Returns size of batch in bytes, when reached batch is written into file
+		int GetFlushSize() const;
+
+		// Sets max time in seconds between record push and write into file
+		void SetFlushInterval(float seconds);
+
+		// Returns max time in seconds between record push and write into file
+		float GetFlushInterval() const;
+
+		// Waits until all pushed records are written into file
+		void Flush();
+
+	protected:
+		// -----------------------------------------------------------
+		// Log record: message with time, frame, thread id and level
+		// -----------------------------------------------------------
+		struct Record
+		{
+			double   time = 0.0;               // Time in seconds from stream creation
+			int      frame = 0;                // Application frame index
+			UInt     threadId = 0;             // Index of thread which pushed record
+			LogLevel level = LogLevel::Regular; // Message level
+			WString  message;                  // Message text
+		};
+
+	protected:
+		String mFilename; // Target file
+		FILE*  mFile;     // Opened file handle, null when file not opened
+
+		ConcurrentQueue<Record> mRecords; // Pushed and not written records
+
+		std::thread             mWriterThread;    // Background writer thread
+		std::mutex              mWriterMutex;     // Writer wake up mutex
+		std::condition_variable mWriterCondition; // Writer wake up condition
+
+		std::atomic<bool>   mStopWriter;     // Is writer thread must stop after writing all records
+		std::atomic<bool>   mFlushRequested; // Is writer must write batch immediately
+		std::atomic<UInt64> mPushedCount;    // Count of pushed records
+		std::atomic<UInt64> mWrittenCount;   // Count of written records
+
+		std::atomic<int>   mFlushSize;     // Batch size in bytes, when reached batch is written
+		std::atomic<float> mFlushInterval; // Max time in seconds between push and write
+
+		std::chrono::steady_clock::time_point mStartTime; // Stream creation time
+
 	protected:
-		// Outs string into file
-		void OutStrEx(const WString& str);
+		// Pushes message into records queue
+		void OutStrEx(const WString& str) override;
+
+		// Pushes error message into records queue
+		void OutErrorEx(const WString& str) override;
+
+		// Pushes warning message into records queue
+		void OutWarningEx(const WString& str) override;
+
+		// Pushes record with level and message. Waits for writer when queue is full
+		void PushRecord(LogLevel level, const WString& str);
+
+		// Opens file and starts writer thread
+		void Initialize();
+
+		// Writer thread function, formats and writes records in batches
+		void WriterThreadFunc();
+
+		// Formats record into compact text line: [time frame thread] L message
+		static void FormatRecord(const Record& record, String& buffer);
+
+		// Writes batch into file and clears it
+		void WriteBatch(String& batch);
+
+		// Returns small index of current thread
+		static UInt GetCurrentThreadIdx();
 	};
 }
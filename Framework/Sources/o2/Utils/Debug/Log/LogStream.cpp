@@ -54,6 +54,9 @@ namespace o2
 
 	void LogStream::Out(WString format, ...)
 	{
+		if (!IsLevelEnabled(LogLevel::Regular))
+			return;
+
 		va_list vlist;
 		va_start(vlist, format);
 
@@ -64,6 +67,9 @@ namespace o2
 
 	void LogStream::Error(WString format, ...)
 	{
+		if (!IsLevelEnabled(LogLevel::Error))
+			return;
+
 		va_list vlist;
 		va_start(vlist, format);
 
@@ -74,6 +80,9 @@ namespace o2
 
 	void LogStream::Warning(WString format, ...)
 	{
+		if (!IsLevelEnabled(LogLevel::Warning))
+			return;
+
 		va_list vlist;
 		va_start(vlist, format);
 
@@ -87,8 +96,21 @@ namespace o2
 		return mParentStream;
 	}
 
+	void LogStream::SetLevel(LogLevel level)
+	{
+		mLevel = level;
+	}
+
+	LogLevel LogStream::GetLevel() const
+	{
+		return mLevel;
+	}
+
 	void LogStream::OutStr(const WString& str)
 	{
+		if (!IsLevelEnabled(LogLevel::Regular))
+			return;
+
 		OutStrEx(str);
 
 		if (mParentStream)
@@ -102,6 +124,9 @@ namespace o2
 
 	void LogStream::ErrorStr(const WString& str)
 	{
+		if (!IsLevelEnabled(LogLevel::Error))
+			return;
+
 		OutErrorEx(str);
 
 		if (mParentStream)
@@ -115,6 +140,9 @@ namespace o2
 
 	void LogStream::WarningStr(const WString& str)
 	{
+		if (!IsLevelEnabled(LogLevel::Warning))
+			return;
+
 		OutWarningEx(str);
 
 		if (mParentStream)
@@ -5,6 +5,9 @@
 
 namespace o2
 {
+	// Log message level. Messages with level lower than stream's level are skipped
+	enum class LogLevel { Regular, Warning, Error, Disabled };
+
 	// ---------------------------------------------------------------------------------
 	// Basic log stream. Contains interfaces of outing data, parent and children streams
 	// ---------------------------------------------------------------------------------
@@ -38,6 +41,15 @@ namespace o2
 		// Returns parent stream. Null if no parent
 		LogStream* GetParentStream() const;
 
+		// Sets minimal level of messages. Messages with lower level are skipped before formatting
+		void SetLevel(LogLevel level);
+
+		// Returns minimal level of messages
+		LogLevel GetLevel() const;
+
+		// Returns is messages with level passed to this stream
+		bool IsLevelEnabled(LogLevel level) const { return level >= mLevel; }
+
 		// Outs with low level log
 		void Out(WString format, ...);
 
@@ -61,6 +73,8 @@ namespace o2
 		WString            mId;           // Name of log stream
 		Vector<LogStream*> mChildStreams; // Child streams
 
+		LogLevel mLevel = LogLevel::Regular; // Minimal level of messages
+
 	protected:
 		// Outs string to stream
 		virtual void OutStrEx(const WString& str) {}
@@ -0,0 +1,351 @@
+#include "o2/stdafx.h"
+#include "Profiler.h"
+
+#if PROFILER_ENABLED
+
+#include "o2/Render/Render.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/FileSystem/File.h"
+
+#include <cstring>
+
+#undef DrawText
+
+namespace o2
+{
+	Profiler::Profiler():
+		mEnabled(true), mOverlayEnabled(false), mFrame(0), mBufferCapacity(64*1024)
+	{}
+
+	Profiler::~Profiler()
+	{
+		std::lock_guard<std::mutex> lock(mThreadsMutex);
+
+		for (auto buffer : mThreads)
+			delete buffer;
+
+		mThreads.Clear();
+	}
+
+	void Profiler::SetThreadBufferCapacity(int capacity)
+	{
+		mBufferCapacity = capacity;
+	}
+
+	int Profiler::GetThreadBufferCapacity() const
+	{
+		return mBufferCapacity;
+	}
+
+	void Profiler::SetEnabled(bool enabled)
+	{
+		mEnabled = enabled;
+	}
+
+	bool Profiler::IsEnabled() const
+	{
+		return mEnabled;
+	}
+
+	void Profiler::SetOverlayEnabled(bool enabled)
+	{
+		mOverlayEnabled = enabled;
+	}
+
+	bool Profiler::IsOverlayEnabled() const
+	{
+		return mOverlayEnabled;
+	}
+
+	void Profiler::BeginFrame()
+	{
+		mFrameBeginTicks = GetTicks();
+
+		if (ThreadBuffer* buffer = GetThreadBuffer())
+			mFramePosition = buffer->head.load(std::memory_order_relaxed);
+
+		PushDepth();
+	}
+
+	void Profiler::EndFrame()
+	{
+		PopDepth();
+
+		UInt64 frameEndTicks = GetTicks();
+		RecordZone("Frame", mFrameBeginTicks, frameEndTicks, 0);
+
+		mLastFrameTime = (double)(frameEndTicks - mFrameBeginTicks)/1000000.0;
+		mLastFrameStats.Clear();
+
+		if (ThreadBuffer* buffer = GetThreadBuffer())
+		{
+			Vector<Event> events;
+			buffer->Read(events, mFramePosition);
+
+			for (auto& event : events)
+			{
+				if (event.depth < 0)
+					continue;
+
+				ZoneStat* stat = nullptr;
+				for (auto& x : mLastFrameStats)
+				{
+					if (x.name == event.name || strcmp(x.name, event.name) == 0)
+					{
+						stat = &x;
+						break;
+					}
+				}
+
+				if (!stat)
+				{
+					mLastFrameStats.Add(ZoneStat());
+					stat = &mLastFrameStats.Last();
+					stat->name = event.name;
+					stat->depth = event.depth;
+				}
+
+				stat->depth = Math::Min(stat->depth, event.depth);
+				stat->time += (double)(event.end - event.begin)/1000000.0;
+				stat->calls++;
+			}
+
+			// Zones are recorded on exit, so parents go after children. Showing them from outer to inner
+			mLastFrameStats.SortBy<int>([](const ZoneStat& x) { return x.depth; });
+		}
+
+		mFrame++;
+	}
+
+	int Profiler::GetCurrentFrame() const
+	{
+		return mFrame;
+	}
+
+	double Profiler::GetLastFrameTime() const
+	{
+		return mLastFrameTime;
+	}
+
+	const Vector<Profiler::ZoneStat>& Profiler::GetLastFrameStats() const
+	{
+		return mLastFrameStats;
+	}
+
+	void Profiler::DrawOverlay(const Vec2F& position, const Color4& color /*= Color4::White()*/)
+	{
+		String text;
+		char line[256];
+
+		snprintf(line, sizeof(line), "Frame %d: %.2f ms, %d draw calls\n", (int)mFrame - 1, mLastFrameTime,
+				 o2Render.GetDrawCallsCount());
+		text += line;
+
+		for (auto& stat : mLastFrameStats)
+		{
+			snprintf(line, sizeof(line), "%*s%s: %.3f ms (%d)\n", stat.depth*2, "", stat.name, stat.time, stat.calls);
+			text += line;
+		}
+
+		o2Debug.DrawText(position, text, color);
+	}
+
+	void Profiler::DrawOverlay()
+	{
+		if (!mOverlayEnabled)
+			return;
+
+		Vec2F resolution = o2Render.GetResolution();
+		DrawOverlay(Vec2F(-resolution.x*0.5f + 10.0f, resolution.y*0.5f - 10.0f));
+	}
+
+	bool Profiler::SaveChromeTrace(const String& path) const
+	{
+		OutFile file(path);
+		if (!file.IsOpened())
+			return false;
+
+		String trace = GetChromeTrace();
+		file.WriteData(trace.Data(), trace.Length());
+
+		return true;
+	}
+
+	String Profiler::GetChromeTrace() const
+	{
+		String buffer;
+		buffer += "{\"traceEvents\":[\n";
+
+		char line[256];
+		bool first = true;
+
+		std::lock_guard<std::mutex> lock(mThreadsMutex);
+
+		Vector<Event> events;
+		for (auto threadBuffer : mThreads)
+		{
+			snprintf(line, sizeof(line), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,"
+					 "\"args\":{\"name\":\"%s %u\"}}", first ? "" : ",\n", threadBuffer->threadIdx,
+					 threadBuffer->threadIdx == 0 ? "Main thread" : "Thread", threadBuffer->threadIdx);
+			buffer += line;
+			first = false;
+
+			events.Clear();
+			threadBuffer->Read(events);
+
+			for (auto& event : events)
+			{
+				buffer += ",\n{\"name\":\"";
+				WriteEscaped(buffer, event.name);
+
+				if (event.depth < 0)
+				{
+					snprintf(line, sizeof(line), "\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":0,\"tid\":%u,\"args\":{\"value\":%g}}",
+							 (double)event.begin/1000.0, threadBuffer->threadIdx, event.value);
+				}
+				else
+				{
+					snprintf(line, sizeof(line), "\",\"cat\":\"o2\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%u,"
+							 "\"args\":{\"frame\":%d}}", (double)event.begin/1000.0, (double)(event.end - event.begin)/1000.0,
+							 threadBuffer->threadIdx, event.frame);
+				}
+
+				buffer += line;
+			}
+		}
+
+		buffer += "\n],\"displayTimeUnit\":\"ms\"}\n";
+		return buffer;
+	}
+
+	void Profiler::Clear()
+	{
+		std::lock_guard<std::mutex> lock(mThreadsMutex);
+
+		for (auto buffer : mThreads)
+			buffer->start = buffer->head.load(std::memory_order_acquire);
+
+		mLastFrameStats.Clear();
+	}
+
+	void Profiler::RecordZone(const char* name, UInt64 begin, UInt64 end, int depth)
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+		if (!buffer || !mInstance->mEnabled.load(std::memory_order_relaxed))
+			return;
+
+		Event event;
+		event.name = name;
+		event.begin = begin;
+		event.end = end;
+		event.depth = depth;
+		event.frame = mInstance->mFrame.load(std::memory_order_relaxed);
+
+		buffer->Write(event);
+	}
+
+	void Profiler::RecordCounter(const char* name, double value)
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+		if (!buffer || !mInstance->mEnabled.load(std::memory_order_relaxed))
+			return;
+
+		Event event;
+		event.name = name;
+		event.begin = GetTicks();
+		event.end = event.begin;
+		event.value = value;
+		event.depth = -1;
+		event.frame = mInstance->mFrame.load(std::memory_order_relaxed);
+
+		buffer->Write(event);
+	}
+
+	UInt64 Profiler::GetTicks()
+	{
+		static const auto startTime = std::chrono::steady_clock::now();
+		return (UInt64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+	}
+
+	static thread_local int threadZonesDepth = 0;
+
+	int Profiler::PushDepth()
+	{
+		return threadZonesDepth++;
+	}
+
+	void Profiler::PopDepth()
+	{
+		threadZonesDepth--;
+	}
+
+	Profiler::ThreadBuffer* Profiler::GetThreadBuffer()
+	{
+		static thread_local Profiler* owner = nullptr;
+		static thread_local ThreadBuffer* buffer = nullptr;
+
+		if (owner == mInstance)
+			return buffer;
+
+		if (!mInstance)
+			return nullptr;
+
+		std::lock_guard<std::mutex> lock(mInstance->mThreadsMutex);
+
+		owner = mInstance;
+		buffer = mnew ThreadBuffer(mInstance->mThreads.Count(), mInstance->mBufferCapacity);
+		mInstance->mThreads.Add(buffer);
+
+		return buffer;
+	}
+
+	void Profiler::WriteEscaped(String& buffer, const char* str)
+	{
+		for (const char* c = str; *c; c++)
+		{
+			if (*c == '"' || *c == '\\')
+				buffer += '\\';
+
+			buffer += *c;
+		}
+	}
+
+	Profiler::ThreadBuffer::ThreadBuffer(UInt idx, int capacity):
+		threadIdx(idx), head(0), start(0)
+	{
+		int size = 2;
+		while (size < capacity)
+			size <<= 1;
+
+		events.Resize(size);
+		mask = size - 1;
+	}
+
+	void Profiler::ThreadBuffer::Write(const Event& event)
+	{
+		std::lock_guard<std::mutex> guard(eventsMutex);
+
+		UInt64 pos = head.load(std::memory_order_relaxed);
+		events[(int)(pos & mask)] = event;
+		head.store(pos + 1, std::memory_order_release);
+	}
+
+	void Profiler::ThreadBuffer::Read(Vector<Event>& result, UInt64 from /*= 0*/) const
+	{
+		// Events are copied under lock, owner thread can't overwrite them while copying
+		std::lock_guard<std::mutex> guard(eventsMutex);
+
+		UInt64 capacity = mask + 1;
+		UInt64 end = head.load(std::memory_order_relaxed);
+		UInt64 begin = Math::Max(from, start.load(std::memory_order_relaxed));
+
+		if (end > capacity)
+			begin = Math::Max(begin, end - capacity);
+
+		result.Reserve(result.Count() + (int)(end - Math::Min(begin, end)));
+		for (UInt64 pos = begin; pos < end; pos++)
+			result.Add(events[(int)(pos & mask)]);
+	}
+}
+
+#endif
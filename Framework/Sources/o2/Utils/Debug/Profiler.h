@@ -0,0 +1,221 @@
+#pragma once
+
+#include "o2/EngineSettings.h"
+
+#if PROFILER_ENABLED
+
+#include "o2/Utils/Math/Color.h"
+#include "o2/Utils/Math/Vector2.h"
+#include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+// Profiler access macros
+#define o2Profiler o2::Profiler::Instance()
+
+#define PROFILER_CONCAT_IMPL(A, B) A##B
+#define PROFILER_CONCAT(A, B) PROFILER_CONCAT_IMPL(A, B)
+
+// Profiles current scope as zone with name. Name must be string literal or other string with static lifetime
+#define PROFILE_SCOPE(NAME) o2::ProfilerScope PROFILER_CONCAT(profilerScope, __LINE__)(NAME)
+
+// Profiles current function as zone. Named by full signature, so methods with same names of different classes
+// are different zones
+#if defined(_MSC_VER)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCSIG__)
+#else
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__PRETTY_FUNCTION__)
+#endif
+
+// Records counter value. Name must be string literal or other string with static lifetime
+#define PROFILE_COUNTER(NAME, VALUE) o2::Profiler::RecordCounter(NAME, (double)(VALUE))
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------
+	// Frame profiler. Records CPU zones and counters into per-thread ring buffers: each thread writes
+	// only into own buffer under its uncontended lock, old events are overwritten. Keeps statistics of
+	// last frame for overlay and exports recorded timelines of all threads into Chrome trace JSON
+	// -----------------------------------------------------------------------------------------------
+	class Profiler: public Singleton<Profiler>
+	{
+	public:
+		// ------------------------------------------------------
+		// Zone statistics of frame: summary time and calls count
+		// ------------------------------------------------------
+		struct ZoneStat
+		{
+			const char* name = nullptr; // Zone name
+			int         depth = 0;      // Minimal depth of zone in frame
+			double      time = 0.0;     // Summary time in milliseconds
+			int         calls = 0;      // Count of zone calls
+		};
+
+	public:
+		// Default constructor
+		Profiler();
+
+		// Destructor
+		~Profiler();
+
+		// Sets capacity of each thread events buffer. Applied to buffers of new threads
+		void SetThreadBufferCapacity(int capacity);
+
+		// Returns capacity of each thread events buffer
+		int GetThreadBufferCapacity() const;
+
+		// Enables or disables events recording
+		void SetEnabled(bool enabled);
+
+		// Returns is events recording enabled
+		bool IsEnabled() const;
+
+		// Enables or disables frame breakdown overlay
+		void SetOverlayEnabled(bool enabled);
+
+		// Returns is frame breakdown overlay enabled
+		bool IsOverlayEnabled() const;
+
+		// Marks beginning of frame. Called by application
+		void BeginFrame();
+
+		// Marks ending of frame: records whole frame zone and collects frame statistics of current thread.
+		// Called by application
+		void EndFrame();
+
+		// Returns index of current frame
+		int GetCurrentFrame() const;
+
+		// Returns duration of last frame in milliseconds
+		double GetLastFrameTime() const;
+
+		// Returns zones statistics of last frame sorted by zone depth
+		const Vector<ZoneStat>& GetLastFrameStats() const;
+
+		// Draws last frame breakdown by o2Debug text from position
+		void DrawOverlay(const Vec2F& position, const Color4& color = Color4::White());
+
+		// Draws last frame breakdown by o2Debug text at left top corner of screen, when overlay enabled
+		void DrawOverlay();
+
+		// Saves recorded events of all threads into Chrome trace JSON file. Returns false when file not written
+		bool SaveChromeTrace(const String& path) const;
+
+		// Returns recorded events of all threads as Chrome trace JSON
+		String GetChromeTrace() const;
+
+		// Removes all recorded events
+		void Clear();
+
+		// Records zone from begin to end ticks on current thread
+		static void RecordZone(const char* name, UInt64 begin, UInt64 end, int depth);
+
+		// Records counter value on current thread
+		static void RecordCounter(const char* name, double value);
+
+		// Returns current time in profiler ticks (nanoseconds)
+		static UInt64 GetTicks();
+
+		// Returns depth of zones on current thread and increases it
+		static int PushDepth();
+
+		// Decreases depth of zones on current thread
+		static void PopDepth();
+
+	protected:
+		// ---------------------------------------------
+		// Recorded event: zone with duration or counter
+		// ---------------------------------------------
+		struct Event
+		{
+			const char* name = nullptr; // Event name
+			UInt64      begin = 0;      // Begin time in ticks
+			UInt64      end = 0;        // End time in ticks. Equals begin for counters
+			double      value = 0.0;    // Counter value
+			int         depth = 0;      // Depth of zone. -1 for counters
+			int         frame = 0;      // Frame index
+		};
+
+		// -----------------------------------------------------------------------------------------------
+		// Events ring buffer of one thread. Written only by owner thread. Events are written and copied
+		// under buffer's own lock, which is almost never contended: only readers of other threads take it
+		// -----------------------------------------------------------------------------------------------
+		struct ThreadBuffer
+		{
+			UInt                threadIdx = 0; // Index of thread in order of first event
+			Vector<Event>       events;        // Ring buffer of events, power of two size
+			UInt64              mask = 0;      // Position mask, capacity - 1
+			std::atomic<UInt64> head;          // Count of written events
+			std::atomic<UInt64> start;         // Position of first not cleared event
+			mutable std::mutex  eventsMutex;   // Events writing and reading lock
+
+			// Constructor with capacity
+			ThreadBuffer(UInt idx, int capacity);
+
+			// Writes event into buffer
+			void Write(const Event& event);
+
+			// Copies not overwritten events since position into result
+			void Read(Vector<Event>& result, UInt64 from = 0) const;
+		};
+
+	protected:
+		std::atomic<bool> mEnabled;        // Is recording enabled
+		bool              mOverlayEnabled; // Is frame breakdown overlay enabled
+
+		std::atomic<int> mFrame;               // Current frame index
+		int              mBufferCapacity;      // Capacity of new thread buffers
+		UInt64           mFrameBeginTicks = 0; // Current frame begin time
+		UInt64           mFramePosition = 0;   // Position in current thread buffer at frame beginning
+		double           mLastFrameTime = 0.0; // Last frame duration in milliseconds
+		Vector<ZoneStat> mLastFrameStats;      // Zones statistics of last frame
+
+		mutable std::mutex    mThreadsMutex; // Threads list mutex
+		Vector<ThreadBuffer*> mThreads;      // Buffers of all threads, which recorded events
+
+	protected:
+		// Returns buffer of current thread, creates it when required. Returns null when profiler isn't initialized
+		static ThreadBuffer* GetThreadBuffer();
+
+		// Writes escaped for JSON string into buffer
+		static void WriteEscaped(String& buffer, const char* str);
+
+		friend class ProfilerScope;
+	};
+
+	// -----------------------------------------------------------------------------------
+	// Scoped profiler zone. Remembers begin time on construction and records zone on exit
+	// -----------------------------------------------------------------------------------
+	class ProfilerScope
+	{
+	public:
+		// Constructor with zone name
+		ProfilerScope(const char* name):
+			mName(name), mBegin(Profiler::GetTicks()), mDepth(Profiler::PushDepth())
+		{}
+
+		// Destructor. Records zone
+		~ProfilerScope()
+		{
+			Profiler::PopDepth();
+			Profiler::RecordZone(mName, mBegin, Profiler::GetTicks(), mDepth);
+		}
+
+	protected:
+		const char* mName;  // Zone name
+		UInt64      mBegin; // Begin time in ticks
+		int         mDepth; // Depth of zone
+	};
+}
+
+#else
+
+#define PROFILE_SCOPE(NAME)
+#define PROFILE_FUNCTION()
+#define PROFILE_COUNTER(NAME, VALUE)
+
+#endif
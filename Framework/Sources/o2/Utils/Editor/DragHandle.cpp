@@ -232,6 +232,14 @@ namespace o2
 		return false;
 	}
 
+	RectF DragHandle::GetCursorAreaBounds() const
+	{
+		if (isPointInside.IsEmpty() && mRegularSprite)
+			return mRegularSprite->GetAxisAlignedRect();
+
+		return mScissorRect;
+	}
+
 	Vec2F DragHandle::ScreenToLocal(const Vec2F& point)
 	{
 		return screenToLocalTransformFunc(point);
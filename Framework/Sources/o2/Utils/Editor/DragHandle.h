@@ -72,6 +72,9 @@ namespace o2
 		// Returns true if point is above this
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns regular sprite bounds, or clipping rect when custom point check is used
+		RectF GetCursorAreaBounds() const override;
+
 		// Sets position
 		void SetPosition(const Vec2F& position);
 
@@ -492,6 +495,7 @@ CLASS_METHODS_META(o2::DragHandle)
 	PUBLIC_FUNCTION(void, Draw);
 	PUBLIC_FUNCTION(void, Draw, const RectF&);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorAreaBounds);
 	PUBLIC_FUNCTION(void, SetPosition, const Vec2F&);
 	PUBLIC_FUNCTION(const Vec2F&, GetScreenPosition);
 	PUBLIC_FUNCTION(void, UpdateScreenPosition);
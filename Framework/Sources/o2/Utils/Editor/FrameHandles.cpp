@@ -154,6 +154,11 @@ namespace o2
 		return mFrame.IsPointInside(point);
 	}
 
+	RectF FrameHandles::GetCursorAreaBounds() const
+	{
+		return mFrame.AABB();
+	}
+
 	void FrameHandles::SetPivotEnabled(bool enabled)
 	{
 		mIsPivotAvailable = enabled;
@@ -39,6 +39,9 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns frame axis aligned bounds
+		RectF GetCursorAreaBounds() const override;
+
 		// Sets pivot editing available
 		void SetPivotEnabled(bool enabled);
 
@@ -145,8 +145,15 @@ namespace o2
 		return true;
 	}
 
+	UInt SceneEditableObject::GetChangesVersion() const
+	{
+		return mChangesVersion;
+	}
+
 	void SceneEditableObject::OnChanged()
-	{ }
+	{
+		mChangesVersion++;
+	}
 
 	void SceneEditableObject::OnLockChanged()
 	{ }
@@ -113,7 +113,10 @@ namespace o2
 		// Returns is that type of object can be deleted from editor
 		virtual bool IsSupportsDeleting() const;
 
-		// It is called when something changed in this object
+		// Returns changes version. It increases each time when object changes, so viewers can skip unchanged objects
+		UInt GetChangesVersion() const;
+
+		// It is called when something changed in this object. Increases changes version
 		virtual void OnChanged();
 
 		// It is called when actor's locking was changed
@@ -126,6 +129,11 @@ namespace o2
 		virtual void OnChildrenChanged();
 
 		SERIALIZABLE(SceneEditableObject);
+
+	protected:
+		UInt mChangesVersion = 0; // Changes version, increases on each change
+
+		friend class Scene;
 	};
 }
 
@@ -136,6 +144,7 @@ CLASS_BASES_META(o2::SceneEditableObject)
 END_META;
 CLASS_FIELDS_META(o2::SceneEditableObject)
 {
+	PROTECTED_FIELD(mChangesVersion).DEFAULT_VALUE(0);
 }
 END_META;
 CLASS_METHODS_META(o2::SceneEditableObject)
@@ -172,6 +181,7 @@ CLASS_METHODS_META(o2::SceneEditableObject)
 	PUBLIC_FUNCTION(Layout, GetLayout);
 	PUBLIC_FUNCTION(void, SetLayout, const Layout&);
 	PUBLIC_FUNCTION(bool, IsSupportsDeleting);
+	PUBLIC_FUNCTION(UInt, GetChangesVersion);
 	PUBLIC_FUNCTION(void, OnChanged);
 	PUBLIC_FUNCTION(void, OnLockChanged);
 	PUBLIC_FUNCTION(void, OnNameChanged);
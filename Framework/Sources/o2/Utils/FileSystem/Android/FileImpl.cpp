@@ -73,12 +73,14 @@ namespace o2
     String InFile::ReadFullData()
     {
         UInt len = GetDataSize();
-        char* buffer = mnew char[len + 1];
 
-        ReadData(buffer, len);
-        buffer[len] = '\0';
+        String res;
+        res.resize(len);
 
-        return String(buffer);
+        SetCaretPos(0);
+        ReadData(&res[0], len);
+
+        return res;
     }
 
     void InFile::ReadData(void *dataPtr, UInt bytes)
@@ -0,0 +1,110 @@
+#include "o2/stdafx.h"
+
+#if defined PLATFORM_ANDROID
+
+#include "o2/Utils/FileSystem/MappedFile.h"
+
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Math/Math.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace o2
+{
+    bool MappedFile::Open(const String& filename, AccessHint hint /*= AccessHint::Sequential*/)
+    {
+        Close();
+
+        if (filename.StartsWith(GetAndroidAssetsPath()))
+        {
+            // Buffer mode maps uncompressed assets straight from package
+            String assetsPath = filename.SubStr(((String)GetAndroidAssetsPath()).Length());
+            mAsset = AAssetManager_open(o2FileSystem.GetAssetManager(), assetsPath, AASSET_MODE_BUFFER);
+
+            if (!mAsset)
+                return false;
+
+            mData = (const char*)AAsset_getBuffer(mAsset);
+            mDataSize = (UInt64)AAsset_getLength64(mAsset);
+
+            if (!mData)
+            {
+                AAsset_close(mAsset);
+                mAsset = nullptr;
+                mDataSize = 0;
+                return false;
+            }
+        }
+        else
+        {
+            int fd = open(filename.Data(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+                return false;
+
+            struct stat fileStat;
+            if (fstat(fd, &fileStat) != 0)
+            {
+                close(fd);
+                return false;
+            }
+
+            mDataSize = (UInt64)fileStat.st_size;
+
+            if (mDataSize > 0)
+            {
+                void* data = mmap(nullptr, mDataSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data == MAP_FAILED)
+                {
+                    close(fd);
+                    mDataSize = 0;
+                    return false;
+                }
+
+                madvise(data, mDataSize, hint == AccessHint::Sequential ? MADV_SEQUENTIAL :
+                        (hint == AccessHint::Random ? MADV_RANDOM : MADV_NORMAL));
+
+                mData = (const char*)data;
+            }
+            else
+                mData = "";
+
+            close(fd);
+        }
+
+        mOpened = true;
+        mFilename = filename;
+
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (mAsset)
+            AAsset_close(mAsset);
+        else if (mOpened && mDataSize > 0)
+            munmap((void*)mData, mDataSize);
+
+        mAsset = nullptr;
+        mData = nullptr;
+        mDataSize = 0;
+        mOpened = false;
+    }
+
+    void MappedFile::Prefetch(UInt64 offset, UInt64 size) const
+    {
+        if (!mOpened || mAsset || offset >= mDataSize)
+            return;
+
+        static const UInt64 pageSize = (UInt64)sysconf(_SC_PAGESIZE);
+
+        UInt64 begin = offset - offset%pageSize;
+        UInt64 end = Math::Min(offset + size, mDataSize);
+
+        madvise((void*)(mData + begin), end - begin, MADV_WILLNEED);
+    }
+}
+
+#endif
@@ -57,11 +57,16 @@ namespace o2
 
 	String FileSystem::ReadFile(const String& path)
 	{
-		InFile file(path);
+		MappedFile file(path);
 		if (!file.IsOpened())
 			return String();
 
-		return file.ReadFullData();
+		return String(std::string(file.GetData(), (size_t)file.GetDataSize()));
+	}
+
+	MappedFile FileSystem::MapFile(const String& path, MappedFile::AccessHint hint /*= MappedFile::AccessHint::Sequential*/)
+	{
+		return MappedFile(path, hint);
 	}
 
 	void FileSystem::WriteFile(const String& path, const String& data)
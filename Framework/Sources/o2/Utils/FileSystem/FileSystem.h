@@ -3,6 +3,7 @@
 #include "o2/Utils/Types/Containers/Map.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/FileSystem/FileInfo.h"
+#include "o2/Utils/FileSystem/MappedFile.h"
 
 #include "o2/Utils/Singleton.h"
 #include "o2/Utils/Types/String.h"
@@ -89,6 +90,9 @@ namespace o2
 		// Read file and returns result
 		static String ReadFile(const String& path);
 
+		// Maps file into memory for reading without copying. Check IsOpened() for result
+		static MappedFile MapFile(const String& path, MappedFile::AccessHint hint = MappedFile::AccessHint::Sequential);
+
 		// Returns a relative path from one path to another
 		static String GetPathRelativeToPath(const String& from, const String& to);
 
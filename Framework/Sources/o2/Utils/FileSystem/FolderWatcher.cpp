@@ -0,0 +1,233 @@
+#include "o2/stdafx.h"
+#include "FolderWatcher.h"
+
+#include "o2/Utils/FileSystem/FileSystem.h"
+
+namespace o2
+{
+	FolderWatcher::FolderWatcher()
+	{}
+
+	FolderWatcher::~FolderWatcher()
+	{
+		Stop();
+	}
+
+	bool FolderWatcher::Start(const String& path)
+	{
+		Stop();
+
+		if (!o2FileSystem.IsFolderExist(path))
+			return false;
+
+		mPath = path;
+		mFolderInfo = o2FileSystem.GetFolderInfo(path);
+		mWatching = InitializeNotifications();
+
+		return mWatching;
+	}
+
+	void FolderWatcher::Stop()
+	{
+		if (mWatching)
+			ReleaseNotifications();
+
+		mWatching = false;
+		mFolderInfo = FolderInfo();
+		ResetChangedPaths();
+	}
+
+	bool FolderWatcher::IsWatching() const
+	{
+		return mWatching;
+	}
+
+	bool FolderWatcher::Update()
+	{
+		if (!mWatching)
+			return false;
+
+		int changedCount = mChangedPaths.Count();
+		ReadNotifications();
+
+		return mChangedPaths.Count() != changedCount;
+	}
+
+	const String& FolderWatcher::GetPath() const
+	{
+		return mPath;
+	}
+
+	const FolderInfo& FolderWatcher::GetFolderInfo() const
+	{
+		return mFolderInfo;
+	}
+
+	const FolderInfo* FolderWatcher::FindFolderInfo(const String& relativePath) const
+	{
+		String path = relativePath.IsEmpty() ? mFolderInfo.path : mFolderInfo.path + "/" + relativePath;
+		return const_cast<FolderWatcher*>(this)->FindFolder(path);
+	}
+
+	const Vector<String>& FolderWatcher::GetChangedPaths() const
+	{
+		return mChangedPaths;
+	}
+
+	void FolderWatcher::ResetChangedPaths()
+	{
+		mChangedPaths.Clear();
+		mChangedPathsSet.Clear();
+	}
+
+	void FolderWatcher::UpdateByRescan()
+	{
+		FolderInfo newFolderInfo = o2FileSystem.GetFolderInfo(mPath);
+		CollectDifferences(mFolderInfo, newFolderInfo);
+		mFolderInfo = std::move(newFolderInfo);
+	}
+
+	void FolderWatcher::CollectDifferences(const FolderInfo& oldFolder, const FolderInfo& newFolder)
+	{
+		HashMap<String, const FileInfo*> oldFiles;
+		oldFiles.Reserve(oldFolder.files.Count());
+		for (auto& file : oldFolder.files)
+			oldFiles[file.path] = &file;
+
+		for (auto& file : newFolder.files)
+		{
+			const FileInfo* oldFile = nullptr;
+			if (!oldFiles.TryGetValue(file.path, oldFile))
+			{
+				MarkChanged(file.path);
+				continue;
+			}
+
+			if (oldFile->editDate != file.editDate || oldFile->size != file.size)
+				MarkChanged(file.path);
+
+			oldFiles.Remove(file.path);
+		}
+
+		for (auto& kv : oldFiles)
+			MarkChanged(kv.first);
+
+		HashMap<String, const FolderInfo*> oldSubFolders;
+		for (auto& subFolder : oldFolder.folders)
+			oldSubFolders[subFolder.path] = &subFolder;
+
+		for (auto& subFolder : newFolder.folders)
+		{
+			const FolderInfo* oldSubFolder = nullptr;
+			if (!oldSubFolders.TryGetValue(subFolder.path, oldSubFolder))
+			{
+				MarkChangedRecursive(subFolder);
+				continue;
+			}
+
+			CollectDifferences(*oldSubFolder, subFolder);
+			oldSubFolders.Remove(subFolder.path);
+		}
+
+		for (auto& kv : oldSubFolders)
+			MarkChanged(kv.first);
+	}
+
+	FolderInfo* FolderWatcher::FindFolder(const String& path)
+	{
+		FolderInfo* folder = &mFolderInfo;
+		while (folder)
+		{
+			if (folder->path == path)
+				return folder;
+
+			FolderInfo* next = nullptr;
+			for (auto& subFolder : folder->folders)
+			{
+				if (path == subFolder.path || path.StartsWith(subFolder.path + "/"))
+				{
+					next = &subFolder;
+					break;
+				}
+			}
+
+			folder = next;
+		}
+
+		return nullptr;
+	}
+
+	void FolderWatcher::OnFileChanged(const String& path)
+	{
+		FolderInfo* folder = FindFolder(path.SubStr(0, path.FindLast("/")));
+		if (!folder)
+			return;
+
+		// File can be already removed when change notification is processed
+		if (!o2FileSystem.IsFileExist(path))
+		{
+			OnFileRemoved(path);
+			return;
+		}
+
+		FileInfo info = o2FileSystem.GetFileInfo(path);
+		info.path = path;
+
+		if (FileInfo* existing = folder->files.Find([&](const FileInfo& x) { return x.path == path; }))
+			*existing = info;
+		else
+			folder->files.Add(info);
+
+		MarkChanged(path);
+	}
+
+	void FolderWatcher::OnFileRemoved(const String& path)
+	{
+		if (FolderInfo* folder = FindFolder(path.SubStr(0, path.FindLast("/"))))
+			folder->files.RemoveAll([&](const FileInfo& x) { return x.path == path; });
+
+		MarkChanged(path);
+	}
+
+	FolderInfo* FolderWatcher::OnFolderAdded(const String& path)
+	{
+		FolderInfo* parent = FindFolder(path.SubStr(0, path.FindLast("/")));
+		if (!parent)
+			return nullptr;
+
+		FolderInfo* folder = parent->folders.Find([&](const FolderInfo& x) { return x.path == path; });
+		if (!folder)
+			folder = &parent->folders.Add(FolderInfo());
+
+		*folder = o2FileSystem.GetFolderInfo(path);
+		MarkChangedRecursive(*folder);
+
+		return folder;
+	}
+
+	void FolderWatcher::OnFolderRemoved(const String& path)
+	{
+		if (FolderInfo* parent = FindFolder(path.SubStr(0, path.FindLast("/"))))
+			parent->folders.RemoveAll([&](const FolderInfo& x) { return x.path == path; });
+
+		MarkChanged(path);
+	}
+
+	void FolderWatcher::MarkChanged(const String& path)
+	{
+		String relativePath = path.SubStr(Math::Min(mPath.Length() + 1, path.Length()));
+		if (mChangedPathsSet.Add(relativePath))
+			mChangedPaths.Add(relativePath);
+	}
+
+	void FolderWatcher::MarkChangedRecursive(const FolderInfo& folder)
+	{
+		MarkChanged(folder.path);
+
+		for (auto& file : folder.files)
+			MarkChanged(file.path);
+
+		for (auto& subFolder : folder.folders)
+			MarkChangedRecursive(subFolder);
+	}
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "o2/Utils/FileSystem/FileInfo.h"
+#include "o2/Utils/Types/Containers/HashMap.h"
+#include "o2/Utils/Types/Containers/HashSet.h"
+#include "o2/Utils/Types/String.h"
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------------------
+	// Folder watcher. Scans folder once and keeps its folder info actual by system change notifications, so
+	// only changed files are stated again. Collects changed paths (relative to watched folder) until they are
+	// reset. On platforms without notifications folder is rescanned and compared with previous state
+	// -------------------------------------------------------------------------------------------------------
+	class FolderWatcher
+	{
+	public:
+		// Default constructor
+		FolderWatcher();
+
+		// Destructor
+		~FolderWatcher();
+
+		// Scans folder and starts watching it
+		bool Start(const String& path);
+
+		// Stops watching and clears folder info
+		void Stop();
+
+		// Returns true, if watching is started
+		bool IsWatching() const;
+
+		// Reads pending changes and applies them to folder info. Returns true if something was changed
+		bool Update();
+
+		// Returns watching folder path
+		const String& GetPath() const;
+
+		// Returns actual folder info, paths are full as in FileSystem::GetFolderInfo
+		const FolderInfo& GetFolderInfo() const;
+
+		// Returns folder info by path relative to watching folder, nullptr when it is not found
+		const FolderInfo* FindFolderInfo(const String& relativePath) const;
+
+		// Returns changed files and folders paths, relative to watching folder. Removed folder is reported by
+		// its own path, new folder is reported with all its content
+		const Vector<String>& GetChangedPaths() const;
+
+		// Clears changed paths
+		void ResetChangedPaths();
+
+	protected:
+		String     mPath;             // Watching folder path
+		FolderInfo mFolderInfo;       // Actual folder info
+		bool       mWatching = false; // True, when watching is started
+
+		Vector<String>  mChangedPaths;    // Changed paths in order of changing
+		HashSet<String> mChangedPathsSet; // Changed paths set, for skipping duplicates
+
+#if defined(PLATFORM_LINUX)
+		int                  mNotifyFd = -1;  // inotify instance descriptor
+		HashMap<int, String> mWatchedFolders; // Watched folders paths by watch descriptors
+		HashMap<String, int> mFoldersWatches; // Watch descriptors by watched folders paths
+#endif
+
+	protected:
+		// Initializes system notifications for folder info
+		bool InitializeNotifications();
+
+		// Releases system notifications
+		void ReleaseNotifications();
+
+		// Reads system notifications and applies them
+		void ReadNotifications();
+
+		// Rescans whole folder and collects differences with current folder info
+		void UpdateByRescan();
+
+		// Collects differences between folders infos as changed paths
+		void CollectDifferences(const FolderInfo& oldFolder, const FolderInfo& newFolder);
+
+		// Returns folder info by full path, nullptr when it is not found
+		FolderInfo* FindFolder(const String& path);
+
+		// Updates or adds file info and marks it as changed
+		void OnFileChanged(const String& path);
+
+		// Removes file info and marks it as changed
+		void OnFileRemoved(const String& path);
+
+		// Scans new folder, adds it into info and marks all its content as changed. Returns added folder
+		FolderInfo* OnFolderAdded(const String& path);
+
+		// Removes folder info and marks it as changed
+		void OnFolderRemoved(const String& path);
+
+		// Marks full path as changed
+		void MarkChanged(const String& path);
+
+		// Marks folder and all its content as changed
+		void MarkChangedRecursive(const FolderInfo& folder);
+	};
+}
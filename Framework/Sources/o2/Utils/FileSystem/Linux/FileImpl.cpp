@@ -57,13 +57,14 @@ String
 InFile::ReadFullData()
 {
     UInt len = GetDataSize();
-    char *buffer = mnew char[len + 1];
+
+    String res;
+    res.resize(len);
 
     SetCaretPos(0);
-    ReadData(buffer, len);
-    buffer[len] = '\0';
+    ReadData(&res[0], len);
 
-    return String(buffer);
+    return res;
 }
 
 void
@@ -23,9 +23,18 @@
 #endif
 
 
+#include <algorithm>
+#include <condition_variable>
 #include <ctime>
+#include <dirent.h>
+#include <fcntl.h>
+#include <mutex>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/time.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
 
 namespace o2
 {
@@ -38,44 +47,203 @@ convert(const String &path)
     return p;
 }
 
-template<typename TP>
-std::time_t
-to_time_t(TP tp)
-{
-    using namespace std::chrono;
-    auto sctp =
-        time_point_cast<system_clock::duration>(tp - TP::clock::now() + system_clock::now());
-    return system_clock::to_time_t(sctp);
-}
-
 o2::TimeStamp
 convert(const time_t *value)
 {
-    auto local_time = std::localtime(value);
+    // Reentrant version, folders are scanned from several threads
+    struct tm local_time = {};
+    localtime_r(value, &local_time);
 
     o2::TimeStamp ts;
-    ts.mYear = 1900 + local_time->tm_year;
-    ts.mMonth = local_time->tm_mon;
-    ts.mDay = local_time->tm_mday;
-    ts.mHour = local_time->tm_hour;
-    ts.mMinute = local_time->tm_min;
-    ts.mSecond = local_time->tm_sec;
+    ts.mYear = 1900 + local_time.tm_year;
+    ts.mMonth = local_time.tm_mon;
+    ts.mDay = local_time.tm_mday;
+    ts.mHour = local_time.tm_hour;
+    ts.mMinute = local_time.tm_min;
+    ts.mSecond = local_time.tm_sec;
 
     return ts;
 }
 
-o2::TimeStamp
-convert(std::filesystem::file_time_type value)
+void
+fill(FileInfo &info, const struct stat64 &buffer)
 {
-    auto t = to_time_t(value);
-    return convert(&t);
+    info.size = buffer.st_size;
+    info.createdDate = convert(&buffer.st_ctim.tv_sec);
+    info.accessDate = convert(&buffer.st_atim.tv_sec);
+    info.editDate = convert(&buffer.st_mtim.tv_sec);
 }
+
+// Directory entry layout returned by getdents64 syscall
+struct linux_dirent64
+{
+    ino64_t        d_ino;
+    off64_t        d_off;
+    unsigned short d_reclen;
+    unsigned char  d_type;
+    char           d_name[];
+};
+
+// Scans folders tree with several threads. Each folder is listed with getdents64 in big chunks, files are
+// stated relative to opened folder descriptor, so paths are not resolved again for each file
+class ParallelFolderScanner
+{
+public:
+    explicit ParallelFolderScanner(FolderInfo &root):
+        mRoot(root)
+    {}
+
+    // Scans whole tree, returns false if root folder can't be opened
+    bool
+    Run()
+    {
+        mPending.push_back(&mRoot);
+
+        int threadsCount = std::clamp((int)std::thread::hardware_concurrency(), 1, 8);
+
+        std::vector<std::thread> threads;
+        for (int i = 1; i < threadsCount; i++)
+            threads.emplace_back([this]() { WorkerLoop(); });
+
+        WorkerLoop();
+
+        for (auto &thread : threads)
+            thread.join();
+
+        return mRootOpened;
+    }
+
+private:
+    FolderInfo &mRoot;
+
+    std::mutex               mMutex;
+    std::condition_variable  mCondition;
+    std::vector<FolderInfo*> mPending;            // Folders waiting for scanning
+    int                      mScanningCount = 0; // Count of folders in scanning right now
+    bool                     mRootOpened = false;
+
+private:
+    void
+    WorkerLoop()
+    {
+        std::vector<FolderInfo*> subFolders;
+
+        while (true)
+        {
+            FolderInfo *folder = nullptr;
+
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [&]() { return !mPending.empty() || mScanningCount == 0; });
+
+                if (mPending.empty())
+                    return;
+
+                folder = mPending.back();
+                mPending.pop_back();
+                mScanningCount++;
+            }
+
+            subFolders.clear();
+            ScanFolder(*folder, subFolders);
+
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mPending.insert(mPending.end(), subFolders.begin(), subFolders.end());
+                mScanningCount--;
+            }
+
+            mCondition.notify_all();
+        }
+    }
+
+    void
+    ScanFolder(FolderInfo &folder, std::vector<FolderInfo*> &subFolders)
+    {
+        int dirFd = open(folder.path.Data(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (dirFd < 0)
+            return;
+
+        if (&folder == &mRoot)
+            mRootOpened = true;
+
+        std::vector<String> subFolderNames;
+
+        alignas(linux_dirent64) char buffer[32*1024];
+        while (true)
+        {
+            long readBytes = syscall(SYS_getdents64, dirFd, buffer, sizeof(buffer));
+            if (readBytes <= 0)
+                break;
+
+            for (long offset = 0; offset < readBytes;)
+            {
+                auto entry = (linux_dirent64*)(buffer + offset);
+                offset += entry->d_reclen;
+
+                const char *name = entry->d_name;
+                if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0)
+                    continue;
+
+                bool isFolder = entry->d_type == DT_DIR;
+
+                struct stat64 fileStat = {};
+                if (!isFolder)
+                {
+                    if (fstatat64(dirFd, name, &fileStat, 0) != 0)
+                        continue;
+
+                    // Links to folders are skipped, they can make cycles
+                    if (S_ISDIR(fileStat.st_mode) && entry->d_type == DT_LNK)
+                        continue;
+
+                    isFolder = S_ISDIR(fileStat.st_mode);
+                }
+
+                if (isFolder)
+                {
+                    subFolderNames.push_back(name);
+                    continue;
+                }
+
+                FileInfo info;
+                info.path = folder.path + "/" + name;
+                fill(info, fileStat);
+
+                folder.files.Add(info);
+            }
+        }
+
+        close(dirFd);
+
+        // Entries come in directory order, sort them to get same result on each scan
+        folder.files.Sort([](const FileInfo &a, const FileInfo &b) { return a.path < b.path; });
+        std::sort(subFolderNames.begin(), subFolderNames.end());
+
+        // Sub folders are allocated once, so pointers to them are stable while they are scanned
+        folder.folders.Resize((int)subFolderNames.size());
+        for (int i = 0; i < (int)subFolderNames.size(); i++)
+        {
+            folder.folders[i].path = folder.path + "/" + subFolderNames[i];
+            subFolders.push_back(&folder.folders[i]);
+        }
+    }
+};
 }
 
 FolderInfo
 FileSystem::GetFolderInfo(const String &path) const
 {
-    return {};
+    FolderInfo res;
+    res.path = path;
+
+    ParallelFolderScanner scanner(res);
+    if (!scanner.Run())
+    {
+        mLog->Error("Failed GetPathInfo: Error opening directory " + path);
+    }
+
+    return res;
 }
 
 bool
@@ -120,31 +288,17 @@ FileSystem::GetFileInfo(const String &path) const
 {
     FileInfo info;
     info.path = path;
+    info.size = 0;
 
-    auto p = convert(path);
-
-    {
-        std::error_code ec;
-        info.size = std::filesystem::file_size(p, ec);
-        if (ec)
-        {
-            info.size = 0;
-        }
-    }
+    // Same stat fields as in folder scanning, so edit dates from both ways are equal
+    struct stat64 buffer = {};
 
+    auto err = stat64(path.Data(), &buffer);
+    if (!err)
     {
-        struct stat64 buffer = {};
-
-        auto err = stat64(path.Data(), &buffer);
-        if (!err)
-        {
-            info.createdDate = convert(&buffer.st_ctim.tv_sec);
-            info.accessDate = convert(&buffer.st_atim.tv_sec);
-        }
+        fill(info, buffer);
     }
 
-    info.editDate = convert(std::filesystem::last_write_time(p));
-
     return info;
 }
 
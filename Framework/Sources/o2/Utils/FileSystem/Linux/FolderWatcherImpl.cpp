@@ -0,0 +1,150 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Utils/FileSystem/FolderWatcher.h"
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace o2
+{
+    namespace
+    {
+        const UInt watchMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB |
+                               IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR;
+
+        void AddWatches(int notifyFd, const FolderInfo& folder, HashMap<int, String>& watchedFolders,
+                        HashMap<String, int>& foldersWatches)
+        {
+            // Adding watch for same folder returns existing descriptor, so it is safe to add it again
+            int wd = inotify_add_watch(notifyFd, folder.path.Data(), watchMask);
+            if (wd >= 0)
+            {
+                watchedFolders[wd] = folder.path;
+                foldersWatches[folder.path] = wd;
+            }
+
+            for (auto& subFolder : folder.folders)
+                AddWatches(notifyFd, subFolder, watchedFolders, foldersWatches);
+        }
+    }
+
+    bool FolderWatcher::InitializeNotifications()
+    {
+        mNotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (mNotifyFd < 0)
+            return false;
+
+        AddWatches(mNotifyFd, mFolderInfo, mWatchedFolders, mFoldersWatches);
+        return true;
+    }
+
+    void FolderWatcher::ReleaseNotifications()
+    {
+        if (mNotifyFd >= 0)
+            close(mNotifyFd);
+
+        mNotifyFd = -1;
+        mWatchedFolders.Clear();
+        mFoldersWatches.Clear();
+    }
+
+    void FolderWatcher::ReadNotifications()
+    {
+        bool overflow = false;
+
+        alignas(inotify_event) char buffer[64*1024];
+        while (true)
+        {
+            ssize_t readBytes = read(mNotifyFd, buffer, sizeof(buffer));
+            if (readBytes <= 0)
+                break;
+
+            for (ssize_t offset = 0; offset < readBytes;)
+            {
+                auto event = (const inotify_event*)(buffer + offset);
+                offset += sizeof(inotify_event) + event->len;
+
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    overflow = true;
+                    continue;
+                }
+
+                String folderPath;
+                if (!mWatchedFolders.TryGetValue(event->wd, folderPath))
+                    continue;
+
+                // Watch is removed by system when folder is deleted or unmounted
+                if (event->mask & IN_IGNORED)
+                {
+                    mWatchedFolders.Remove(event->wd);
+
+                    int wd = -1;
+                    if (mFoldersWatches.TryGetValue(folderPath, wd) && wd == event->wd)
+                        mFoldersWatches.Remove(folderPath);
+
+                    continue;
+                }
+
+                if (event->len == 0)
+                    continue;
+
+                String path = folderPath + "/" + event->name;
+
+                if (event->mask & IN_ISDIR)
+                {
+                    if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                    {
+                        // Folder moved out keeps its watches, they must not report old paths
+                        for (auto it = mFoldersWatches.begin(); it != mFoldersWatches.end();)
+                        {
+                            if (it->first == path || it->first.StartsWith(path + "/"))
+                            {
+                                if (event->mask & IN_MOVED_FROM)
+                                    inotify_rm_watch(mNotifyFd, it->second);
+
+                                mWatchedFolders.Remove(it->second);
+                                it = mFoldersWatches.erase(it);
+                            }
+                            else
+                                ++it;
+                        }
+
+                        OnFolderRemoved(path);
+                    }
+                    else if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                    {
+                        // Watch is added before scanning, so files created while scanning are not lost
+                        int wd = inotify_add_watch(mNotifyFd, path.Data(), watchMask);
+                        if (wd >= 0)
+                        {
+                            mWatchedFolders[wd] = path;
+                            mFoldersWatches[path] = wd;
+                        }
+
+                        if (FolderInfo* folder = OnFolderAdded(path))
+                            AddWatches(mNotifyFd, *folder, mWatchedFolders, mFoldersWatches);
+                    }
+                }
+                else
+                {
+                    if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                        OnFileRemoved(path);
+                    else
+                        OnFileChanged(path);
+                }
+            }
+        }
+
+        // Some events were lost, only full rescan gives actual state
+        if (overflow)
+        {
+            UpdateByRescan();
+            AddWatches(mNotifyFd, mFolderInfo, mWatchedFolders, mFoldersWatches);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,89 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_LINUX
+
+#include "o2/Utils/FileSystem/MappedFile.h"
+#include "o2/Utils/Math/Math.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace o2
+{
+    bool MappedFile::Open(const String& filename, AccessHint hint /*= AccessHint::Sequential*/)
+    {
+        Close();
+
+        int fd = open(filename.Data(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return false;
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        mDataSize = (UInt64)fileStat.st_size;
+
+        // Empty file can't be mapped, but it is valid file with empty data
+        if (mDataSize > 0)
+        {
+            void* data = mmap(nullptr, mDataSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                close(fd);
+                mDataSize = 0;
+                return false;
+            }
+
+            int advice = MADV_NORMAL;
+            if (hint == AccessHint::Sequential)
+                advice = MADV_SEQUENTIAL;
+            else if (hint == AccessHint::Random)
+                advice = MADV_RANDOM;
+
+            madvise(data, mDataSize, advice);
+
+            mData = (const char*)data;
+        }
+        else
+            mData = "";
+
+        // Mapping keeps reference to file, descriptor isn't required anymore
+        close(fd);
+
+        mOpened = true;
+        mFilename = filename;
+
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (mOpened && mDataSize > 0)
+            munmap((void*)mData, mDataSize);
+
+        mData = nullptr;
+        mDataSize = 0;
+        mOpened = false;
+    }
+
+    void MappedFile::Prefetch(UInt64 offset, UInt64 size) const
+    {
+        if (!mOpened || offset >= mDataSize)
+            return;
+
+        static const UInt64 pageSize = (UInt64)sysconf(_SC_PAGESIZE);
+
+        UInt64 begin = offset - offset%pageSize;
+        UInt64 end = Math::Min(offset + size, mDataSize);
+
+        madvise((void*)(mData + begin), end - begin, MADV_WILLNEED);
+    }
+}
+
+#endif
@@ -0,0 +1,76 @@
+#include "o2/stdafx.h"
+#include "MappedFile.h"
+
+namespace o2
+{
+	MappedFile::MappedFile()
+	{}
+
+	MappedFile::MappedFile(const String& filename, AccessHint hint /*= AccessHint::Sequential*/)
+	{
+		Open(filename, hint);
+	}
+
+	MappedFile::MappedFile(MappedFile&& other)
+	{
+		MoveFrom(other);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other)
+	{
+		if (&other != this)
+		{
+			Close();
+			MoveFrom(other);
+		}
+
+		return *this;
+	}
+
+	const char* MappedFile::GetData() const
+	{
+		return mData;
+	}
+
+	UInt64 MappedFile::GetDataSize() const
+	{
+		return mDataSize;
+	}
+
+	bool MappedFile::IsOpened() const
+	{
+		return mOpened;
+	}
+
+	const String& MappedFile::GetFilename() const
+	{
+		return mFilename;
+	}
+
+	void MappedFile::MoveFrom(MappedFile& other)
+	{
+		mFilename = std::move(other.mFilename);
+		mData = other.mData;
+		mDataSize = other.mDataSize;
+		mOpened = other.mOpened;
+
+#if defined(PLATFORM_WINDOWS)
+		mFileHandle = other.mFileHandle;
+		mMappingHandle = other.mMappingHandle;
+		other.mFileHandle = nullptr;
+		other.mMappingHandle = nullptr;
+#elif defined(PLATFORM_ANDROID)
+		mAsset = other.mAsset;
+		other.mAsset = nullptr;
+#endif
+
+		other.mData = nullptr;
+		other.mDataSize = 0;
+		other.mOpened = false;
+	}
+}
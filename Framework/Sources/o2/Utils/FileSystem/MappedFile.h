@@ -0,0 +1,82 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/String.h"
+
+#ifdef PLATFORM_ANDROID
+#include <android/asset_manager.h>
+#endif
+
+namespace o2
+{
+	// ---------------------------------------------------------------------------------------------------
+	// Read-only memory mapped file. File data is mapped into address space and read straight from system
+	// page cache, without copying into own buffers; pages are shared between all processes mapping same
+	// file. Access hint is passed to system to tune read-ahead. Data is valid while file is opened
+	// ---------------------------------------------------------------------------------------------------
+	class MappedFile
+	{
+	public:
+		enum class AccessHint { Normal, Sequential, Random };
+
+	public:
+		// Default constructor
+		MappedFile();
+
+		// Constructor with opening file
+		MappedFile(const String& filename, AccessHint hint = AccessHint::Sequential);
+
+		// Move-constructor
+		MappedFile(MappedFile&& other);
+
+		// Destructor
+		~MappedFile();
+
+		// Move-operator
+		MappedFile& operator=(MappedFile&& other);
+
+		// Opens and maps file
+		bool Open(const String& filename, AccessHint hint = AccessHint::Sequential);
+
+		// Unmaps and closes file
+		void Close();
+
+		// Hints system that range of data will be read soon, so it is read in background
+		void Prefetch(UInt64 offset, UInt64 size) const;
+
+		// Returns mapped data. Data isn't null terminated
+		const char* GetData() const;
+
+		// Returns size of data in bytes
+		UInt64 GetDataSize() const;
+
+		// Returns true, if file was opened
+		bool IsOpened() const;
+
+		// Returns file name
+		const String& GetFilename() const;
+
+	protected:
+		String      mFilename;       // File name
+		const char* mData = nullptr; // Mapped data
+		UInt64      mDataSize = 0;   // Size of mapped data
+		bool        mOpened = false; // True, if file was opened
+
+#if defined(PLATFORM_WINDOWS)
+		void* mFileHandle = nullptr;    // File handle
+		void* mMappingHandle = nullptr; // File mapping handle
+#elif defined(PLATFORM_ANDROID)
+		AAsset* mAsset = nullptr; // Android asset, when file is opened from assets
+#endif
+
+	protected:
+		// Copying is not allowed, mapping is owned by one object
+		MappedFile(const MappedFile& other) = delete;
+
+		// Copying is not allowed, mapping is owned by one object
+		MappedFile& operator=(const MappedFile& other) = delete;
+
+		// Moves mapping from other file
+		void MoveFrom(MappedFile& other);
+	};
+}
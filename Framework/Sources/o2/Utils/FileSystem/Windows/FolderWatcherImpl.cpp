@@ -0,0 +1,25 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_WINDOWS
+
+#include "o2/Utils/FileSystem/FolderWatcher.h"
+
+namespace o2
+{
+	// No change notifications are used here: folder is rescanned on each update and compared with previous state
+
+	bool FolderWatcher::InitializeNotifications()
+	{
+		return true;
+	}
+
+	void FolderWatcher::ReleaseNotifications()
+	{}
+
+	void FolderWatcher::ReadNotifications()
+	{
+		UpdateByRescan();
+	}
+}
+
+#endif
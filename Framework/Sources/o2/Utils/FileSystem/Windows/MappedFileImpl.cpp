@@ -0,0 +1,98 @@
+#include "o2/stdafx.h"
+
+#ifdef PLATFORM_WINDOWS
+
+#include <Windows.h>
+#include "o2/Utils/FileSystem/MappedFile.h"
+#include "o2/Utils/Math/Math.h"
+
+namespace o2
+{
+    bool MappedFile::Open(const String& filename, AccessHint hint /*= AccessHint::Sequential*/)
+    {
+        Close();
+
+        DWORD flags = FILE_ATTRIBUTE_NORMAL;
+        if (hint == AccessHint::Sequential)
+            flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+        else if (hint == AccessHint::Random)
+            flags |= FILE_FLAG_RANDOM_ACCESS;
+
+        HANDLE file = CreateFileA(filename.Data(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, flags, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        mDataSize = (UInt64)size.QuadPart;
+
+        // Empty file can't be mapped, but it is valid file with empty data
+        if (mDataSize > 0)
+        {
+            HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (!mapping)
+            {
+                CloseHandle(file);
+                mDataSize = 0;
+                return false;
+            }
+
+            void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (!data)
+            {
+                CloseHandle(mapping);
+                CloseHandle(file);
+                mDataSize = 0;
+                return false;
+            }
+
+            mMappingHandle = mapping;
+            mData = (const char*)data;
+        }
+        else
+            mData = "";
+
+        mFileHandle = file;
+        mOpened = true;
+        mFilename = filename;
+
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (mOpened && mDataSize > 0)
+            UnmapViewOfFile(mData);
+
+        if (mMappingHandle)
+            CloseHandle((HANDLE)mMappingHandle);
+
+        if (mFileHandle)
+            CloseHandle((HANDLE)mFileHandle);
+
+        mMappingHandle = nullptr;
+        mFileHandle = nullptr;
+        mData = nullptr;
+        mDataSize = 0;
+        mOpened = false;
+    }
+
+    void MappedFile::Prefetch(UInt64 offset, UInt64 size) const
+    {
+        if (!mOpened || offset >= mDataSize)
+            return;
+
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = (PVOID)(mData + offset);
+        range.NumberOfBytes = (SIZE_T)(Math::Min(offset + size, mDataSize) - offset);
+
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+}
+
+#endif
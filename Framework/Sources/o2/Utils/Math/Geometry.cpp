@@ -32,6 +32,17 @@ namespace o2
 			polySize = newPolyCount;
 		}
 
+		TessellatePolyLine(points, pointsCount, verticies, indexes, 0, width, texBorderTop, texBorderBottom, texSize,
+						   invCameraScale);
+
+		vertexCount = newVertexCount;
+		polyCount = (pointsCount - 1)*6;
+	}
+
+	void Geometry::TessellatePolyLine(const Vertex2* points, int pointsCount, Vertex2* verticies, UInt16* indexes,
+									  UInt16 baseIndex, float width, float texBorderTop, float texBorderBottom,
+									  const Vec2F& texSize, const Vec2F& invCameraScale /*= Vec2F(1, 1)*/)
+	{
 		float halfWidth = width*0.5f;
 		float halfWidhtBorderTop = halfWidth + texBorderTop;
 		float halfWidhtBorderBottom = halfWidth + texBorderBottom;
@@ -132,7 +143,8 @@ namespace o2
 			}
 
 #define POLYGON(A, B, C) \
-    indexes[poly] = vertex - A - 1; indexes[poly + 1] = vertex - B - 1; indexes[poly + 2] = vertex - C - 1; poly += 3;
+    indexes[poly] = baseIndex + vertex - A - 1; indexes[poly + 1] = baseIndex + vertex - B - 1; \
+    indexes[poly + 2] = baseIndex + vertex - C - 1; poly += 3;
 
 			if (i > 0)
 			{
@@ -145,7 +157,6 @@ namespace o2
 			}
 		}
 
-		vertexCount = vertex;
-		polyCount = poly/3;
+#undef POLYGON
 	}
 }
@@ -13,5 +13,11 @@ namespace o2
 								UInt16*& indexes, UInt& polyCount, UInt& polySize,
 								float width, float texBorderTop, float texBorderBottom, const Vec2F& texSize,
 								const Vec2F& invCameraScale = Vec2F(1, 1));
+
+		// Tessellates anti-aliased poly line into existing buffers. Vertices buffer must have place for pointsCount*4
+		// vertices, indexes buffer for (pointsCount - 1)*18 indexes. Indexes are offset by baseIndex
+		void TessellatePolyLine(const Vertex2* points, int pointsCount, Vertex2* verticies, UInt16* indexes,
+								UInt16 baseIndex, float width, float texBorderTop, float texBorderBottom,
+								const Vec2F& texSize, const Vec2F& invCameraScale = Vec2F(1, 1));
 	}
 }
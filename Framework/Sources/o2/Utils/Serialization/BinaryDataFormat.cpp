@@ -0,0 +1,248 @@
+#include "o2/stdafx.h"
+#include "BinaryDataFormat.h"
+
+#include "o2/Utils/Serialization/JsonDataFormat.h"
+
+namespace o2
+{
+	static constexpr int maxBinaryDataDepth = 512; // Maximum objects and arrays nesting depth, protects from corrupted data
+
+	// Reads raw bytes and moves cursor. Returns false when data is over
+	static bool ReadBinaryRaw(const char*& cursor, const char* end, void* value, size_t size)
+	{
+		if ((size_t)(end - cursor) < size)
+			return false;
+
+		memcpy(value, cursor, size);
+		cursor += size;
+		return true;
+	}
+
+	// Reads string with length and passes it into handler
+	static bool ReadBinaryString(const char*& cursor, const char* end, JsonDataDocumentParseHandler& handler, bool key)
+	{
+		UInt length;
+		if (!ReadBinaryRaw(cursor, end, &length, sizeof(length)) || (size_t)(end - cursor) < length)
+			return false;
+
+		const char* str = cursor;
+		cursor += length;
+
+		return key ? handler.Key(str, length, true) : handler.String(str, length, true);
+	}
+
+	// Reads value recursively and passes it into handler
+	static bool ReadBinaryValue(const char*& cursor, const char* end, JsonDataDocumentParseHandler& handler, int depth)
+	{
+		typedef BinaryDataWriter::Tag Tag;
+
+		Tag tag;
+		if (!ReadBinaryRaw(cursor, end, &tag, sizeof(tag)))
+			return false;
+
+		switch (tag)
+		{
+		case Tag::Null: return handler.Null();
+		case Tag::False: return handler.Bool(false);
+		case Tag::True: return handler.Bool(true);
+
+		case Tag::Int:
+		{
+			int value;
+			return ReadBinaryRaw(cursor, end, &value, sizeof(value)) && handler.Int(value);
+		}
+
+		case Tag::UInt:
+		{
+			unsigned value;
+			return ReadBinaryRaw(cursor, end, &value, sizeof(value)) && handler.Uint(value);
+		}
+
+		case Tag::Int64:
+		{
+			int64_t value;
+			return ReadBinaryRaw(cursor, end, &value, sizeof(value)) && handler.Int64(value);
+		}
+
+		case Tag::UInt64:
+		{
+			uint64_t value;
+			return ReadBinaryRaw(cursor, end, &value, sizeof(value)) && handler.Uint64(value);
+		}
+
+		case Tag::Double:
+		{
+			double value;
+			return ReadBinaryRaw(cursor, end, &value, sizeof(value)) && handler.Double(value);
+		}
+
+		case Tag::String:
+			return ReadBinaryString(cursor, end, handler, false);
+
+		case Tag::Object:
+		{
+			UInt count;
+			if (depth >= maxBinaryDataDepth || !ReadBinaryRaw(cursor, end, &count, sizeof(count)) || !handler.StartObject())
+				return false;
+
+			for (UInt i = 0; i < count; i++)
+			{
+				if (!ReadBinaryString(cursor, end, handler, true) || !ReadBinaryValue(cursor, end, handler, depth + 1))
+					return false;
+			}
+
+			return handler.EndObject(count);
+		}
+
+		case Tag::Array:
+		{
+			UInt count;
+			if (depth >= maxBinaryDataDepth || !ReadBinaryRaw(cursor, end, &count, sizeof(count)) || !handler.StartArray())
+				return false;
+
+			for (UInt i = 0; i < count; i++)
+			{
+				if (!ReadBinaryValue(cursor, end, handler, depth + 1))
+					return false;
+			}
+
+			return handler.EndArray(count);
+		}
+		}
+
+		return false;
+	}
+
+	bool ParseBinary(const char* data, size_t length, DataDocument& document)
+	{
+		JsonDataDocumentParseHandler handler(document);
+		const char* cursor = data;
+		if (ReadBinaryValue(cursor, data + length, handler, 0))
+		{
+			(DataValue&)document = std::move(*handler.stack.Pop<DataValue>());
+			return true;
+		}
+
+		return false;
+	}
+
+	void WriteBinary(String& str, const DataDocument& document)
+	{
+		str.clear();
+		BinaryDataWriter writer(str);
+		document.Write(writer);
+	}
+
+	BinaryDataWriter::BinaryDataWriter(o2::String& buffer):
+		buffer(buffer)
+	{}
+
+	bool BinaryDataWriter::Null()
+	{
+		WriteTag(Tag::Null);
+		return true;
+	}
+
+	bool BinaryDataWriter::Bool(bool value)
+	{
+		WriteTag(value ? Tag::True : Tag::False);
+		return true;
+	}
+
+	bool BinaryDataWriter::Int(int value)
+	{
+		WriteTag(Tag::Int);
+		WriteRaw(&value, sizeof(value));
+		return true;
+	}
+
+	bool BinaryDataWriter::Uint(unsigned value)
+	{
+		WriteTag(Tag::UInt);
+		WriteRaw(&value, sizeof(value));
+		return true;
+	}
+
+	bool BinaryDataWriter::Int64(int64_t value)
+	{
+		WriteTag(Tag::Int64);
+		WriteRaw(&value, sizeof(value));
+		return true;
+	}
+
+	bool BinaryDataWriter::Uint64(uint64_t value)
+	{
+		WriteTag(Tag::UInt64);
+		WriteRaw(&value, sizeof(value));
+		return true;
+	}
+
+	bool BinaryDataWriter::Double(double value)
+	{
+		WriteTag(Tag::Double);
+		WriteRaw(&value, sizeof(value));
+		return true;
+	}
+
+	bool BinaryDataWriter::String(const char* str, unsigned length, bool copy)
+	{
+		WriteTag(Tag::String);
+		return Key(str, length, copy);
+	}
+
+	bool BinaryDataWriter::StartObject()
+	{
+		StartContainer(Tag::Object);
+		return true;
+	}
+
+	bool BinaryDataWriter::Key(const char* str, unsigned length, bool copy)
+	{
+		WriteRaw(&length, sizeof(length));
+		WriteRaw(str, length);
+		return true;
+	}
+
+	bool BinaryDataWriter::EndObject(unsigned memberCount)
+	{
+		EndContainer(memberCount);
+		return true;
+	}
+
+	bool BinaryDataWriter::StartArray()
+	{
+		StartContainer(Tag::Array);
+		return true;
+	}
+
+	bool BinaryDataWriter::EndArray(unsigned elementCount)
+	{
+		EndContainer(elementCount);
+		return true;
+	}
+
+	void BinaryDataWriter::WriteTag(Tag tag)
+	{
+		buffer.push_back((char)tag);
+	}
+
+	void BinaryDataWriter::WriteRaw(const void* data, size_t size)
+	{
+		buffer.append((const char*)data, size);
+	}
+
+	void BinaryDataWriter::StartContainer(Tag tag)
+	{
+		WriteTag(tag);
+		mCountsOffsets.Add(buffer.size());
+
+		UInt count = 0;
+		WriteRaw(&count, sizeof(count));
+	}
+
+	void BinaryDataWriter::EndContainer(UInt count)
+	{
+		size_t offset = mCountsOffsets.PopBack();
+		memcpy(&buffer[offset], &count, sizeof(count));
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "DataValue.h"
+
+namespace o2
+{
+	// Parses binary document from memory buffer with specified length. Strings are copied, so buffer can be released after parsing
+	bool ParseBinary(const char* data, size_t length, DataDocument& document);
+
+	// Writes data into binary string
+	void WriteBinary(String& str, const DataDocument& document);
+
+	// -----------------------------------------------------------------------------------------------------------------
+	// Binary data document writer. Each value is written as type tag and value in native byte order. Objects and arrays
+	// are written with elements count, strings and keys with length. No text conversions, so reading is just copying
+	// -----------------------------------------------------------------------------------------------------------------
+	class BinaryDataWriter
+	{
+	public:
+		// ----------
+		// Values tag
+		// ----------
+		enum class Tag : UInt8 { Null, False, True, Int, UInt, Int64, UInt64, Double, String, Object, Array };
+
+	public:
+		o2::String& buffer; // Output buffer
+
+	public:
+		// Constructor, output is appended to buffer
+		BinaryDataWriter(o2::String& buffer);
+
+		bool Null();
+		bool Bool(bool value);
+		bool Int(int value);
+		bool Uint(unsigned value);
+		bool Int64(int64_t value);
+		bool Uint64(uint64_t value);
+		bool Double(double value);
+		bool String(const char* str, unsigned length, bool copy);
+		bool StartObject();
+		bool Key(const char* str, unsigned length, bool copy);
+		bool EndObject(unsigned memberCount);
+		bool StartArray();
+		bool EndArray(unsigned elementCount);
+
+	protected:
+		Vector<size_t> mCountsOffsets; // Buffer offsets of not finished objects and arrays counts
+
+	protected:
+		// Writes tag
+		void WriteTag(Tag tag);
+
+		// Writes raw bytes
+		void WriteRaw(const void* data, size_t size);
+
+		// Writes elements count placeholder after tag, it is filled on object or array end
+		void StartContainer(Tag tag);
+
+		// Fills elements count of last started object or array
+		void EndContainer(UInt count);
+	};
+}
@@ -2,6 +2,7 @@
 #include "DataValue.h"
 
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Serialization/BinaryDataFormat.h"
 #include "o2/Utils/Serialization/JsonDataFormat.h"
 
 #include "rapidjson/document.h"
@@ -825,16 +826,15 @@ namespace o2
 
 	bool DataDocument::LoadFromFile(const String& fileName, Format format /*= Format::JSON*/)
 	{
-		InFile file(fileName);
+		MappedFile file(fileName);
 		if (!file.IsOpened())
 			return false;
 
-		auto size = file.GetDataSize();
-		char* data = (char*)mAllocator.Allocate(size);
-		file.ReadData(data, size);
-
 		if (format == Format::JSON)
-			return ParseJsonInplace(data, *this);
+			return ParseJson(file.GetData(), (size_t)file.GetDataSize(), *this);
+
+		if (format == Format::Binary)
+			return ParseBinary(file.GetData(), (size_t)file.GetDataSize(), *this);
 
 		return false;
 	}
@@ -844,6 +844,9 @@ namespace o2
 		if (format == Format::JSON)
 			return ParseJson(data.Data(), *this);
 
+		if (format == Format::Binary)
+			return ParseBinary(data.Data(), data.Length(), *this);
+
 		return false;
 	}
 
@@ -869,6 +872,13 @@ namespace o2
 			return buf;
 		}
 
+		if (format == Format::Binary)
+		{
+			String buf;
+			WriteBinary(buf, *this);
+			return buf;
+		}
+
 		return "";
 		//return XmlDataFormat::SaveDataDoc(*this);
 	}
@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "JsonDataFormat.h"
 
+#include "rapidjson/memorystream.h"
 #include "rapidjson/reader.h"
 #include "rapidjson/writer.h"
 #include "rapidjson/prettywriter.h"
@@ -37,6 +38,21 @@ namespace o2
 		return false;
 	}
 
+	bool ParseJson(const char* data, size_t length, DataDocument& document)
+	{
+		JsonDataDocumentParseHandler handler(document);
+		rapidjson::Reader reader;
+		rapidjson::MemoryStream stream(data, length);
+		auto result = reader.Parse<rapidjson::kParseStopWhenDoneFlag>(stream, handler);
+		if (!result.IsError())
+		{
+			(DataValue&)document = std::move(*handler.stack.Pop<DataValue>());
+			return true;
+		}
+
+		return false;
+	}
+
 	void WriteJson(String& str, const DataDocument& document)
 	{
 		rapidjson::StringBuffer buffer;
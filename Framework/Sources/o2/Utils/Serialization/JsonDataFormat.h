@@ -10,6 +10,9 @@ namespace o2
 	// Parses json document into DataDocumen
 	bool ParseJson(const char* str, DataDocument& document);
 
+	// Parses json document from memory buffer with specified length, buffer may be not null terminated. Strings are copied
+	bool ParseJson(const char* data, size_t length, DataDocument& document);
+
 	// Writes data into json string
 	void WriteJson(String& str, const DataDocument& document);
 
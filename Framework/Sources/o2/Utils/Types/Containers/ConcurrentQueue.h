@@ -0,0 +1,180 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace o2
+{
+	// ---------------------------------------------------------------------------------------------
+	// Bounded lock-free queue for many producers and one consumer. Based on ring buffer of cells with
+	// sequence counters: producers reserve cell by atomic increment of enqueue position, consumer
+	// takes cells in order. Values can be pushed from any thread, popped only from consumer thread
+	// ---------------------------------------------------------------------------------------------
+	template<typename _type>
+	class ConcurrentQueue
+	{
+	public:
+		// Constructor with capacity. Capacity is rounded up to power of two
+		explicit ConcurrentQueue(int capacity = 1024);
+
+		// Destructor
+		~ConcurrentQueue();
+
+		// Pushes value into queue. Returns false when queue is full. Can be called from any thread
+		bool TryPush(_type&& value);
+
+		// Pushes value copy into queue. Returns false when queue is full. Can be called from any thread
+		bool TryPush(const _type& value);
+
+		// Pops value from queue. Returns false when queue is empty. Must be called from consumer thread
+		bool TryPop(_type& value);
+
+		// Returns approximate count of values in queue
+		int GetApproxCount() const;
+
+		// Returns capacity of queue
+		int GetCapacity() const;
+
+		// Returns true when queue looks empty
+		bool IsEmpty() const;
+
+	protected:
+		static constexpr size_t mCacheLineSize = 64;
+
+		struct Cell
+		{
+			std::atomic<size_t> sequence; // Cell sequence. Equals position when cell is free, position + 1 when filled
+			_type               value;    // Stored value
+		};
+
+	protected:
+		Cell*  mCells;    // Ring buffer of cells
+		size_t mCapacity; // Count of cells, power of two
+		size_t mMask;     // Position mask, capacity - 1
+
+		alignas(mCacheLineSize) std::atomic<size_t> mEnqueuePos; // Next producer position
+		alignas(mCacheLineSize) std::atomic<size_t> mDequeuePos; // Next consumer position
+
+	protected:
+		// Reserves cell for pushing. Returns null when queue is full
+		Cell* ReserveCell(size_t& pos);
+
+		// Copying is not available
+		ConcurrentQueue(const ConcurrentQueue& other) = delete;
+
+		// Copying is not available
+		ConcurrentQueue& operator=(const ConcurrentQueue& other) = delete;
+	};
+
+	template<typename _type>
+	ConcurrentQueue<_type>::ConcurrentQueue(int capacity /*= 1024*/):
+		mEnqueuePos(0), mDequeuePos(0)
+	{
+		mCapacity = 2;
+		while (mCapacity < (size_t)capacity)
+			mCapacity <<= 1;
+
+		mMask = mCapacity - 1;
+		mCells = new Cell[mCapacity];
+
+		for (size_t i = 0; i < mCapacity; i++)
+			mCells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	template<typename _type>
+	ConcurrentQueue<_type>::~ConcurrentQueue()
+	{
+		delete[] mCells;
+	}
+
+	template<typename _type>
+	typename ConcurrentQueue<_type>::Cell* ConcurrentQueue<_type>::ReserveCell(size_t& pos)
+	{
+		pos = mEnqueuePos.load(std::memory_order_relaxed);
+		while (true)
+		{
+			Cell* cell = &mCells[pos & mMask];
+			size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+
+			if (diff == 0)
+			{
+				if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					return cell;
+			}
+			else if (diff < 0)
+				return nullptr;
+			else
+				pos = mEnqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	template<typename _type>
+	bool ConcurrentQueue<_type>::TryPush(_type&& value)
+	{
+		size_t pos;
+		Cell* cell = ReserveCell(pos);
+		if (!cell)
+			return false;
+
+		cell->value = std::move(value);
+		cell->sequence.store(pos + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	template<typename _type>
+	bool ConcurrentQueue<_type>::TryPush(const _type& value)
+	{
+		size_t pos;
+		Cell* cell = ReserveCell(pos);
+		if (!cell)
+			return false;
+
+		cell->value = value;
+		cell->sequence.store(pos + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	template<typename _type>
+	bool ConcurrentQueue<_type>::TryPop(_type& value)
+	{
+		size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+		Cell* cell = &mCells[pos & mMask];
+		size_t sequence = cell->sequence.load(std::memory_order_acquire);
+
+		if ((intptr_t)sequence - (intptr_t)(pos + 1) < 0)
+			return false;
+
+		mDequeuePos.store(pos + 1, std::memory_order_relaxed);
+
+		value = std::move(cell->value);
+		cell->sequence.store(pos + mCapacity, std::memory_order_release);
+
+		return true;
+	}
+
+	template<typename _type>
+	int ConcurrentQueue<_type>::GetApproxCount() const
+	{
+		size_t enqueuePos = mEnqueuePos.load(std::memory_order_relaxed);
+		size_t dequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+
+		return enqueuePos > dequeuePos ? (int)(enqueuePos - dequeuePos) : 0;
+	}
+
+	template<typename _type>
+	int ConcurrentQueue<_type>::GetCapacity() const
+	{
+		return (int)mCapacity;
+	}
+
+	template<typename _type>
+	bool ConcurrentQueue<_type>::IsEmpty() const
+	{
+		return GetApproxCount() == 0;
+	}
+}
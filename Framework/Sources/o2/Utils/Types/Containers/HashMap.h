@@ -0,0 +1,258 @@
+#pragma once
+
+#include "o2/Utils/Delegates.h"
+#include "o2/Utils/Types/Containers/HashTable.h"
+
+namespace o2
+{
+	// ---------------------------------------------
+	// Returns key of hash dictionary key-value pair
+	// ---------------------------------------------
+	struct HashMapKeyGetter
+	{
+		template<typename _pair_type>
+		static const typename _pair_type::first_type& Get(const _pair_type& pair) { return pair.first; }
+	};
+
+	// ---------------------------------------------------------------------------------------------------
+	// Hash dictionary with open addressing. Has same interface as Map, but elements aren't sorted by keys:
+	// they are iterated in order of adding until removal, which moves last element into removed place.
+	// Adding and removing elements invalidates iterators and references
+	// ---------------------------------------------------------------------------------------------------
+	template<typename _key_type, typename _value_type, typename _hasher = std::hash<_key_type>>
+	class HashMap: public HashTable<std::pair<_key_type, _value_type>, _key_type, _hasher, HashMapKeyGetter>
+	{
+		using super = HashTable<std::pair<_key_type, _value_type>, _key_type, _hasher, HashMapKeyGetter>;
+
+	public:
+		using KeyValuePair = std::pair<_key_type, _value_type>;
+		using Iterator = typename super::Iterator;
+		using ConstIterator = typename super::ConstIterator;
+
+	public:
+		// Default constructor
+		HashMap();
+
+		// Constructor from initializer list
+		HashMap(std::initializer_list<KeyValuePair> init);
+
+		// Check equals operator
+		bool operator==(const HashMap& other) const;
+
+		// Check not equals operator
+		bool operator!=(const HashMap& other) const;
+
+		// Returns value reference by key, adds default value when not found
+		_value_type& operator[](const _key_type& key);
+
+		// Adds element. Doesn't replace value when key already exists
+		void Add(const _key_type& key, const _value_type& value);
+
+		// Adds element. Doesn't replace value when key already exists
+		void Add(const KeyValuePair& keyValue);
+
+		// Adds elements from other dictionary
+		void Add(const HashMap& other);
+
+		// Removes element by key
+		void Remove(const _key_type& key);
+
+		// Removes all which pass function
+		void RemoveAll(const Function<bool(const _key_type&, const _value_type&)>& match);
+
+		// Returns true if contains element with specified key
+		bool ContainsKey(const _key_type& key) const;
+
+		// Returns true if contains element with specified value
+		bool ContainsValue(const _value_type& value) const;
+
+		// Sets value by key
+		void Set(const _key_type& key, const _value_type& value);
+
+		// Returns value reference by key
+		_value_type& Get(const _key_type& key);
+
+		// Returns constant value reference by key
+		const _value_type& Get(const _key_type& key) const;
+
+		// Tries to get value by key, returns true if found
+		bool TryGetValue(const _key_type& key, _value_type& output) const;
+
+		// Returns pointer to value by key or null
+		_value_type* TryGetValuePtr(const _key_type& key);
+
+		// Returns constant pointer to value by key or null
+		const _value_type* TryGetValuePtr(const _key_type& key) const;
+
+		// Invokes function for all elements
+		void ForEach(const Function<void(const _key_type&, _value_type&)>& func);
+	};
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashMap<_key_type, _value_type, _hasher>::HashMap()
+	{}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	HashMap<_key_type, _value_type, _hasher>::HashMap(std::initializer_list<KeyValuePair> init)
+	{
+		super::Reserve((int)init.size());
+
+		for (auto& kv : init)
+			Add(kv);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashMap<_key_type, _value_type, _hasher>::operator==(const HashMap& other) const
+	{
+		if (super::Count() != other.Count())
+			return false;
+
+		for (auto& kv : super::mEntries)
+		{
+			auto value = other.TryGetValuePtr(kv.first);
+			if (!value || !(*value == kv.second))
+				return false;
+		}
+
+		return true;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashMap<_key_type, _value_type, _hasher>::operator!=(const HashMap& other) const
+	{
+		return !(*this == other);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	_value_type& HashMap<_key_type, _value_type, _hasher>::operator[](const _key_type& key)
+	{
+		UInt hash = super::GetHash(key);
+		int idx = super::IndexOf(key, hash);
+		if (idx < 0)
+			idx = super::AddEntry(KeyValuePair(key, _value_type()), hash);
+
+		return super::mEntries[idx].second;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashMap<_key_type, _value_type, _hasher>::Add(const _key_type& key, const _value_type& value)
+	{
+		UInt hash = super::GetHash(key);
+		if (super::IndexOf(key, hash) < 0)
+			super::AddEntry(KeyValuePair(key, value), hash);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashMap<_key_type, _value_type, _hasher>::Add(const KeyValuePair& keyValue)
+	{
+		Add(keyValue.first, keyValue.second);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashMap<_key_type, _value_type, _hasher>::Add(const HashMap& other)
+	{
+		for (auto& kv : other)
+			Add(kv.first, kv.second);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashMap<_key_type, _value_type, _hasher>::Remove(const _key_type& key)
+	{
+		int idx = super::IndexOf(key, super::GetHash(key));
+		if (idx >= 0)
+			super::RemoveEntry(idx);
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashMap<_key_type, _value_type, _hasher>::RemoveAll(const Function<bool(const _key_type&, const _value_type&)>& match)
+	{
+		for (int i = 0; i < super::mEntries.Count();)
+		{
+			if (match(super::mEntries[i].first, super::mEntries[i].second))
+				super::RemoveEntry(i);
+			else
+				i++;
+		}
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashMap<_key_type, _value_type, _hasher>::ContainsKey(const _key_type& key) const
+	{
+		return super::IndexOf(key, super::GetHash(key)) >= 0;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashMap<_key_type, _value_type, _hasher>::ContainsValue(const _value_type& value) const
+	{
+		for (auto& kv : super::mEntries)
+		{
+			if (kv.second == value)
+				return true;
+		}
+
+		return false;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashMap<_key_type, _value_type, _hasher>::Set(const _key_type& key, const _value_type& value)
+	{
+		(*this)[key] = value;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	_value_type& HashMap<_key_type, _value_type, _hasher>::Get(const _key_type& key)
+	{
+		if (auto value = TryGetValuePtr(key))
+			return *value;
+
+		Assert(false, "Failed to get value from dictionary: not found key");
+
+		static _value_type fake;
+		return fake;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	const _value_type& HashMap<_key_type, _value_type, _hasher>::Get(const _key_type& key) const
+	{
+		if (auto value = TryGetValuePtr(key))
+			return *value;
+
+		Assert(false, "Failed to get value from dictionary: not found key");
+
+		static _value_type fake;
+		return fake;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	bool HashMap<_key_type, _value_type, _hasher>::TryGetValue(const _key_type& key, _value_type& output) const
+	{
+		if (auto value = TryGetValuePtr(key))
+		{
+			output = *value;
+			return true;
+		}
+
+		return false;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	_value_type* HashMap<_key_type, _value_type, _hasher>::TryGetValuePtr(const _key_type& key)
+	{
+		int idx = super::IndexOf(key, super::GetHash(key));
+		return idx < 0 ? nullptr : &super::mEntries[idx].second;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	const _value_type* HashMap<_key_type, _value_type, _hasher>::TryGetValuePtr(const _key_type& key) const
+	{
+		int idx = super::IndexOf(key, super::GetHash(key));
+		return idx < 0 ? nullptr : &super::mEntries[idx].second;
+	}
+
+	template<typename _key_type, typename _value_type, typename _hasher>
+	void HashMap<_key_type, _value_type, _hasher>::ForEach(const Function<void(const _key_type&, _value_type&)>& func)
+	{
+		for (auto& kv : super::mEntries)
+			func(kv.first, kv.second);
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "o2/Utils/Types/Containers/HashTable.h"
+
+namespace o2
+{
+	// -------------------------------
+	// Returns key of hash set element
+	// -------------------------------
+	struct HashSetKeyGetter
+	{
+		template<typename _type>
+		static const _type& Get(const _type& value) { return value; }
+	};
+
+	// --------------------------------------------------------------------------------------------
+	// Hash set with open addressing. Elements are iterated in order of adding until removal, which
+	// moves last element into removed place. Adding and removing elements invalidates iterators
+	// --------------------------------------------------------------------------------------------
+	template<typename _type, typename _hasher = std::hash<_type>>
+	class HashSet: public HashTable<_type, _type, _hasher, HashSetKeyGetter>
+	{
+		using super = HashTable<_type, _type, _hasher, HashSetKeyGetter>;
+
+	public:
+		// Default constructor
+		HashSet();
+
+		// Constructor from initializer list
+		HashSet(std::initializer_list<_type> init);
+
+		// Check equals operator
+		bool operator==(const HashSet& other) const;
+
+		// Check not equals operator
+		bool operator!=(const HashSet& other) const;
+
+		// Adds element. Returns false when element already exists
+		bool Add(const _type& value);
+
+		// Adds elements from range
+		template<typename _iterator_type>
+		void Add(_iterator_type begin, _iterator_type end);
+
+		// Removes element. Returns false when element not found
+		bool Remove(const _type& value);
+
+		// Returns true if contains element
+		bool Contains(const _type& value) const;
+	};
+
+	template<typename _type, typename _hasher>
+	HashSet<_type, _hasher>::HashSet()
+	{}
+
+	template<typename _type, typename _hasher>
+	HashSet<_type, _hasher>::HashSet(std::initializer_list<_type> init)
+	{
+		super::Reserve((int)init.size());
+		Add(init.begin(), init.end());
+	}
+
+	template<typename _type, typename _hasher>
+	bool HashSet<_type, _hasher>::operator==(const HashSet& other) const
+	{
+		if (super::Count() != other.Count())
+			return false;
+
+		for (auto& value : super::mEntries)
+		{
+			if (!other.Contains(value))
+				return false;
+		}
+
+		return true;
+	}
+
+	template<typename _type, typename _hasher>
+	bool HashSet<_type, _hasher>::operator!=(const HashSet& other) const
+	{
+		return !(*this == other);
+	}
+
+	template<typename _type, typename _hasher>
+	bool HashSet<_type, _hasher>::Add(const _type& value)
+	{
+		UInt hash = super::GetHash(value);
+		if (super::IndexOf(value, hash) >= 0)
+			return false;
+
+		super::AddEntry(_type(value), hash);
+		return true;
+	}
+
+	template<typename _type, typename _hasher>
+	template<typename _iterator_type>
+	void HashSet<_type, _hasher>::Add(_iterator_type begin, _iterator_type end)
+	{
+		for (auto it = begin; it != end; ++it)
+			Add(*it);
+	}
+
+	template<typename _type, typename _hasher>
+	bool HashSet<_type, _hasher>::Remove(const _type& value)
+	{
+		int idx = super::IndexOf(value, super::GetHash(value));
+		if (idx < 0)
+			return false;
+
+		super::RemoveEntry(idx);
+		return true;
+	}
+
+	template<typename _type, typename _hasher>
+	bool HashSet<_type, _hasher>::Contains(const _type& value) const
+	{
+		return super::IndexOf(value, super::GetHash(value)) >= 0;
+	}
+}
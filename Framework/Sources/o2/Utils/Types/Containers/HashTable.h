@@ -0,0 +1,289 @@
+#pragma once
+
+#include "o2/Utils/Debug/Assert.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+#include <functional>
+#include <utility>
+
+namespace o2
+{
+	// ----------------------------------------------------------------------------------------------------
+	// Open addressing hash table, base of HashMap and HashSet. Entries are stored densely, so iteration
+	// goes through continuous memory. Lookup table keeps hashes and entries indices and is probed linearly,
+	// removed slots are closed by shifting next slots back. Removing entry moves last entry into its place.
+	// Iterators, pointers and references are invalidated by adding and removing
+	// ----------------------------------------------------------------------------------------------------
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	class HashTable
+	{
+	public:
+		using Iterator = typename Vector<_entry_type>::iterator;
+		using ConstIterator = typename Vector<_entry_type>::const_iterator;
+
+		using iterator = Iterator;
+		using const_iterator = ConstIterator;
+
+	public:
+		// Returns count of elements
+		int Count() const;
+
+		// Returns true when no elements
+		bool IsEmpty() const;
+
+		// Removes all elements, keeps allocated memory
+		void Clear();
+
+		// Reserves memory for count elements
+		void Reserve(int count);
+
+		// Returns begin iterator
+		Iterator Begin() { return mEntries.begin(); }
+
+		// Returns end iterator
+		Iterator End() { return mEntries.end(); }
+
+		// Returns constant begin iterator
+		ConstIterator Begin() const { return mEntries.cbegin(); }
+
+		// Returns constant end iterator
+		ConstIterator End() const { return mEntries.cend(); }
+
+		// Returns begin iterator. Used by range for
+		Iterator begin() { return mEntries.begin(); }
+
+		// Returns end iterator. Used by range for
+		Iterator end() { return mEntries.end(); }
+
+		// Returns constant begin iterator. Used by range for
+		ConstIterator begin() const { return mEntries.cbegin(); }
+
+		// Returns constant end iterator. Used by range for
+		ConstIterator end() const { return mEntries.cend(); }
+
+		// Returns iterator of element with key or end
+		Iterator find(const _key_type& key);
+
+		// Returns constant iterator of element with key or end
+		ConstIterator find(const _key_type& key) const;
+
+		// Removes element by iterator. Returns iterator to element moved into its place, so removing in loop
+		// visits all elements
+		Iterator erase(ConstIterator it);
+
+		// Exchanges elements with other table
+		void swap(HashTable& other);
+
+	protected:
+		// ------------------------------------------------
+		// Lookup table slot: hash and index of entry or -1
+		// ------------------------------------------------
+		struct Slot
+		{
+			UInt hash = 0;   // Mixed hash of entry key
+			int  index = -1; // Index of entry, -1 when slot is empty
+		};
+
+	protected:
+		Vector<_entry_type> mEntries;  // Entries, densely stored
+		Vector<UInt>        mHashes;   // Hashes of entries
+		Vector<Slot>        mSlots;    // Lookup table, power of two size
+		UInt                mMask = 0; // Lookup table size - 1
+
+	protected:
+		// Returns mixed hash of key. Mixing spreads hashes of integers and pointers over lookup table
+		static UInt GetHash(const _key_type& key);
+
+		// Returns index of entry with key or -1
+		int IndexOf(const _key_type& key, UInt hash) const;
+
+		// Returns index of slot, which is pointing to entry
+		int SlotOf(int entryIdx) const;
+
+		// Adds entry with hash, doesn't check key. Returns entry index
+		int AddEntry(_entry_type&& entry, UInt hash);
+
+		// Removes entry by index
+		void RemoveEntry(int entryIdx);
+
+		// Rebuilds lookup table with size
+		void Rehash(int slotsCount);
+	};
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	int HashTable<_entry_type, _key_type, _hasher, _key_getter>::Count() const
+	{
+		return mEntries.Count();
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	bool HashTable<_entry_type, _key_type, _hasher, _key_getter>::IsEmpty() const
+	{
+		return mEntries.IsEmpty();
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	void HashTable<_entry_type, _key_type, _hasher, _key_getter>::Clear()
+	{
+		mEntries.Clear();
+		mHashes.Clear();
+
+		for (auto& slot : mSlots)
+			slot.index = -1;
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	void HashTable<_entry_type, _key_type, _hasher, _key_getter>::Reserve(int count)
+	{
+		mEntries.Reserve(count);
+		mHashes.Reserve(count);
+
+		int slotsCount = Math::Max(mSlots.Count(), 16);
+		while (count*4 > slotsCount*3)
+			slotsCount *= 2;
+
+		if (slotsCount != mSlots.Count())
+			Rehash(slotsCount);
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	typename HashTable<_entry_type, _key_type, _hasher, _key_getter>::Iterator
+	HashTable<_entry_type, _key_type, _hasher, _key_getter>::find(const _key_type& key)
+	{
+		int idx = IndexOf(key, GetHash(key));
+		return idx < 0 ? mEntries.end() : mEntries.begin() + idx;
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	typename HashTable<_entry_type, _key_type, _hasher, _key_getter>::ConstIterator
+	HashTable<_entry_type, _key_type, _hasher, _key_getter>::find(const _key_type& key) const
+	{
+		int idx = IndexOf(key, GetHash(key));
+		return idx < 0 ? mEntries.cend() : mEntries.cbegin() + idx;
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	typename HashTable<_entry_type, _key_type, _hasher, _key_getter>::Iterator
+	HashTable<_entry_type, _key_type, _hasher, _key_getter>::erase(ConstIterator it)
+	{
+		int idx = (int)(it - mEntries.cbegin());
+		RemoveEntry(idx);
+		return mEntries.begin() + idx;
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	void HashTable<_entry_type, _key_type, _hasher, _key_getter>::swap(HashTable& other)
+	{
+		mEntries.swap(other.mEntries);
+		mHashes.swap(other.mHashes);
+		mSlots.swap(other.mSlots);
+		std::swap(mMask, other.mMask);
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	UInt HashTable<_entry_type, _key_type, _hasher, _key_getter>::GetHash(const _key_type& key)
+	{
+		UInt64 hash = (UInt64)_hasher()(key);
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdULL;
+		hash ^= hash >> 33;
+
+		return (UInt)hash;
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	int HashTable<_entry_type, _key_type, _hasher, _key_getter>::IndexOf(const _key_type& key, UInt hash) const
+	{
+		if (mSlots.IsEmpty())
+			return -1;
+
+		for (UInt i = hash & mMask; ; i = (i + 1) & mMask)
+		{
+			const Slot& slot = mSlots[i];
+			if (slot.index < 0)
+				return -1;
+
+			if (slot.hash == hash && _key_getter::Get(mEntries[slot.index]) == key)
+				return slot.index;
+		}
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	int HashTable<_entry_type, _key_type, _hasher, _key_getter>::SlotOf(int entryIdx) const
+	{
+		for (UInt i = mHashes[entryIdx] & mMask; ; i = (i + 1) & mMask)
+		{
+			if (mSlots[i].index == entryIdx)
+				return (int)i;
+		}
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	int HashTable<_entry_type, _key_type, _hasher, _key_getter>::AddEntry(_entry_type&& entry, UInt hash)
+	{
+		// Keeping load factor under 3/4, so probing sequences stay short and always reach empty slot
+		if ((mEntries.Count() + 1)*4 > mSlots.Count()*3)
+			Rehash(Math::Max(mSlots.Count()*2, 16));
+
+		int idx = mEntries.Count();
+		mEntries.Add(std::move(entry));
+		mHashes.Add(hash);
+
+		UInt i = hash & mMask;
+		while (mSlots[i].index >= 0)
+			i = (i + 1) & mMask;
+
+		mSlots[i].hash = hash;
+		mSlots[i].index = idx;
+
+		return idx;
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	void HashTable<_entry_type, _key_type, _hasher, _key_getter>::RemoveEntry(int entryIdx)
+	{
+		// Closing removed slot: shifting back next slots, which can't be found after empty slot
+		UInt i = (UInt)SlotOf(entryIdx);
+		for (UInt j = (i + 1) & mMask; mSlots[j].index >= 0; j = (j + 1) & mMask)
+		{
+			UInt home = mSlots[j].hash & mMask;
+			if (((j - home) & mMask) >= ((j - i) & mMask))
+			{
+				mSlots[i] = mSlots[j];
+				i = j;
+			}
+		}
+
+		mSlots[i].index = -1;
+
+		int lastIdx = mEntries.Count() - 1;
+		if (entryIdx != lastIdx)
+		{
+			mSlots[SlotOf(lastIdx)].index = entryIdx;
+			mEntries[entryIdx] = std::move(mEntries[lastIdx]);
+			mHashes[entryIdx] = mHashes[lastIdx];
+		}
+
+		mEntries.pop_back();
+		mHashes.pop_back();
+	}
+
+	template<typename _entry_type, typename _key_type, typename _hasher, typename _key_getter>
+	void HashTable<_entry_type, _key_type, _hasher, _key_getter>::Rehash(int slotsCount)
+	{
+		mSlots.Clear();
+		mSlots.Resize(slotsCount);
+		mMask = (UInt)slotsCount - 1;
+
+		for (int idx = 0; idx < mHashes.Count(); idx++)
+		{
+			UInt i = mHashes[idx] & mMask;
+			while (mSlots[i].index >= 0)
+				i = (i + 1) & mMask;
+
+			mSlots[i].hash = mHashes[idx];
+			mSlots[i].index = idx;
+		}
+	}
+}
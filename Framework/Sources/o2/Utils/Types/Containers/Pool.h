@@ -4,20 +4,23 @@
 
 namespace o2
 {
-	// ----------------------
-	// Pool objects container
-	// ----------------------
+	// ---------------------------------------------------------------------------------------------------------
+	// Pool objects container. Objects are constructed by slabs - contiguous arrays of chunk size, and reused by
+	// Take and Free without allocations. Pool owns all objects, taken objects must be freed and never deleted
+	// ---------------------------------------------------------------------------------------------------------
 	template<typename _type>
 	class Pool
 	{
 		Vector<_type*> mObjects;   // Cached objects
+		Vector<_type*> mSlabs;     // Objects slabs, each one is contiguous array
+		Vector<int>    mSlabSizes; // Objects count in each slab
 		int            mChunkSize; // Cache resize size
 
 	public:
 		// Constructor
 		Pool(int initialCount = 5, int chunkSize = 5);
 
-		// Destructor
+		// Destructor. Destroys all objects, taken too
 		~Pool();
 
 		// Sets chunk size - cache resize size
@@ -32,8 +35,17 @@ namespace o2
 		// Frees object and puts into cached
 		void Free(_type* obj);
 
-		// Creates cached object
+		// Creates cached objects slab
 		void CreateObjects(int count);
+
+		// Returns cached objects count
+		int GetFreeCount() const;
+
+		// Returns all created objects count
+		int GetCapacity() const;
+
+		// Returns true when object is from this pool
+		bool IsOwned(const _type* obj) const;
 	};
 
 
@@ -47,9 +59,11 @@ namespace o2
 	template<typename _type>
 	Pool<_type>::~Pool()
 	{
-		for (int i = 0; i < mObjects.Count(); i++)
-			delete mObjects[i];
+		for (int i = 0; i < mSlabs.Count(); i++)
+			delete[] mSlabs[i];
 
+		mSlabs.Clear();
+		mSlabSizes.Clear();
 		mObjects.Clear();
 	}
 
@@ -69,7 +83,7 @@ namespace o2
 	_type* Pool<_type>::Take()
 	{
 		if (mObjects.Count() == 0)
-			CreateObjects(mChunkSize);
+			CreateObjects(mChunkSize > 0 ? mChunkSize : 1);
 
 		return mObjects.PopBack();
 	}
@@ -83,7 +97,44 @@ namespace o2
 	template<typename _type>
 	void Pool<_type>::CreateObjects(int count)
 	{
-		for (int i = 0; i < count; i++)
-			mObjects.Add(mnew _type());
+		if (count <= 0)
+			return;
+
+		_type* slab = mnew _type[count];
+		mSlabs.Add(slab);
+		mSlabSizes.Add(count);
+
+		// Reversed, so objects are taken in memory order
+		mObjects.Reserve(mObjects.Count() + count);
+		for (int i = count - 1; i >= 0; i--)
+			mObjects.Add(slab + i);
+	}
+
+	template<typename _type>
+	int Pool<_type>::GetFreeCount() const
+	{
+		return mObjects.Count();
+	}
+
+	template<typename _type>
+	int Pool<_type>::GetCapacity() const
+	{
+		int capacity = 0;
+		for (int i = 0; i < mSlabSizes.Count(); i++)
+			capacity += mSlabSizes[i];
+
+		return capacity;
+	}
+
+	template<typename _type>
+	bool Pool<_type>::IsOwned(const _type* obj) const
+	{
+		for (int i = 0; i < mSlabs.Count(); i++)
+		{
+			if (obj >= mSlabs[i] && obj < mSlabs[i] + mSlabSizes[i])
+				return true;
+		}
+
+		return false;
 	}
 }
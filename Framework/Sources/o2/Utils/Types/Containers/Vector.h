@@ -302,7 +302,7 @@ namespace o2
 	template<typename _type>
 	Vector<_type>::~Vector()
 	{
-		std::vector<_type>::~vector<_type>();
+
 	}
 
 	template<typename _type>
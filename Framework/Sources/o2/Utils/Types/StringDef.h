@@ -352,3 +352,15 @@ namespace o2
 	typedef TString<char> String;
 
 }
+
+namespace std
+{
+	// --------------------------------------------------------
+	// Hash of o2 string, same as hash of standard basic string
+	// --------------------------------------------------------
+	template<typename T>
+	struct hash<o2::TString<T>>
+	{
+		size_t operator()(const o2::TString<T>& str) const { return hash<basic_string<T>>()(str); }
+	};
+}
@@ -115,3 +115,14 @@ namespace o2
 
 	UID UID::empty = UID(0);
 }
+
+namespace std
+{
+	size_t hash<o2::UID>::operator()(const o2::UID& uid) const
+	{
+		o2::UInt64 parts[2];
+		memcpy(parts, uid.data, sizeof(parts));
+
+		return (size_t)(parts[0] ^ (parts[1]*0x9e3779b97f4a7c15ULL));
+	}
+}
@@ -42,3 +42,15 @@ namespace o2
 		static UID empty;
 	};
 }
+
+namespace std
+{
+	// --------------------------------------------
+	// Hash of UID, combines two halves of UID data
+	// --------------------------------------------
+	template<>
+	struct hash<o2::UID>
+	{
+		size_t operator()(const o2::UID& uid) const;
+	};
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <o2/Render/AALinesBatch.h>
+
+#include <chrono>
+#include <iostream>
+
+TEST(TestAALinesBatch, decimationKeepsEnds)
+{
+    o2::Vector<o2::Vertex2> points;
+    for (int i = 0; i <= 1000; i++)
+        points.Add(o2::Vertex2(o2::Vec2F((float)i*0.1f, 0.0f), 0, 0, 0));
+
+    o2::Vector<o2::Vertex2> decimated;
+    decimated.Resize(points.Count());
+
+    // 100 pixels long line with 1000 segments keeps about one point per pixel
+    int count = o2::AALinesBatch::DecimatePoints(points.Data(), points.Count(), o2::Vec2F(1.0f, 1.0f), 1.0f,
+                                                 decimated.Data());
+
+    EXPECT_LE(count, 101);
+    EXPECT_GE(count, 90);
+    EXPECT_EQ((o2::Vec2F)decimated[0], (o2::Vec2F)points[0]);
+    EXPECT_EQ((o2::Vec2F)decimated[count - 1], (o2::Vec2F)points.Last());
+
+    // Same line zoomed out into 10 pixels
+    count = o2::AALinesBatch::DecimatePoints(points.Data(), points.Count(), o2::Vec2F(10.0f, 10.0f), 1.0f,
+                                             decimated.Data());
+
+    EXPECT_LE(count, 11);
+    EXPECT_EQ((o2::Vec2F)decimated[count - 1], (o2::Vec2F)points.Last());
+}
+
+TEST(TestAALinesBatch, longLinesSplitIntoChunks)
+{
+    o2::AALinesBatch batch;
+    batch.SetLOD(0.0f);
+
+    o2::Vector<o2::Vec2F> points;
+    for (int i = 0; i < 40000; i++)
+        points.Add(o2::Vec2F((float)i, (float)(i%2)*10.0f));
+
+    batch.AddPolyLine(points.Data(), points.Count(), o2::Color4::White(), 1.0f, o2::LineType::Solid);
+    batch.AddLine(o2::Vec2F(0.0f, 0.0f), o2::Vec2F(10.0f, 10.0f), o2::Color4::Red(), 1.0f, o2::LineType::Dash);
+
+    EXPECT_FALSE(batch.IsEmpty());
+    EXPECT_GE(batch.GetVerticesCount(o2::LineType::Solid), 40000*4);
+    EXPECT_EQ(batch.GetVerticesCount(o2::LineType::Dash), 8);
+
+    batch.Clear();
+    EXPECT_TRUE(batch.IsEmpty());
+}
+
+TEST(TestAALinesBatch, chunksFitRenderBuffers)
+{
+    o2::AALinesBatch batch;
+    batch.SetLOD(0.0f);
+
+    // Line longer than one tessellated piece, each segment gives 18 indexes
+    o2::Vector<o2::Vec2F> points;
+    for (int i = 0; i < 10000; i++)
+        points.Add(o2::Vec2F((float)i, (float)(i%2)*10.0f));
+
+    batch.AddPolyLine(points.Data(), points.Count());
+
+    int chunksCount = batch.GetChunksCount(o2::LineType::Solid);
+    EXPECT_GT(chunksCount, 1);
+
+    int indexesCount = 0;
+    for (int i = 0; i < chunksCount; i++)
+    {
+        EXPECT_LE(batch.GetChunkVerticesCount(o2::LineType::Solid, i), 0xffff);
+        EXPECT_LE(batch.GetChunkIndexesCount(o2::LineType::Solid, i), 0xffff);
+        EXPECT_EQ(batch.GetChunkIndexesCount(o2::LineType::Solid, i)%3, 0);
+
+        indexesCount += batch.GetChunkIndexesCount(o2::LineType::Solid, i);
+    }
+
+    EXPECT_EQ(indexesCount, (points.Count() - 1)*18);
+}
+
+TEST(TestAALinesBatch, curvesTessellation)
+{
+    const int curvesCount = 100;
+    const int pointsCount = 5000;
+
+    o2::Vector<o2::Vec2F> points;
+    for (int i = 0; i < pointsCount; i++)
+        points.Add(o2::Vec2F((float)i*0.2f, o2::Math::Sin((float)i*0.01f)*100.0f));
+
+    o2::AALinesBatch batch;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < curvesCount; i++)
+        batch.AddPolyLine(points.Data(), points.Count());
+
+    auto end = std::chrono::high_resolution_clock::now();
+    double time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    std::cout << "Tessellating " << curvesCount << " curves of " << pointsCount << " points: " << time << " ms, "
+        << batch.GetVerticesCount(o2::LineType::Solid) << " vertices" << std::endl;
+
+    // Curve spans 1000 pixels horizontally, decimation must drop most of segments
+    EXPECT_LT(batch.GetVerticesCount(o2::LineType::Solid), curvesCount*pointsCount*4/2);
+}
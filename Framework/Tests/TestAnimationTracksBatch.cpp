@@ -0,0 +1,286 @@
+#include <gtest/gtest.h>
+
+#include <o2/Animation/AnimationClip.h>
+#include <o2/Animation/Tracks/AnimationFloatTrack.h>
+#include <o2/Animation/Tracks/AnimationVec2FTrack.h>
+#include <o2/Scene/Actor.h>
+#include <o2/Scene/Components/AnimationComponent.h>
+#include <o2/Utils/Reflection/Reflection.h>
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+    // Returns value of track as track player evaluates it at clip time
+    float EvaluateTrack(const o2::AnimationTrack<float>& track, float time)
+    {
+        float duration = track.GetDuration();
+        float position = time;
+
+        if (track.loop == o2::Loop::None)
+            position = o2::Math::Clamp(time, 0.0f, duration);
+        else
+        {
+            float x;
+            if (time > 0)
+                position = modff(time/duration, &x)*duration;
+            else
+                position = (1.0f - modff(-time/duration, &x))*duration;
+
+            if (track.loop == o2::Loop::PingPong && (int)x%2 == (time > 0 ? 1 : 0))
+                position = duration - position;
+        }
+
+        return track.GetValue(position);
+    }
+
+    // Creates actor out of scene, playing clip by animation component
+    o2::AnimationComponent* CreateAnimatedActor(const o2::AnimationClip& clip)
+    {
+        auto actor = mnew o2::Actor(o2::ActorCreateMode::NotInScene);
+        auto animation = actor->AddComponent<o2::AnimationComponent>();
+        animation->Play(clip);
+
+        return animation;
+    }
+
+    // Destroys animated actor. Actor destructor is protected, actors are deleted through base
+    void DeleteAnimatedActor(o2::AnimationComponent* animation)
+    {
+        delete dynamic_cast<o2::ActorBase*>(animation->GetOwnerActor());
+    }
+}
+
+TEST(TestAnimationTracksBatch, sameAsCurves)
+{
+    o2::AnimationClip clip;
+
+    auto linear = clip.AddTrack<float>("a");
+    *linear = o2::AnimationTrack<float>::Linear(0.0f, 10.0f, 2.0f);
+
+    auto smooth = clip.AddTrack<float>("b");
+    smooth->AddKey(0.0f, 1.0f);
+    smooth->AddKey(0.5f, 3.0f);
+    smooth->AddKey(1.2f, -2.0f);
+    smooth->AddKey(3.0f, 5.0f);
+    smooth->loop = o2::Loop::Repeat;
+
+    auto pingPong = clip.AddTrack<float>("c");
+    *pingPong = o2::AnimationTrack<float>::EaseInOut(-1.0f, 1.0f, 0.7f);
+    pingPong->loop = o2::Loop::PingPong;
+
+    auto single = clip.AddTrack<float>("d");
+    single->AddKey(0.0f, 7.0f);
+
+    clip.AddTrack<o2::Vec2F>("e");
+
+    const o2::AnimationTracksBatch& batch = clip.GetTracksBatch();
+    ASSERT_EQ(batch.GetTracksCount(), 4);
+
+    int cursors[4] = { 0, 0, 0, 0 };
+    float values[4];
+
+    // Forward, backward and jumping times check cursors searching in both directions
+    float times[] = { 0.0f, 0.1f, 0.3f, 0.6f, 1.0f, 1.7f, 2.5f, 3.4f, 0.2f, 5.1f, 4.9f, 1.1f, 0.05f };
+    for (float time : times)
+    {
+        batch.Sample(time, cursors, values);
+
+        EXPECT_NEAR(values[0], EvaluateTrack(*linear, time), 1e-4f) << "time " << time;
+        EXPECT_NEAR(values[1], EvaluateTrack(*smooth, time), 1e-4f) << "time " << time;
+        EXPECT_NEAR(values[2], EvaluateTrack(*pingPong, time), 1e-4f) << "time " << time;
+        EXPECT_EQ(values[3], 7.0f);
+    }
+}
+
+TEST(TestAnimationTracksBatch, recompiledOnChange)
+{
+    o2::AnimationClip clip;
+    auto track = clip.AddTrack<float>("a");
+    *track = o2::AnimationTrack<float>::Linear(0.0f, 1.0f, 1.0f);
+
+    o2::UInt version = clip.GetTracksBatch().GetVersion();
+    EXPECT_EQ(clip.GetTracksBatch().GetVersion(), version);
+
+    track->AddKey(2.0f, 5.0f);
+    EXPECT_NE(clip.GetTracksBatch().GetVersion(), version);
+
+    int cursor = 0;
+    float value = 0.0f;
+    clip.GetTracksBatch().Sample(2.0f, &cursor, &value);
+    EXPECT_NEAR(value, 5.0f, 1e-4f);
+
+    clip.RemoveTrack("a");
+    EXPECT_EQ(clip.GetTracksBatch().GetTracksCount(), 0);
+}
+
+TEST(TestAnimationTracksBatch, thousandClipsSampling)
+{
+    const int tracksCount = 32;
+    const int playersCount = 1000;
+
+    o2::AnimationClip clip;
+    o2::Vector<o2::AnimationTrack<float>*> tracks;
+    for (int i = 0; i < tracksCount; i++)
+    {
+        auto track = clip.AddTrack<float>((o2::String)i);
+        for (int j = 0; j < 10; j++)
+            track->AddKey((float)j*0.5f, (float)((i + j)%7));
+
+        tracks.Add(track);
+    }
+
+    const o2::AnimationTracksBatch& batch = clip.GetTracksBatch();
+
+    o2::Vector<int> cursors;
+    cursors.Resize(tracksCount*playersCount);
+    for (auto& cursor : cursors)
+        cursor = 0;
+
+    o2::Vector<float> values;
+    values.Resize(tracksCount*playersCount);
+
+    o2::Vector<int> cacheKeys;
+    cacheKeys.Resize(tracksCount*playersCount*2);
+    for (auto& key : cacheKeys)
+        key = 0;
+
+    const int framesCount = 20;
+    double batchTime = 0.0, tracksTime = 0.0;
+    float checkSum = 0.0f;
+
+    for (int frame = 0; frame < framesCount; frame++)
+    {
+        float time = (float)frame/framesCount*4.5f;
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (int i = 0; i < playersCount; i++)
+            batch.Sample(time + i*0.001f, &cursors[i*tracksCount], &values[i*tracksCount]);
+
+        auto middle = std::chrono::high_resolution_clock::now();
+
+        for (int i = 0; i < playersCount; i++)
+        {
+            for (int j = 0; j < tracksCount; j++)
+            {
+                int idx = (i*tracksCount + j)*2;
+                checkSum += tracks[j]->GetValue(time + i*0.001f, true, cacheKeys[idx], cacheKeys[idx + 1]);
+            }
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+
+        batchTime += std::chrono::duration<double, std::milli>(middle - start).count();
+        tracksTime += std::chrono::duration<double, std::milli>(end - middle).count();
+    }
+
+    std::cout << "Sampling " << playersCount << " clips with " << tracksCount << " tracks: batch "
+        << batchTime/framesCount << " ms, tracks " << tracksTime/framesCount << " ms per frame (" << checkSum << ")"
+        << std::endl;
+
+    EXPECT_NEAR(values[0], tracks[0]->GetValue(4.5f*(framesCount - 1)/framesCount), 1e-4f);
+}
+
+TEST(TestAnimationTracksBatch, bakedWithinTolerance)
+{
+    const float tolerance = 0.001f;
+
+    o2::AnimationTrack<float> source;
+    source.AddKey(0.0f, 1.0f);
+    source.AddKey(0.5f, 3.0f);
+    source.AddKey(1.2f, -2.0f);
+    source.AddKey(3.0f, 5.0f);
+
+    o2::AnimationClip clip;
+    auto baked = clip.AddTrack<float>("a");
+    *baked = source;
+    baked->Bake(30.0f, tolerance, false);
+
+    auto constant = clip.AddTrack<float>("b");
+    constant->AddKey(0.0f, 2.0f);
+    constant->AddKey(1.0f, 2.0f);
+    constant->Bake();
+
+    ASSERT_TRUE(baked->IsBaked());
+    EXPECT_TRUE(baked->GetKeys().IsEmpty());
+    EXPECT_FLOAT_EQ(baked->GetDuration(), source.GetDuration());
+    EXPECT_EQ(constant->GetBakedSamplesCount(), 1);
+    EXPECT_EQ(clip.GetDuration(), 3.0f);
+
+    const o2::AnimationTracksBatch& batch = clip.GetTracksBatch();
+    int cursors[2] = { 0, 0 };
+    float values[2];
+
+    for (int i = 0; i <= 300; i++)
+    {
+        float time = (float)i*0.01f;
+        batch.Sample(time, cursors, values);
+
+        // Error is checked at few points between samples, so real error can slightly exceed tolerance
+        EXPECT_NEAR(baked->GetValue(time), source.GetValue(time), tolerance*1.5f) << "time " << time;
+        EXPECT_NEAR(values[0], baked->GetValue(time), 1e-5f) << "time " << time;
+        EXPECT_NEAR(values[1], 2.0f, tolerance);
+    }
+
+    // Player evaluates baked track without curve keys
+    o2::AnimationTrack<float>::Player player;
+    float target = 0.0f;
+    player.SetTarget(&target);
+    player.SetTrack(baked);
+    player.ForceSetTime(1.5f, baked->GetDuration());
+    EXPECT_NEAR(target, source.GetValue(1.5f), tolerance*1.5f);
+
+    baked->AddKey(0.0f, 1.0f);
+    EXPECT_FALSE(baked->IsBaked());
+}
+
+TEST(TestAnimationTracksBatch, componentsUpdateSameAsOwn)
+{
+    if (!o2::Reflection::IsTypesInitialized())
+        o2::Reflection::InitializeTypes();
+
+    // Enough components for sampling on worker threads
+    const int componentsCount = 300;
+
+    o2::AnimationClip clip;
+    *clip.AddTrack<float>("transform/angle") = o2::AnimationTrack<float>::Linear(0.0f, 10.0f, 2.0f);
+    *clip.AddTrack<float>("transform/width") = o2::AnimationTrack<float>::EaseInOut(5.0f, 50.0f, 1.5f);
+
+    o2::Vector<o2::AnimationComponent*> batched, own;
+    for (int i = 0; i < componentsCount; i++)
+    {
+        batched.Add(CreateAnimatedActor(clip));
+        own.Add(CreateAnimatedActor(clip));
+    }
+
+    for (int frame = 0; frame < 10; frame++)
+    {
+        float dt = 0.05f + frame*0.01f;
+
+        o2::AnimationComponent::UpdateComponents(batched, dt);
+
+        // Actors update their components after batch, it must not update them twice
+        for (auto animation : batched)
+            animation->Update(dt);
+
+        for (auto animation : own)
+            animation->Update(dt);
+
+        for (int i = 0; i < componentsCount; i++)
+        {
+            auto batchedTransform = batched[i]->GetOwnerActor()->transform;
+            auto ownTransform = own[i]->GetOwnerActor()->transform;
+
+            ASSERT_FLOAT_EQ(batchedTransform->GetAngle(), ownTransform->GetAngle());
+            ASSERT_FLOAT_EQ(batchedTransform->GetWidth(), ownTransform->GetWidth());
+        }
+    }
+
+    for (int i = 0; i < componentsCount; i++)
+    {
+        DeleteAnimatedActor(batched[i]);
+        DeleteAnimatedActor(own[i]);
+    }
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <o2/Utils/Serialization/BinaryDataFormat.h>
+#include <o2/Utils/Serialization/JsonDataFormat.h>
+
+TEST(TestBinaryDataFormat, sameAsJson)
+{
+    const char* json = R"({
+        "name": "sample",
+        "empty": "",
+        "int": -5,
+        "uint": 7,
+        "int64": -12345678901234,
+        "uint64": 12345678901234,
+        "double": 0.25,
+        "flags": [true, false, null],
+        "nested": { "array": [1, [2, 3], {}], "object": { "key": "value" } },
+        "emptyArray": []
+    })";
+
+    o2::DataDocument source;
+    ASSERT_TRUE(o2::ParseJson(json, source));
+
+    o2::String binary;
+    o2::WriteBinary(binary, source);
+
+    o2::DataDocument loaded;
+    ASSERT_TRUE(o2::ParseBinary(binary.Data(), binary.size(), loaded));
+    EXPECT_TRUE(loaded == source);
+
+    o2::String sourceJson, loadedJson;
+    o2::WriteJson(sourceJson, source);
+    o2::WriteJson(loadedJson, loaded);
+    EXPECT_EQ(sourceJson, loadedJson);
+
+    // Strings are copied, so buffer can be released after parsing
+    binary.clear();
+    EXPECT_EQ((o2::String)loaded["name"], o2::String("sample"));
+}
+
+TEST(TestBinaryDataFormat, corruptedData)
+{
+    o2::DataDocument source;
+    ASSERT_TRUE(o2::ParseJson(R"({ "a": [1, 2, 3], "b": "text" })", source));
+
+    o2::String binary;
+    o2::WriteBinary(binary, source);
+
+    for (size_t length = 0; length < binary.size(); length++)
+    {
+        o2::DataDocument loaded;
+        EXPECT_FALSE(o2::ParseBinary(binary.Data(), length, loaded)) << "length " << length;
+    }
+
+    o2::String wrongTag = binary;
+    wrongTag[0] = (char)0x7f;
+
+    o2::DataDocument loaded;
+    EXPECT_FALSE(o2::ParseBinary(wrongTag.Data(), wrongTag.size(), loaded));
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <o2/Utils/Types/Containers/ConcurrentQueue.h>
+
+#include <thread>
+#include <vector>
+
+TEST(TestConcurrentQueue, test)
+{
+    o2::ConcurrentQueue<int> queue(4);
+    ASSERT_EQ(4, queue.GetCapacity());
+    ASSERT_TRUE(queue.IsEmpty());
+
+    for (int i = 0; i < 4; i++)
+        ASSERT_TRUE(queue.TryPush(i));
+
+    // queue is full
+    ASSERT_FALSE(queue.TryPush(4));
+    ASSERT_EQ(4, queue.GetApproxCount());
+
+    int value = -1;
+    for (int i = 0; i < 4; i++)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        ASSERT_EQ(i, value);
+    }
+
+    ASSERT_FALSE(queue.TryPop(value));
+    ASSERT_TRUE(queue.IsEmpty());
+}
+
+TEST(TestConcurrentQueue, multipleProducers)
+{
+    static const int producersCount = 4;
+    static const int valuesPerProducer = 100000;
+
+    o2::ConcurrentQueue<int> queue(1024);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producersCount; p++)
+    {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < valuesPerProducer; i++)
+            {
+                while (!queue.TryPush(p*valuesPerProducer + i))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // values from one producer must come in order
+    std::vector<int> lastValues(producersCount, -1);
+    int received = 0;
+    while (received < producersCount*valuesPerProducer)
+    {
+        int value;
+        if (!queue.TryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        int producer = value/valuesPerProducer;
+        ASSERT_LT(lastValues[producer], value);
+        lastValues[producer] = value;
+        received++;
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+
+    ASSERT_TRUE(queue.IsEmpty());
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <o2/Events/EventQueue.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+namespace
+{
+    struct TestEvent
+    {
+        int producer = 0;
+        int index = 0;
+    };
+}
+
+TEST(TestEventQueue, deliveredInPostingOrder)
+{
+    o2::EventQueue<int> queue(16);
+
+    o2::Vector<int> delivered;
+    int batches = 0;
+    queue.onEvent = [&](const int& event) { delivered.Add(event); };
+    queue.onEventsBatch = [&](const o2::Vector<int>& events) { batches++; };
+
+    for (int i = 0; i < 10; i++)
+        queue.Post(i);
+
+    EXPECT_EQ(queue.GetPendingCount(), 10);
+    EXPECT_EQ(queue.Process(), 10);
+    EXPECT_EQ(batches, 1);
+    EXPECT_EQ(queue.Process(), 0);
+
+    // Posting into full queue from consumer thread processes queued events first
+    for (int i = 10; i < 50; i++)
+        queue.Post(i);
+
+    queue.Process();
+
+    ASSERT_EQ(delivered.Count(), 50);
+    for (int i = 0; i < 50; i++)
+        EXPECT_EQ(delivered[i], i);
+}
+
+TEST(TestEventQueue, consumerIsProcessingThread)
+{
+    // Queue created on worker thread is processed on this thread, which becomes its consumer
+    std::unique_ptr<o2::EventQueue<int>> queue;
+    std::thread worker([&]() { queue.reset(new o2::EventQueue<int>(16)); });
+    worker.join();
+
+    o2::Vector<int> delivered;
+    queue->onEvent = [&](const int& event) { delivered.Add(event); };
+
+    EXPECT_EQ(queue->Process(), 0);
+
+    // Posting into full queue from consumer thread doesn't wait for other thread
+    for (int i = 0; i < 50; i++)
+        queue->Post(i);
+
+    queue->Process();
+
+    ASSERT_EQ(delivered.Count(), 50);
+    for (int i = 0; i < 50; i++)
+        EXPECT_EQ(delivered[i], i);
+}
+
+TEST(TestEventQueue, coalescing)
+{
+    o2::EventQueue<TestEvent> queue;
+    queue.SetCoalescing([](const TestEvent& event) { return (o2::UInt64)event.producer; });
+
+    o2::Vector<TestEvent> delivered;
+    queue.onEventsBatch = [&](const o2::Vector<TestEvent>& events) { delivered = events; };
+
+    for (int i = 0; i < 100; i++)
+        queue.Post(TestEvent{ i%3, i });
+
+    EXPECT_EQ(queue.Process(), 3);
+    ASSERT_EQ(delivered.Count(), 3);
+
+    // First posting order is kept, values are from last posted events
+    EXPECT_EQ(delivered[0].producer, 0);
+    EXPECT_EQ(delivered[0].index, 99);
+    EXPECT_EQ(delivered[1].producer, 1);
+    EXPECT_EQ(delivered[1].index, 97);
+    EXPECT_EQ(delivered[2].producer, 2);
+    EXPECT_EQ(delivered[2].index, 98);
+}
+
+TEST(TestEventQueue, manyProducersStress)
+{
+    const int producersCount = 8;
+    const int eventsPerProducer = 200000;
+
+    o2::EventQueue<TestEvent> queue(1024);
+
+    o2::Vector<int> lastIndexes;
+    lastIndexes.Resize(producersCount);
+    for (auto& index : lastIndexes)
+        index = -1;
+
+    int delivered = 0;
+    bool ordered = true;
+    queue.onEvent = [&](const TestEvent& event)
+    {
+        ordered = ordered && event.index == lastIndexes[event.producer] + 1;
+        lastIndexes[event.producer] = event.index;
+        delivered++;
+    };
+
+    std::atomic<int> finishedProducers(0);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < producersCount; i++)
+    {
+        producers.emplace_back([&queue, &finishedProducers, i, eventsPerProducer]()
+        {
+            for (int j = 0; j < eventsPerProducer; j++)
+                queue.Post(TestEvent{ i, j });
+
+            finishedProducers++;
+        });
+    }
+
+    while (finishedProducers < producersCount || queue.GetPendingCount() > 0)
+    {
+        if (queue.Process() == 0)
+            std::this_thread::yield();
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+
+    auto end = std::chrono::high_resolution_clock::now();
+    double time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    std::cout << "Delivered " << delivered << " events from " << producersCount << " producers in " << time
+        << " ms" << std::endl;
+
+    EXPECT_EQ(delivered, producersCount*eventsPerProducer);
+    EXPECT_TRUE(ordered);
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <o2/Utils/Types/Containers/HashMap.h>
+#include <o2/Utils/Types/Containers/HashSet.h>
+#include <o2/Utils/Types/Containers/Map.h>
+#include <o2/Utils/Types/UID.h>
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+    template<typename _func>
+    double MeasureMs(_func func)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        func();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    }
+
+    // Fills both containers with same keys, then measures lookups of all keys in each
+    template<typename _key_type>
+    void CompareLookups(const char* name, const o2::Vector<_key_type>& keys, int iterations)
+    {
+        o2::Map<_key_type, int> map;
+        o2::HashMap<_key_type, int> hashMap;
+
+        double mapInsertMs = MeasureMs([&]() { for (int i = 0; i < keys.Count(); i++) map[keys[i]] = i; });
+        double hashMapInsertMs = MeasureMs([&]() { for (int i = 0; i < keys.Count(); i++) hashMap[keys[i]] = i; });
+
+        ASSERT_EQ(map.Count(), hashMap.Count());
+
+        long long mapSum = 0, hashMapSum = 0;
+
+        double mapFindMs = MeasureMs([&]() {
+            for (int j = 0; j < iterations; j++)
+            {
+                for (auto& key : keys)
+                {
+                    int value = 0;
+                    if (map.TryGetValue(key, value))
+                        mapSum += value;
+                }
+            }
+        });
+
+        double hashMapFindMs = MeasureMs([&]() {
+            for (int j = 0; j < iterations; j++)
+            {
+                for (auto& key : keys)
+                {
+                    int value = 0;
+                    if (hashMap.TryGetValue(key, value))
+                        hashMapSum += value;
+                }
+            }
+        });
+
+        ASSERT_EQ(mapSum, hashMapSum);
+
+        std::cout << name << " keys " << keys.Count() << ": insert Map " << mapInsertMs << " ms, HashMap "
+            << hashMapInsertMs << " ms; lookups Map " << mapFindMs << " ms, HashMap " << hashMapFindMs << " ms"
+            << std::endl;
+    }
+}
+
+TEST(TestHashMap, test)
+{
+    o2::HashMap<int, int> map;
+    ASSERT_TRUE(map.IsEmpty());
+
+    for (int i = 0; i < 1000; i++)
+        map.Add(i*7, i);
+
+    ASSERT_EQ(1000, map.Count());
+
+    // Adding existing key doesn't replace value, like Map
+    map.Add(7, 100);
+    ASSERT_EQ(1, map.Get(7));
+
+    map.Set(7, 100);
+    ASSERT_EQ(100, map.Get(7));
+
+    for (int i = 0; i < 1000; i += 2)
+        map.Remove(i*7);
+
+    ASSERT_EQ(500, map.Count());
+
+    for (int i = 0; i < 1000; i++)
+        ASSERT_EQ(i % 2 == 1, map.ContainsKey(i*7));
+
+    // Removing in loop visits all elements
+    int visited = 0;
+    for (auto it = map.begin(); it != map.end();)
+    {
+        visited++;
+        if (it->first % 3 == 0)
+            it = map.erase(it);
+        else
+            ++it;
+    }
+
+    ASSERT_EQ(500, visited);
+
+    int expected = 0;
+    for (int i = 1; i < 1000; i += 2)
+    {
+        if ((i*7) % 3 != 0)
+            expected++;
+
+        ASSERT_EQ((i*7) % 3 != 0, map.find(i*7) != map.end());
+    }
+
+    ASSERT_EQ(expected, map.Count());
+
+    map.Clear();
+    ASSERT_TRUE(map.IsEmpty());
+    ASSERT_FALSE(map.ContainsKey(7));
+}
+
+TEST(TestHashMap, stringAndUIDKeys)
+{
+    o2::HashMap<o2::String, int> byPath;
+    o2::HashMap<o2::UID, int> byUID;
+    o2::Vector<o2::UID> uids;
+
+    for (int i = 0; i < 100; i++)
+    {
+        byPath[o2::String("Assets/Folder/File") + o2::String(i) + ".png"] = i;
+
+        o2::UID uid;
+        uid.Randomize();
+        uids.Add(uid);
+        byUID[uid] = i;
+    }
+
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(i, byPath.Get(o2::String("Assets/Folder/File") + o2::String(i) + ".png"));
+        ASSERT_EQ(i, byUID.Get(uids[i]));
+    }
+
+    o2::HashSet<o2::String> set;
+    ASSERT_TRUE(set.Add("a"));
+    ASSERT_FALSE(set.Add("a"));
+    ASSERT_TRUE(set.Contains("a"));
+    ASSERT_TRUE(set.Remove("a"));
+    ASSERT_FALSE(set.Contains("a"));
+}
+
+TEST(TestHashMap, benchmark)
+{
+    const int count = 10000;
+    const int iterations = 20;
+
+    o2::Vector<int> intKeys;
+    o2::Vector<o2::String> stringKeys;
+    o2::Vector<o2::UID> uidKeys;
+
+    for (int i = 0; i < count; i++)
+    {
+        intKeys.Add(i*31);
+        stringKeys.Add(o2::String("Assets/Textures/Folder/Texture") + o2::String(i) + ".png");
+
+        o2::UID uid;
+        uid.Randomize();
+        uidKeys.Add(uid);
+    }
+
+    CompareLookups("int", intKeys, iterations);
+    CompareLookups("String", stringKeys, iterations);
+    CompareLookups("UID", uidKeys, iterations);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <o2/Scene/UI/ItemsHeightsTree.h>
+
+namespace
+{
+    // Returns heights sum of first count items by linear iteration
+    float LinearPosition(const o2::Vector<float>& heights, int count)
+    {
+        float sum = 0;
+        for (int i = 0; i < count; i++)
+            sum += heights[i];
+
+        return sum;
+    }
+}
+
+TEST(TestItemsHeightsTree, positionsAndSearch)
+{
+    o2::ItemsHeightsTree tree(10.0f);
+    tree.Reset(100);
+
+    EXPECT_FLOAT_EQ(tree.GetTotalHeight(), 1000.0f);
+    EXPECT_EQ(tree.FindItem(-5.0f), 0);
+    EXPECT_EQ(tree.FindItem(95.0f), 9);
+    EXPECT_EQ(tree.FindItem(100.0f), 10);
+    EXPECT_EQ(tree.FindItem(5000.0f), 99);
+
+    o2::Vector<float> heights;
+    for (int i = 0; i < 100; i++)
+    {
+        heights.Add((float)(i%7)*3.0f + 1.0f);
+        tree.SetHeight(i, heights.Last());
+    }
+
+    for (int i = 0; i <= 100; i++)
+        EXPECT_FLOAT_EQ(tree.GetPosition(i), LinearPosition(heights, i)) << "item " << i;
+
+    for (int i = 0; i < 100; i++)
+    {
+        float top = tree.GetPosition(i);
+        EXPECT_EQ(tree.FindItem(top), i);
+        EXPECT_EQ(tree.FindItem(top + heights[i]*0.5f), i);
+    }
+}
+
+TEST(TestItemsHeightsTree, resizeAndInsert)
+{
+    o2::ItemsHeightsTree tree(10.0f);
+    o2::Vector<float> heights;
+
+    // Appending keeps measured heights, new items use default height
+    for (int count = 1; count <= 50; count++)
+    {
+        tree.Resize(count);
+        tree.SetHeight(count - 1, (float)count);
+        heights.Add((float)count);
+
+        EXPECT_FLOAT_EQ(tree.GetTotalHeight(), LinearPosition(heights, count));
+    }
+
+    tree.Insert(10, 5);
+    EXPECT_EQ(tree.GetCount(), 55);
+    EXPECT_FALSE(tree.IsMeasured(12));
+    EXPECT_FLOAT_EQ(tree.GetHeight(12), 10.0f);
+    EXPECT_FLOAT_EQ(tree.GetPosition(15), LinearPosition(heights, 10) + 50.0f);
+
+    tree.Remove(10, 5);
+    for (int i = 0; i <= 50; i++)
+        EXPECT_FLOAT_EQ(tree.GetPosition(i), LinearPosition(heights, i));
+
+    tree.Resize(20);
+    EXPECT_FLOAT_EQ(tree.GetTotalHeight(), LinearPosition(heights, 20));
+}
+
+TEST(TestItemsHeightsTree, anchor)
+{
+    o2::ItemsHeightsTree tree(20.0f);
+    tree.Reset(1000);
+
+    auto anchor = tree.GetAnchor(505.0f);
+    EXPECT_EQ(anchor.index, 25);
+    EXPECT_FLOAT_EQ(anchor.offset, 5.0f);
+
+    // Items inserted and measured above anchor move it down
+    tree.Insert(0, 3);
+    tree.SetHeight(0, 50.0f);
+    anchor.index += 3;
+
+    EXPECT_FLOAT_EQ(tree.GetPosition(anchor), 505.0f + 90.0f);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <o2/Scene/UI/WidgetLayout.h>
+#include <o2/Scene/UI/Widgets/HorizontalLayout.h>
+#include <o2/Scene/UI/Widgets/VerticalLayout.h>
+#include <o2/Utils/System/Time/Time.h>
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+    // Time singleton is created by application, layouts need it for dirty frames
+    struct BenchmarkTime: public o2::Time
+    {
+        BenchmarkTime() {}
+    };
+
+    int measuresCount = 0;
+
+    template<typename _layout>
+    struct CountingLayout: public _layout
+    {
+        void MeasureWithChildren(o2::Vec2F& minSize, o2::Vec2F& weight) const override
+        {
+            measuresCount++;
+            _layout::MeasureWithChildren(minSize, weight);
+        }
+    };
+
+    // Builds nested layouts alternating vertical and horizontal, each level has leaf widget and next level.
+    // Returns deepest leaf
+    o2::Widget* BuildNestedLayouts(o2::Widget* parent, int depth)
+    {
+        o2::Widget* level = parent;
+        o2::Widget* leaf = nullptr;
+
+        for (int i = 0; i < depth; i++)
+        {
+            leaf = mnew o2::Widget();
+            leaf->layout->minSize = o2::Vec2F(10, 10);
+            level->AddChild(leaf);
+
+            o2::Widget* next;
+            if (i % 2 == 0)
+            {
+                auto layout = mnew CountingLayout<o2::HorizontalLayout>();
+                layout->fitByChildren = true;
+                layout->spacing = 1.0f;
+                next = layout;
+            }
+            else
+            {
+                auto layout = mnew CountingLayout<o2::VerticalLayout>();
+                layout->fitByChildren = true;
+                layout->spacing = 1.0f;
+                next = layout;
+            }
+
+            level->AddChild(next);
+            level = next;
+        }
+
+        return leaf;
+    }
+}
+
+TEST(TestLayoutBenchmark, nestedLayouts)
+{
+    BenchmarkTime time;
+
+    const int depth = 32;
+    const int iterations = 2000;
+
+    auto root = mnew CountingLayout<o2::VerticalLayout>();
+    root->fitByChildren = true;
+    root->layout->size = o2::Vec2F(100, 100);
+
+    o2::Widget* deepestLeaf = BuildNestedLayouts(root, depth);
+    root->UpdateTransform();
+
+    auto begin = std::chrono::steady_clock::now();
+
+    measuresCount = 0;
+    for (int i = 0; i < iterations; i++)
+    {
+        deepestLeaf->layout->minSize = o2::Vec2F(10.0f + (float)(i % 7), 10.0f);
+        deepestLeaf->UpdateTransform();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - begin).count();
+
+    std::cout << "Nested layouts depth " << depth << ": " << ms/iterations << " ms per change, "
+        << (double)measuresCount/iterations << " measures per change" << std::endl;
+
+    // Each leaf change measures every layout above leaf once: root and depth - 1 nested layouts
+    ASSERT_EQ(depth*iterations, measuresCount);
+
+    // Vertical layouts are on each second level, each of them fits leaf above next level
+    ASSERT_GE(root->layout->GetHeight(), (depth/2)*10.0f);
+
+    delete root;
+}
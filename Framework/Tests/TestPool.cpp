@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <o2/Utils/Types/Containers/Pool.h>
+
+namespace
+{
+    struct PoolItem
+    {
+        int value = 7;
+    };
+}
+
+TEST(TestPool, slabsAreContiguous)
+{
+    o2::Pool<PoolItem> pool(4, 4);
+    EXPECT_EQ(pool.GetCapacity(), 4);
+
+    // Objects are taken in memory order from one slab
+    PoolItem* first = pool.Take();
+    for (int i = 1; i < 4; i++)
+        EXPECT_EQ(pool.Take(), first + i);
+
+    EXPECT_EQ(first->value, 7);
+    EXPECT_EQ(pool.GetFreeCount(), 0);
+
+    PoolItem* next = pool.Take();
+    EXPECT_EQ(pool.GetCapacity(), 8);
+    EXPECT_TRUE(pool.IsOwned(next));
+    EXPECT_FALSE(pool.IsOwned(first - 1));
+}
+
+TEST(TestPool, freedObjectsAreReused)
+{
+    o2::Pool<PoolItem> pool(2, 2);
+
+    PoolItem* item = pool.Take();
+    item->value = 42;
+    pool.Free(item);
+
+    EXPECT_EQ(pool.Take(), item);
+    EXPECT_EQ(item->value, 42);
+    EXPECT_EQ(pool.GetCapacity(), 2);
+}
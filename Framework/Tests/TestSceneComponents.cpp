@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <o2/Scene/Actor.h>
+#include <o2/Scene/Components/AnimationComponent.h>
+#include <o2/Scene/Components/EditorTestComponent.h>
+#include <o2/Scene/Scene.h>
+#include <o2/Utils/Reflection/Reflection.h>
+
+namespace
+{
+    // Scene singleton is created by application, tests create it directly
+    struct TestScene: public o2::Scene
+    {
+        TestScene()
+        {
+            if (!o2::Reflection::IsTypesInitialized())
+                o2::Reflection::InitializeTypes();
+        }
+    };
+
+    // Creates actor with components out of scene and adds it to scene immediately
+    template<typename ... _components>
+    o2::Actor* CreateSceneActor()
+    {
+        auto actor = mnew o2::Actor(o2::ActorCreateMode::NotInScene);
+        (actor->AddComponent(mnew _components()), ...);
+        actor->AddToScene();
+
+        return actor;
+    }
+
+    // Destroys actor immediately. Actor destructor is protected, actors are deleted through base
+    void DeleteActor(o2::Actor* actor)
+    {
+        delete dynamic_cast<o2::ActorBase*>(actor);
+    }
+
+    // Returns components visited by scene ForEach
+    template<typename _type>
+    o2::Vector<_type*> CollectComponents(o2::Scene& scene)
+    {
+        o2::Vector<_type*> res;
+        scene.ForEach<_type>([&](_type* component) { res.Add(component); });
+        return res;
+    }
+}
+
+TEST(TestSceneComponents, registerAndSwapRemove)
+{
+    TestScene scene;
+
+    o2::Vector<o2::Actor*> actors;
+    for (int i = 0; i < 5; i++)
+        actors.Add(CreateSceneActor<o2::AnimationComponent>());
+
+    EXPECT_EQ(scene.GetComponentsCount<o2::AnimationComponent>(), 5);
+    EXPECT_EQ(scene.GetComponentsCount<o2::Component>(), 5);
+    EXPECT_EQ(scene.GetComponentsCount<o2::EditorTestComponent>(), 0);
+
+    // Removing from the middle moves last component into its place, other components must stay reachable
+    DeleteActor(actors[1]);
+    actors.RemoveAt(1);
+
+    auto components = CollectComponents<o2::AnimationComponent>(scene);
+    EXPECT_EQ(scene.GetComponentsCount<o2::AnimationComponent>(), 4);
+    EXPECT_EQ(components.Count(), 4);
+    for (auto actor : actors)
+        EXPECT_TRUE(components.Contains(actor->GetComponent<o2::AnimationComponent>()));
+
+    // Removing last component doesn't break storage
+    DeleteActor(actors.PopBack());
+    EXPECT_EQ(scene.GetComponentsCount<o2::AnimationComponent>(), 3);
+
+    // Component removed from actor on scene is unregistered, added one is registered
+    actors[0]->RemoveComponent(actors[0]->GetComponent<o2::AnimationComponent>());
+    EXPECT_EQ(scene.GetComponentsCount<o2::AnimationComponent>(), 2);
+
+    actors[0]->AddComponent(mnew o2::AnimationComponent());
+    EXPECT_EQ(scene.GetComponentsCount<o2::AnimationComponent>(), 3);
+
+    // Actor removed from scene unregisters its components, added back registers them again
+    actors[0]->RemoveFromScene();
+    EXPECT_EQ(scene.GetComponentsCount<o2::AnimationComponent>(), 2);
+    EXPECT_FALSE(CollectComponents<o2::AnimationComponent>(scene).Contains(
+        actors[0]->GetComponent<o2::AnimationComponent>()));
+
+    actors[0]->AddToScene();
+    EXPECT_EQ(scene.GetComponentsCount<o2::AnimationComponent>(), 3);
+
+    for (auto actor : actors)
+        DeleteActor(actor);
+
+    EXPECT_EQ(scene.GetComponentsCount<o2::AnimationComponent>(), 0);
+    EXPECT_TRUE(CollectComponents<o2::AnimationComponent>(scene).IsEmpty());
+}
+
+TEST(TestSceneComponents, forEachWithOtherComponents)
+{
+    TestScene scene;
+
+    auto both = CreateSceneActor<o2::AnimationComponent, o2::EditorTestComponent>();
+    auto onlyAnimation = CreateSceneActor<o2::AnimationComponent>();
+    auto onlyTest = CreateSceneActor<o2::EditorTestComponent>();
+
+    // Only actors with all requested components are visited
+    int visitsCount = 0;
+    scene.ForEach<o2::AnimationComponent, o2::EditorTestComponent>(
+        [&](o2::AnimationComponent* animation, o2::EditorTestComponent* test)
+        {
+            visitsCount++;
+            EXPECT_EQ(animation->GetOwnerActor(), both);
+            EXPECT_EQ(test->GetOwnerActor(), both);
+        });
+
+    EXPECT_EQ(visitsCount, 1);
+
+    // Base type query visits storages of all derived types
+    EXPECT_EQ(CollectComponents<o2::Component>(scene).Count(), 4);
+    EXPECT_EQ(scene.GetComponentsCount<o2::Component>(), 4);
+
+    DeleteActor(both);
+    DeleteActor(onlyAnimation);
+    DeleteActor(onlyTest);
+
+    EXPECT_EQ(scene.GetComponentsCount<o2::Component>(), 0);
+}
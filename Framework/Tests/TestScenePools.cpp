@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <o2/Scene/Actor.h>
+#include <o2/Scene/Scene.h>
+#include <o2/Utils/Reflection/Reflection.h>
+
+namespace
+{
+    // Scene singleton is created by application, tests create it directly. Pools are opened for checks
+    struct TestScene: public o2::Scene
+    {
+        using o2::Scene::TakePooledActor;
+        using o2::Scene::SpawnPooledActor;
+
+        TestScene()
+        {
+            if (!o2::Reflection::IsTypesInitialized())
+                o2::Reflection::InitializeTypes();
+        }
+    };
+
+    // Actor of pool with update callback
+    struct PooledActor: public o2::Actor
+    {
+        o2::Function<void()> onUpdate; // Called from actor update
+
+        int startsCount = 0; // Count of OnStart calls
+
+        PooledActor(const o2::UID& poolId):
+            o2::Actor(o2::ActorCreateMode::NotInScene)
+        {
+            mPoolId = poolId;
+        }
+
+        // Takes actor from pool like Actor::Spawn does. Spawn needs prototype asset, which requires assets system
+        static PooledActor* SpawnFromPool(TestScene& scene, const o2::UID& poolId)
+        {
+            auto actor = dynamic_cast<PooledActor*>(scene.TakePooledActor(poolId));
+            if (actor)
+            {
+                actor->SetPooledInHierarchy(false);
+                scene.SpawnPooledActor(actor);
+            }
+
+            return actor;
+        }
+
+        void OnUpdate(float dt) override
+        {
+            if (!onUpdate.IsEmpty())
+                onUpdate();
+        }
+
+        void OnStart() override
+        {
+            startsCount++;
+        }
+    };
+
+    // Creates actor of pool and adds it to scene immediately
+    PooledActor* CreatePooledActor(const o2::UID& poolId)
+    {
+        auto actor = mnew PooledActor(poolId);
+        actor->AddToScene();
+        return actor;
+    }
+
+    // Destroys actor immediately. Actor destructor is protected, actors are deleted through base
+    void DeleteActor(o2::Actor* actor)
+    {
+        delete dynamic_cast<o2::ActorBase*>(actor);
+    }
+}
+
+TEST(TestScenePools, despawnAndSpawnFromUpdate)
+{
+    TestScene scene;
+    o2::UID poolId;
+    poolId.Randomize();
+
+    auto updater = CreatePooledActor(poolId);
+    auto first = CreatePooledActor(poolId);
+    auto second = CreatePooledActor(poolId);
+
+    // Despawn during root actors iteration doesn't change scene lists immediately
+    updater->onUpdate = [&]() { first->Despawn(); second->Despawn(); };
+    scene.Update(0.1f);
+
+    EXPECT_TRUE(first->IsPooled());
+    EXPECT_TRUE(second->IsPooled());
+    EXPECT_TRUE(first->IsOnScene());
+    EXPECT_EQ(scene.GetRootActors().Count(), 3);
+
+    // Despawned actors are removed from scene and put into pool at next frame
+    updater->onUpdate.Clear();
+    scene.Update(0.1f);
+
+    EXPECT_FALSE(first->IsOnScene());
+    EXPECT_FALSE(second->IsOnScene());
+    EXPECT_EQ(scene.GetRootActors().Count(), 1);
+
+    // Spawn during update takes actor from pool and adds it to scene at next frame without OnStart
+    PooledActor* spawned = nullptr;
+    updater->onUpdate = [&]() { spawned = PooledActor::SpawnFromPool(scene, poolId); };
+    scene.Update(0.1f);
+
+    ASSERT_NE(spawned, nullptr);
+    EXPECT_FALSE(spawned->IsPooled());
+    EXPECT_FALSE(spawned->IsOnScene());
+    EXPECT_EQ(scene.GetRootActors().Count(), 1);
+
+    int startsCount = spawned->startsCount;
+    updater->onUpdate.Clear();
+    scene.Update(0.1f);
+
+    EXPECT_TRUE(spawned->IsOnScene());
+    EXPECT_EQ(scene.GetRootActors().Count(), 2);
+    EXPECT_EQ(spawned->startsCount, startsCount);
+
+    // Actor spawned and despawned in one frame stays in pool
+    updater->onUpdate = [&]()
+    {
+        auto actor = PooledActor::SpawnFromPool(scene, poolId);
+        ASSERT_NE(actor, nullptr);
+        actor->Despawn();
+    };
+    scene.Update(0.1f);
+
+    updater->onUpdate.Clear();
+    scene.Update(0.1f);
+
+    EXPECT_EQ(scene.GetRootActors().Count(), 2);
+
+    auto pooled = scene.TakePooledActor(poolId);
+    ASSERT_NE(pooled, nullptr);
+    EXPECT_TRUE(pooled->IsPooled());
+
+    DeleteActor(pooled);
+    DeleteActor(updater);
+    DeleteActor(spawned);
+}
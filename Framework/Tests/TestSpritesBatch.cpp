@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <o2/Render/SpritesBatch.h>
+
+#include <chrono>
+#include <iostream>
+
+TEST(TestSpritesBatch, expandedQuadCorners)
+{
+    o2::Basis basis(o2::Vec2F(10.0f, 20.0f), o2::Vec2F(4.0f, 1.0f), o2::Vec2F(-1.0f, 3.0f));
+
+    o2::RectF uv;
+    uv.left = 0.25f;
+    uv.right = 0.5f;
+    uv.top = 0.1f;
+    uv.bottom = 0.3f;
+
+    o2::SpriteInstance instance(basis, uv, o2::Color4::Red());
+
+    o2::Vertex2 vertices[4];
+    o2::SpritesBatch::ExpandInstances(&instance, 1, vertices);
+
+    EXPECT_EQ((o2::Vec2F)vertices[0], basis.origin + basis.yv);
+    EXPECT_EQ((o2::Vec2F)vertices[1], basis.origin + basis.yv + basis.xv);
+    EXPECT_EQ((o2::Vec2F)vertices[2], basis.origin + basis.xv);
+    EXPECT_EQ((o2::Vec2F)vertices[3], basis.origin);
+
+    EXPECT_EQ(vertices[0].tu, uv.left);
+    EXPECT_EQ(vertices[0].tv, uv.top);
+    EXPECT_EQ(vertices[2].tu, uv.right);
+    EXPECT_EQ(vertices[2].tv, uv.bottom);
+
+    for (auto& vertex : vertices)
+        EXPECT_EQ(vertex.color, o2::Color4::Red().ABGR());
+}
+
+TEST(TestSpritesBatch, removingMovesLast)
+{
+    o2::SpritesBatch batch;
+
+    for (int i = 0; i < 4; i++)
+        batch.Add(o2::SpriteInstance(o2::Basis::Translated(o2::Vec2F((float)i, 0.0f)), o2::RectF()));
+
+    batch.Remove(1);
+
+    EXPECT_EQ(batch.GetCount(), 3);
+    EXPECT_EQ(batch.Get(1).basis.origin, o2::Vec2F(3.0f, 0.0f));
+}
+
+TEST(TestSpritesBatch, fiftyThousandSprites)
+{
+    const int spritesCount = 50000;
+
+    o2::Vector<o2::SpriteInstance> instances;
+    instances.Reserve(spritesCount);
+    for (int i = 0; i < spritesCount; i++)
+    {
+        o2::Basis basis = o2::Basis::Build(o2::Vec2F((float)(i%250)*8.0f, (float)(i/250)*8.0f), o2::Vec2F(8.0f, 8.0f),
+                                           (float)i*0.01f, 0.0f);
+        instances.Add(o2::SpriteInstance(basis, o2::RectF(0.0f, 0.0f, 1.0f, 1.0f)));
+    }
+
+    o2::Vector<o2::Vertex2> vertices;
+    vertices.Resize(spritesCount*4);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int framesCount = 10;
+    for (int i = 0; i < framesCount; i++)
+        o2::SpritesBatch::ExpandInstances(instances.Data(), spritesCount, vertices.Data());
+
+    auto end = std::chrono::high_resolution_clock::now();
+    double frameTime = std::chrono::duration<double, std::milli>(end - start).count()/framesCount;
+
+    std::cout << "Expanding " << spritesCount << " sprites: " << frameTime << " ms per frame" << std::endl;
+
+    EXPECT_EQ((o2::Vec2F)vertices[spritesCount*4 - 1], instances.Last().basis.origin);
+}
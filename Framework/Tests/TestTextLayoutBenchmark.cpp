@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <o2/Render/Font.h>
+#include <o2/Render/FontRef.h>
+#include <o2/Render/Text.h>
+#include <o2/Render/TextLayoutCache.h>
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+    // Font with monospace ASCII characters, doesn't need render and textures
+    class BenchmarkFont: public o2::Font
+    {
+    public:
+        BenchmarkFont(int height)
+        {
+            for (int id = 32; id < 127; id++)
+            {
+                Character character;
+                character.mId = (o2::UInt16)id;
+                character.mHeight = height;
+                character.mSize = o2::Vec2F(7.0f, 12.0f);
+                character.mOrigin = o2::Vec2F(0.0f, 2.0f);
+                character.mAdvance = 7.0f;
+                character.mTexSrc = o2::RectF(0.0f, 0.0f, 0.1f, 0.1f);
+
+                AddCharacter(character);
+            }
+
+            mReady = true;
+        }
+
+        float GetHeightPx(int height) const override { return 10.0f; }
+        float GetLineHeightPx(int height) const override { return 14.0f; }
+    };
+
+    o2::WString MakeLabel(int idx)
+    {
+        static const char* words[] = { "Position", "Rotation", "Scale", "Enabled", "Color", "Layer", "Name", "Size" };
+        return o2::WString(words[idx % 8]) + " " + (o2::WString)(idx % 100);
+    }
+
+    // Lays out labels and returns spent time in milliseconds
+    double LayoutLabels(o2::Font* font, int count)
+    {
+        o2::Text::SymbolsSet symbolsSet;
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (int i = 0; i < count; i++)
+        {
+            symbolsSet.Initialize(font, MakeLabel(i), 11, o2::Vec2F(0.0f, (float)i*20.0f), o2::Vec2F(120.0f, 20.0f),
+                                  o2::HorAlign::Left, o2::VerAlign::Middle, false, true, 1.0f, 1.0f);
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+TEST(TestTextLayoutBenchmark, cachedLayoutIsSame)
+{
+    BenchmarkFont font(11);
+    o2::TextLayoutCache cache;
+
+    const o2::WString text = "Some long text with words wrapping\nand new line";
+
+    for (int i = 0; i < 3; i++)
+    {
+        o2::Vec2F position(13.3f*i, -7.6f*i);
+
+        o2::Text::SymbolsSet uncached;
+        uncached.InitializeUncached(&font, text, 11, position, o2::Vec2F(100.0f, 80.0f), o2::HorAlign::Middle,
+                                    o2::VerAlign::Top, true, false, 1.0f, 1.0f);
+
+        o2::Text::SymbolsSet cached;
+        bool fromCache = cache.Initialize(cached, &font, text, 11, position, o2::Vec2F(100.0f, 80.0f), o2::HorAlign::Middle,
+                                          o2::VerAlign::Top, true, false, 1.0f, 1.0f);
+
+        EXPECT_EQ(fromCache, i > 0);
+        EXPECT_EQ(cached.mRealSize, uncached.mRealSize);
+        EXPECT_EQ(cached.mPosition, uncached.mPosition);
+        ASSERT_EQ(cached.mLines.Count(), uncached.mLines.Count());
+
+        for (int j = 0; j < cached.mLines.Count(); j++)
+        {
+            EXPECT_EQ(cached.mLines[j].mPosition, uncached.mLines[j].mPosition);
+            EXPECT_EQ(cached.mLines[j].mString, uncached.mLines[j].mString);
+            ASSERT_EQ(cached.mLines[j].mSymbols.Count(), uncached.mLines[j].mSymbols.Count());
+
+            for (int k = 0; k < cached.mLines[j].mSymbols.Count(); k++)
+                EXPECT_EQ(cached.mLines[j].mSymbols[k].mFrame, uncached.mLines[j].mSymbols[k].mFrame);
+        }
+    }
+}
+
+TEST(TestTextLayoutBenchmark, leastRecentlyUsedRemoving)
+{
+    BenchmarkFont font(11);
+    o2::TextLayoutCache cache(2);
+    o2::Text::SymbolsSet symbolsSet;
+
+    auto initialize = [&](const char* text)
+    {
+        return cache.Initialize(symbolsSet, &font, text, 11, o2::Vec2F(), o2::Vec2F(), o2::HorAlign::Left,
+                                o2::VerAlign::Top, false, false, 1.0f, 1.0f);
+    };
+
+    EXPECT_FALSE(initialize("a"));
+    EXPECT_FALSE(initialize("b"));
+    EXPECT_TRUE(initialize("a"));
+    EXPECT_FALSE(initialize("c"));
+    EXPECT_EQ(cache.GetCount(), 2);
+    EXPECT_TRUE(initialize("a"));
+    EXPECT_FALSE(initialize("b"));
+}
+
+TEST(TestTextLayoutBenchmark, tenThousandLabels)
+{
+    BenchmarkFont font(11);
+
+    const int labelsCount = 10000;
+
+    o2::Text::GetLayoutCache().Clear();
+    o2::Text::GetLayoutCache().SetCapacity(0);
+    double uncachedTime = LayoutLabels(&font, labelsCount);
+
+    o2::Text::GetLayoutCache().SetCapacity(4096);
+    double coldTime = LayoutLabels(&font, labelsCount);
+    double warmTime = LayoutLabels(&font, labelsCount);
+
+    std::cout << "Layout of " << labelsCount << " labels: without cache " << uncachedTime << " ms, cold cache "
+        << coldTime << " ms, warm cache " << warmTime << " ms" << std::endl;
+
+    EXPECT_LE(o2::Text::GetLayoutCache().GetCount(), 800);
+    o2::Text::GetLayoutCache().Clear();
+}